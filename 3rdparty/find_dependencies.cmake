@@ -258,6 +258,25 @@ if(WITH_OPENMP)
     endif()
 endif()
 
+# BLAS
+if(WITH_BLAS)
+    find_package(BLAS)
+    find_path(CBLAS_INCLUDE_DIR cblas.h)
+    if(BLAS_FOUND AND CBLAS_INCLUDE_DIR)
+        message(STATUS "Building with BLAS ${BLAS_LIBRARIES}")
+        add_library(3rdparty_blas INTERFACE)
+        target_include_directories(3rdparty_blas SYSTEM INTERFACE ${CBLAS_INCLUDE_DIR})
+        target_link_libraries(3rdparty_blas INTERFACE ${BLAS_LIBRARIES})
+        target_compile_definitions(3rdparty_blas INTERFACE OPEN3D_USE_BLAS)
+        install(TARGETS 3rdparty_blas EXPORT ${PROJECT_NAME}Targets)
+        add_library(${PROJECT_NAME}::3rdparty_blas ALIAS 3rdparty_blas)
+        set(BLAS_TARGET "3rdparty_blas")
+        list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS "${BLAS_TARGET}")
+    else()
+        message(STATUS "Unable to find BLAS with cblas.h, matrix products use the built-in kernel")
+    endif()
+endif()
+
 # Dirent
 if(WIN32)
     message(STATUS "Building library 3rdparty_dirent from source (WIN32)")
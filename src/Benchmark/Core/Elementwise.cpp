@@ -0,0 +1,209 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Core/TensorExpr.h"
+#include "Open3D/Utility/CPUInfo.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+enum class EWPath {
+    Strided,     // Transposed inputs, per-element offset computation.
+    Contiguous,  // Contiguous inputs, scalar kernels.
+    Vectorized,  // Contiguous inputs, SIMD kernels.
+};
+
+static void BinaryEWAddCPU(benchmark::State& state, Dtype dtype, EWPath path) {
+    Device device("CPU:0");
+    SizeVector shape{2048, 2048};
+    Tensor lhs = Tensor::Ones(shape, dtype, device);
+    Tensor rhs = Tensor::Ones(shape, dtype, device);
+    if (path == EWPath::Strided) {
+        lhs = lhs.T();
+        rhs = rhs.T();
+    }
+    utility::SetMaxSIMDLevel(path == EWPath::Vectorized
+                                     ? utility::SIMDLevel::AVX512
+                                     : utility::SIMDLevel::Scalar);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+    utility::SetMaxSIMDLevel(utility::SIMDLevel::AVX512);
+}
+
+static void UnaryEWSqrtCPU(benchmark::State& state, Dtype dtype, EWPath path) {
+    Device device("CPU:0");
+    SizeVector shape{2048, 2048};
+    Tensor src = Tensor::Ones(shape, dtype, device);
+    if (path == EWPath::Strided) {
+        src = src.T();
+    }
+    utility::SetMaxSIMDLevel(path == EWPath::Vectorized
+                                     ? utility::SIMDLevel::AVX512
+                                     : utility::SIMDLevel::Scalar);
+    Tensor warm_up = src.Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sqrt();
+    }
+    utility::SetMaxSIMDLevel(utility::SIMDLevel::AVX512);
+}
+
+static void PointsBroadcastAddCPU(benchmark::State& state, Dtype dtype) {
+    // Translates an (N, 3) point tensor by a (3,) offset. The offset is
+    // neither contiguous nor a scalar, so the per-element indexer path runs.
+    Device device("CPU:0");
+    Tensor points = Tensor::Ones({1 << 20, 3}, dtype, device);
+    Tensor offset = Tensor::Ones({3}, dtype, device);
+    Tensor warm_up = points + offset;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = points + offset;
+    }
+}
+
+static void ChainedEWCPU(benchmark::State& state, Dtype dtype, bool fused) {
+    Device device("CPU:0");
+    SizeVector shape{1 << 20, 3};
+    Tensor a = Tensor::Ones(shape, dtype, device);
+    Tensor b = Tensor::Ones(shape, dtype, device);
+    Tensor c = Tensor::Ones(shape, dtype, device);
+    Tensor d = Tensor::Ones(shape, dtype, device);
+    Tensor warm_up = ((a.Lazy() - b) * c + d).Contiguous();
+    (void)warm_up;
+    for (auto _ : state) {
+        if (fused) {
+            Tensor dst = ((a.Lazy() - b) * c + d).Contiguous();
+        } else {
+            Tensor dst = (a - b) * c + d;
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Float32_Strided,
+                  Dtype::Float32,
+                  EWPath::Strided)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Float32_Contiguous,
+                  Dtype::Float32,
+                  EWPath::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Float32_Vectorized,
+                  Dtype::Float32,
+                  EWPath::Vectorized)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Float64_Strided,
+                  Dtype::Float64,
+                  EWPath::Strided)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Float64_Contiguous,
+                  Dtype::Float64,
+                  EWPath::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Float64_Vectorized,
+                  Dtype::Float64,
+                  EWPath::Vectorized)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU, Int32_Strided, Dtype::Int32, EWPath::Strided)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Int32_Contiguous,
+                  Dtype::Int32,
+                  EWPath::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Int32_Vectorized,
+                  Dtype::Int32,
+                  EWPath::Vectorized)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU, Int64_Strided, Dtype::Int64, EWPath::Strided)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Int64_Contiguous,
+                  Dtype::Int64,
+                  EWPath::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWAddCPU,
+                  Int64_Vectorized,
+                  Dtype::Int64,
+                  EWPath::Vectorized)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrtCPU,
+                  Float32_Strided,
+                  Dtype::Float32,
+                  EWPath::Strided)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrtCPU,
+                  Float32_Contiguous,
+                  Dtype::Float32,
+                  EWPath::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrtCPU,
+                  Float32_Vectorized,
+                  Dtype::Float32,
+                  EWPath::Vectorized)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrtCPU,
+                  Float64_Strided,
+                  Dtype::Float64,
+                  EWPath::Strided)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrtCPU,
+                  Float64_Contiguous,
+                  Dtype::Float64,
+                  EWPath::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrtCPU,
+                  Float64_Vectorized,
+                  Dtype::Float64,
+                  EWPath::Vectorized)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(PointsBroadcastAddCPU, Float32, Dtype::Float32)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(PointsBroadcastAddCPU, Float64, Dtype::Float64)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ChainedEWCPU, Float32_Eager, Dtype::Float32, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ChainedEWCPU, Float32_Fused, Dtype::Float32, true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ChainedEWCPU, Float64_Eager, Dtype::Float64, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ChainedEWCPU, Float64_Fused, Dtype::Float64, true)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Core>
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+template <typename T>
+using RowMajorMatrix =
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+static Tensor RandomTensor(const SizeVector& shape) {
+    std::vector<float> vals(shape.NumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = float((i * 7919) % 1013) / 1013.f - 0.5f;
+    }
+    return Tensor(vals, shape, Dtype::Float32, Device("CPU:0"));
+}
+
+static void MatmulCPU(benchmark::State& state,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n) {
+    Tensor a = RandomTensor({m, k});
+    Tensor b = RandomTensor({k, n});
+    Tensor warm_up = a.Matmul(b);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor c = a.Matmul(b);
+    }
+    state.SetItemsProcessed(state.iterations() * m * n * k);
+}
+
+static void MatmulEigen(benchmark::State& state,
+                        int64_t m,
+                        int64_t k,
+                        int64_t n) {
+    Tensor a = RandomTensor({m, k});
+    Tensor b = RandomTensor({k, n});
+    Eigen::Map<const RowMajorMatrix<float>> a_map(
+            static_cast<const float*>(a.GetDataPtr()), m, k);
+    Eigen::Map<const RowMajorMatrix<float>> b_map(
+            static_cast<const float*>(b.GetDataPtr()), k, n);
+    RowMajorMatrix<float> c(m, n);
+    for (auto _ : state) {
+        c.noalias() = a_map * b_map;
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * m * n * k);
+}
+
+static void BatchedMatmulCPU(benchmark::State& state,
+                             int64_t batch_size,
+                             int64_t size) {
+    Tensor a = RandomTensor({batch_size, size, size});
+    Tensor b = RandomTensor({batch_size, size, size});
+    for (auto _ : state) {
+        Tensor c = a.Matmul(b);
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size * size * size *
+                            size);
+}
+
+static void BatchedMatmulEigen(benchmark::State& state,
+                               int64_t batch_size,
+                               int64_t size) {
+    Tensor a = RandomTensor({batch_size, size, size});
+    Tensor b = RandomTensor({batch_size, size, size});
+    const float* a_ptr = static_cast<const float*>(a.GetDataPtr());
+    const float* b_ptr = static_cast<const float*>(b.GetDataPtr());
+    std::vector<float> c(batch_size * size * size);
+    for (auto _ : state) {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Eigen::Map<const RowMajorMatrix<float>> a_map(
+                    a_ptr + i * size * size, size, size);
+            Eigen::Map<const RowMajorMatrix<float>> b_map(
+                    b_ptr + i * size * size, size, size);
+            Eigen::Map<RowMajorMatrix<float>> c_map(
+                    c.data() + i * size * size, size, size);
+            c_map.noalias() = a_map * b_map;
+        }
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size * size * size *
+                            size);
+}
+
+// Square products.
+BENCHMARK_CAPTURE(MatmulCPU, 64, 64, 64, 64)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(MatmulEigen, 64, 64, 64, 64)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(MatmulCPU, 256, 256, 256, 256)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(MatmulEigen, 256, 256, 256, 256)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(MatmulCPU, 1024, 1024, 1024, 1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MatmulEigen, 1024, 1024, 1024, 1024)
+        ->Unit(benchmark::kMillisecond);
+
+// Transforming a point cloud, (N, 3) @ (3, 3).
+BENCHMARK_CAPTURE(MatmulCPU, Points, 1 << 20, 3, 3)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MatmulEigen, Points, 1 << 20, 3, 3)
+        ->Unit(benchmark::kMillisecond);
+
+// Many small products, e.g. batches of 4x4 transformations.
+BENCHMARK_CAPTURE(BatchedMatmulCPU, 4x4, 1 << 16, 4)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchedMatmulEigen, 4x4, 1 << 16, 4)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchedMatmulCPU, 32x32, 1 << 10, 32)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchedMatmulEigen, 32x32, 1 << 10, 32)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
@@ -52,6 +52,66 @@ static void ReductionCPU(benchmark::State& state) {
 // https://github.com/google/benchmark/issues/498
 BENCHMARK(ReductionCPU)->Unit(benchmark::kMillisecond);
 
+enum class ReductionLayout {
+    Inner,  // (N, 3) reduced over dim 1: many short contiguous reductions.
+    Outer,  // (N, 3) reduced over dim 0: few outputs, strided reductions.
+    All,    // (N, 3) reduced to a scalar.
+};
+
+static void ReductionOpCPU(benchmark::State& state,
+                           Dtype dtype,
+                           kernel::ReductionOpCode op_code,
+                           ReductionLayout layout) {
+    Device device("CPU:0");
+    int64_t num_points = 1 << 22;
+    Tensor src = Tensor::Ones({num_points, 3}, dtype, device);
+    SizeVector dims = layout == ReductionLayout::Inner
+                              ? SizeVector({1})
+                              : layout == ReductionLayout::Outer
+                                        ? SizeVector({0})
+                                        : SizeVector({0, 1});
+    auto reduce = [&]() {
+        switch (op_code) {
+            case kernel::ReductionOpCode::Sum:
+                return src.Sum(dims);
+            case kernel::ReductionOpCode::Max:
+                return src.Max(dims);
+            case kernel::ReductionOpCode::ArgMax:
+                return src.ArgMax({dims[0]});
+            case kernel::ReductionOpCode::Mean:
+                return src.Mean(dims);
+            case kernel::ReductionOpCode::Var:
+                return src.Var(dims);
+            default:
+                utility::LogError("Unsupported op code.");
+                return Tensor();
+        }
+    };
+    Tensor warm_up = reduce();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = reduce();
+    }
+}
+
+#define REDUCTION_BENCHMARK(OP, DTYPE, LAYOUT)                                \
+    BENCHMARK_CAPTURE(ReductionOpCPU, OP##_##DTYPE##_##LAYOUT, Dtype::DTYPE, \
+                      kernel::ReductionOpCode::OP, ReductionLayout::LAYOUT)  \
+            ->Unit(benchmark::kMillisecond)
+
+REDUCTION_BENCHMARK(Sum, Float32, Inner);
+REDUCTION_BENCHMARK(Sum, Float32, Outer);
+REDUCTION_BENCHMARK(Sum, Float32, All);
+REDUCTION_BENCHMARK(Sum, Float64, Outer);
+REDUCTION_BENCHMARK(Sum, Int64, Outer);
+REDUCTION_BENCHMARK(Max, Float32, Inner);
+REDUCTION_BENCHMARK(Max, Float32, Outer);
+REDUCTION_BENCHMARK(ArgMax, Float32, Inner);
+REDUCTION_BENCHMARK(ArgMax, Float32, Outer);
+REDUCTION_BENCHMARK(Mean, Float32, Outer);
+REDUCTION_BENCHMARK(Var, Float32, Outer);
+REDUCTION_BENCHMARK(Var, Float64, All);
+
 #ifdef BUILD_CUDA_MODULE
 
 static void ReductionCUDA(benchmark::State& state) {
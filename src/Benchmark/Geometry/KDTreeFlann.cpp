@@ -24,9 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <fstream>
+
+#include "Open3D/Geometry/HashGridSearch.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeFlannDynamic.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
 #include "benchmark/benchmark.h"
 
 using namespace Eigen;
@@ -94,3 +103,232 @@ BENCHMARK(BM_TestKDTreeLine0)->Args({1 << 5, 1 << 10})->Args({1 << 9, 1 << 11});
 BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
+
+// Searches the 30 nearest neighbors of every point of a random cloud, either
+// one query at a time or with a single batch search.
+static void BM_KDTreeKNNAllPoints(benchmark::State& state, bool batch) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1 << 17);
+    for (auto& p : pc.points_) {
+        p = Vector3d::Random();
+    }
+    geometry::KDTreeFlann kdtree(pc);
+    Map<const MatrixXd> queries((const double*)pc.points_.data(), 3,
+                                pc.points_.size());
+    for (auto _ : state) {
+        if (batch) {
+            geometry::KDTreeSearchResult result;
+            kdtree.SearchKNNBatch(queries, 30, result);
+        } else {
+            utility::ParallelForEach(
+                    0, int64_t(pc.points_.size()), [&](int64_t i) {
+                        vector<int> indices;
+                        vector<double> distance2;
+                        kdtree.SearchKNN(pc.points_[i], 30, indices,
+                                         distance2);
+                    });
+        }
+    }
+}
+BENCHMARK_CAPTURE(BM_KDTreeKNNAllPoints, Single, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeKNNAllPoints, Batch, true)
+        ->Unit(benchmark::kMillisecond);
+
+enum class KDTreeType {
+    Double,               // KDTreeFlann, double copy of the points.
+    Float,                // KDTreeFlannFloat, float copy of the points.
+    FloatExternal,        // KDTreeFlannFloat over the caller's float buffer.
+    FloatExternalSorted,  // As FloatExternal, with points sorted by voxel.
+};
+
+// Resident set size of the process in bytes, or 0 where unavailable.
+static size_t GetResidentBytes() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0, resident = 0;
+    statm >> pages >> resident;
+    return resident * size_t(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+// Random points in double and float precision. Sorting the points by a
+// coarse voxel mimics the spatial coherence of scan-ordered data.
+struct KDTreeBenchmarkData {
+    KDTreeBenchmarkData(size_t size, bool sorted) {
+        pc_.points_.resize(size);
+        points_float_.resize(3 * size);
+        for (size_t i = 0; i < size; i++) {
+            pc_.points_[i] = Vector3d::Random();
+        }
+        if (sorted) {
+            auto voxel = [](const Vector3d& p) {
+                return Vector3i(((p.array() + 1.0) * 32.0).floor().cast<int>());
+            };
+            sort(pc_.points_.begin(), pc_.points_.end(),
+                 [&](const Vector3d& a, const Vector3d& b) {
+                     Vector3i va = voxel(a), vb = voxel(b);
+                     return lexicographical_compare(va.data(), va.data() + 3,
+                                                    vb.data(), vb.data() + 3);
+                 });
+        }
+        for (size_t i = 0; i < size; i++) {
+            for (int j = 0; j < 3; j++) {
+                points_float_[3 * i + j] = float(pc_.points_[i](j));
+            }
+        }
+    }
+    Map<const MatrixXf> FloatPoints() const {
+        return Map<const MatrixXf>(points_float_.data(), 3,
+                                   pc_.points_.size());
+    }
+
+    geometry::PointCloud pc_;
+    vector<float> points_float_;
+};
+
+// Builds the tree once per iteration. IndexMB is the growth of the resident
+// set while the first tree is built and alive.
+static void BM_KDTreeBuild(benchmark::State& state, KDTreeType type) {
+    KDTreeBenchmarkData data(1 << 20,
+                             type == KDTreeType::FloatExternalSorted);
+    double index_mb = 0.0;
+    for (auto _ : state) {
+        size_t rss_before = GetResidentBytes();
+        if (type == KDTreeType::Double) {
+            geometry::KDTreeFlann kdtree(data.pc_);
+            if (index_mb == 0.0) {
+                index_mb = (GetResidentBytes() - rss_before) / 1e6;
+            }
+        } else if (type == KDTreeType::Float) {
+            geometry::KDTreeFlannFloat kdtree(data.pc_);
+            if (index_mb == 0.0) {
+                index_mb = (GetResidentBytes() - rss_before) / 1e6;
+            }
+        } else {
+            geometry::KDTreeFlannFloat kdtree(data.FloatPoints());
+            if (index_mb == 0.0) {
+                index_mb = (GetResidentBytes() - rss_before) / 1e6;
+            }
+        }
+    }
+    state.counters["IndexMB"] = index_mb;
+}
+
+// Searches the 30 nearest neighbors of 65536 random points.
+static void BM_KDTreeQuery(benchmark::State& state, KDTreeType type) {
+    KDTreeBenchmarkData data(1 << 20,
+                             type == KDTreeType::FloatExternalSorted);
+    MatrixXd queries = MatrixXd::Random(3, 1 << 16);
+    geometry::KDTreeSearchResult result;
+    if (type == KDTreeType::Double) {
+        geometry::KDTreeFlann kdtree(data.pc_);
+        for (auto _ : state) {
+            kdtree.SearchKNNBatch(queries, 30, result);
+        }
+    } else if (type == KDTreeType::Float) {
+        geometry::KDTreeFlannFloat kdtree(data.pc_);
+        for (auto _ : state) {
+            kdtree.SearchKNNBatch(queries, 30, result);
+        }
+    } else {
+        geometry::KDTreeFlannFloat kdtree(data.FloatPoints());
+        for (auto _ : state) {
+            kdtree.SearchKNNBatch(queries, 30, result);
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(BM_KDTreeBuild, Double, KDTreeType::Double)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeBuild, Float, KDTreeType::Float)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeBuild, FloatExternal, KDTreeType::FloatExternal)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeQuery, Double, KDTreeType::Double)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeQuery, Float, KDTreeType::Float)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeQuery, FloatExternal, KDTreeType::FloatExternal)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeQuery,
+                  FloatExternalSorted,
+                  KDTreeType::FloatExternalSorted)
+        ->Unit(benchmark::kMillisecond);
+
+// Streams 50 frames of 10000 points into a map and searches the 10 nearest
+// neighbors of 1000 points of each new frame, either rebuilding a KDTreeFlann
+// per frame or updating a KDTreeFlannDynamic.
+static void BM_KDTreeStreaming(benchmark::State& state, bool dynamic) {
+    const int num_frames = 50;
+    const int frame_size = 10000;
+    vector<vector<Vector3d>> frames(num_frames);
+    for (int f = 0; f < num_frames; f++) {
+        frames[f].resize(frame_size);
+        for (auto& p : frames[f]) {
+            p = Vector3d::Random() + Vector3d(0.05 * f, 0.0, 0.0);
+        }
+    }
+    for (auto _ : state) {
+        geometry::PointCloud map;
+        geometry::KDTreeFlann kdtree;
+        geometry::KDTreeFlannDynamic kdtree_dynamic;
+        for (const auto& frame : frames) {
+            vector<int> indices;
+            vector<double> distance2;
+            if (dynamic) {
+                kdtree_dynamic.AddPoints(frame);
+                for (int i = 0; i < frame_size; i += 10) {
+                    kdtree_dynamic.SearchKNN(frame[i], 10, indices, distance2);
+                }
+            } else {
+                map.points_.insert(map.points_.end(), frame.begin(),
+                                   frame.end());
+                kdtree.SetGeometry(map);
+                for (int i = 0; i < frame_size; i += 10) {
+                    kdtree.SearchKNN(frame[i], 10, indices, distance2);
+                }
+            }
+        }
+    }
+}
+BENCHMARK_CAPTURE(BM_KDTreeStreaming, Rebuild, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KDTreeStreaming, Dynamic, true)
+        ->Unit(benchmark::kMillisecond);
+
+// Builds an index over a uniform random cloud and searches the neighbors of
+// every point within a radius holding about 35 points, with either a
+// KDTreeFlann or a HashGridSearch.
+static void BM_RadiusSearchAllPoints(benchmark::State& state,
+                                     geometry::NeighborSearchBackend backend) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1 << 17);
+    for (auto& p : pc.points_) {
+        p = Vector3d::Random();
+    }
+    const double radius = 0.08;
+    Map<const MatrixXd> queries((const double*)pc.points_.data(), 3,
+                                pc.points_.size());
+    geometry::KDTreeSearchParamRadius param(radius);
+    for (auto _ : state) {
+        geometry::KDTreeSearchResult result;
+        if (backend == geometry::NeighborSearchBackend::HashGrid) {
+            geometry::HashGridSearch grid(pc.points_, radius);
+            grid.SearchBatch(queries, param, result);
+        } else {
+            geometry::KDTreeFlann kdtree(pc);
+            kdtree.SearchBatch(queries, param, result);
+        }
+    }
+}
+BENCHMARK_CAPTURE(BM_RadiusSearchAllPoints,
+                  KDTree,
+                  geometry::NeighborSearchBackend::KDTree)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RadiusSearchAllPoints,
+                  HashGrid,
+                  geometry::NeighborSearchBackend::HashGrid)
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,59 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/LinearOctree.h"
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+#include "benchmark/benchmark.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+
+// Builds an octree of depth 10 over 2^20 uniform random colored points.
+static void BM_OctreeFromPointCloud(benchmark::State& state, bool linear) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1 << 20);
+    pc.colors_.resize(1 << 20);
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        pc.points_[i] = Vector3d::Random();
+        pc.colors_[i] = (pc.points_[i] + Vector3d::Ones()) / 2.0;
+    }
+    for (auto _ : state) {
+        if (linear) {
+            geometry::LinearOctree::CreateFromPointCloud(pc, 10);
+        } else {
+            geometry::Octree octree(10);
+            octree.ConvertFromPointCloud(pc);
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(BM_OctreeFromPointCloud, Octree, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_OctreeFromPointCloud, LinearOctree, true)
+        ->Unit(benchmark::kMillisecond);
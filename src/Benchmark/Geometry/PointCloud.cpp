@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+
+#include <unordered_map>
+
+#include "Open3D/Utility/Helper.h"
+#include "benchmark/benchmark.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+
+// Centroid voxel downsampling accumulated in a hash map, one point at a time.
+static shared_ptr<geometry::PointCloud> VoxelDownSampleHashMap(
+        const geometry::PointCloud& pc, double voxel_size) {
+    Vector3d voxel_min_bound =
+            pc.GetMinBound() - Vector3d::Constant(voxel_size * 0.5);
+    unordered_map<Vector3i, pair<int, Vector3d>,
+                  utility::hash_eigen::hash<Vector3i>>
+            voxels;
+    for (const Vector3d& point : pc.points_) {
+        Vector3d ref_coord = (point - voxel_min_bound) / voxel_size;
+        Vector3i voxel_index(int(floor(ref_coord(0))),
+                             int(floor(ref_coord(1))),
+                             int(floor(ref_coord(2))));
+        auto& voxel = voxels[voxel_index];
+        if (voxel.first == 0) {
+            voxel.second.setZero();
+        }
+        voxel.first++;
+        voxel.second += point;
+    }
+    auto output = make_shared<geometry::PointCloud>();
+    for (const auto& voxel : voxels) {
+        output->points_.push_back(voxel.second.second /
+                                  double(voxel.second.first));
+    }
+    return output;
+}
+
+// Downsamples 2^22 uniform random points into about 2^18 voxels.
+static void BM_VoxelDownSample(benchmark::State& state, bool hash_map) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1 << 22);
+    for (auto& p : pc.points_) {
+        p = Vector3d::Random();
+    }
+    const double voxel_size = 2.0 / 64.0;
+    for (auto _ : state) {
+        if (hash_map) {
+            VoxelDownSampleHashMap(pc, voxel_size);
+        } else {
+            pc.VoxelDownSample(voxel_size);
+        }
+    }
+}
+BENCHMARK_CAPTURE(BM_VoxelDownSample, HashMap, true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_VoxelDownSample, RadixSort, false)
+        ->Unit(benchmark::kMillisecond);
+
+// Clusters 2^18 uniform random points with about 16 points per neighborhood.
+static void BM_ClusterDBSCAN(benchmark::State& state,
+                             geometry::NeighborSearchBackend backend) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1 << 18);
+    for (auto& p : pc.points_) {
+        p = Vector3d::Random();
+    }
+    for (auto _ : state) {
+        pc.ClusterDBSCAN(0.05, 10, false, backend);
+    }
+}
+BENCHMARK_CAPTURE(BM_ClusterDBSCAN, KDTree,
+                  geometry::NeighborSearchBackend::KDTree)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ClusterDBSCAN, HashGrid,
+                  geometry::NeighborSearchBackend::HashGrid)
+        ->Unit(benchmark::kMillisecond);
+
+// Fits a plane holding half of 2^20 points, with all iterations run
+// (probability 1) or stopped once the best plane is likely found.
+static void BM_SegmentPlane(benchmark::State& state, double probability) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1 << 20);
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        pc.points_[i] = Vector3d::Random();
+        if (i % 2 == 0) {
+            pc.points_[i](2) = 0.0;
+        }
+    }
+    for (auto _ : state) {
+        pc.SegmentPlane(0.01, 3, 1000, probability, 0);
+    }
+}
+BENCHMARK_CAPTURE(BM_SegmentPlane, AllIterations, 1.0)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_SegmentPlane, Adaptive, 0.99999999)
+        ->Unit(benchmark::kMillisecond);
+
+// Estimates normals of 2^18 uniform random points from 30 nearest neighbors.
+static void BM_EstimateNormals(benchmark::State& state) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1 << 18);
+    for (auto& p : pc.points_) {
+        p = Vector3d::Random();
+    }
+    for (auto _ : state) {
+        pc.normals_.clear();
+        pc.EstimateNormals(geometry::KDTreeSearchParamKNN(30));
+    }
+}
+BENCHMARK(BM_EstimateNormals)->Unit(benchmark::kMillisecond);
+
+// Estimates normals of a 640 x 480 depth map of a tilted plane from 5 x 5
+// pixel windows, or from 25 nearest neighbors in a KDTree.
+static void BM_EstimateNormalsOrganized(benchmark::State& state,
+                                        bool organized) {
+    const int width = 640;
+    const int height = 480;
+    geometry::PointCloud pc;
+    pc.points_.reserve(width * height);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            double z = 1.0 + 0.001 * u;
+            pc.points_.emplace_back((u - 319.5) * z / 525.0,
+                                    (v - 239.5) * z / 525.0, z);
+        }
+    }
+    for (auto _ : state) {
+        pc.normals_.clear();
+        if (organized) {
+            pc.EstimateNormalsOrganized(width, height, 2);
+        } else {
+            pc.EstimateNormals(geometry::KDTreeSearchParamKNN(25));
+        }
+    }
+}
+BENCHMARK_CAPTURE(BM_EstimateNormalsOrganized, KDTree, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EstimateNormalsOrganized, ImageGrid, true)
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+#include <random>
+
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+static Eigen::Matrix4d RandomMotion(std::mt19937& rng,
+                                    double rotation,
+                                    double translation) {
+    std::normal_distribution<double> normal(0.0, 1.0);
+    Eigen::Vector6d motion;
+    for (int i = 0; i < 6; i++) {
+        motion(i) = normal(rng) * (i < 3 ? rotation : translation);
+    }
+    return utility::TransformVector6dToMatrix4d(motion);
+}
+
+// Random walk of n nodes with odometry edges, two loop closures per node to
+// nodes up to 20 steps ahead, 10% of which are outliers, and noisy initial
+// poses.
+static registration::PoseGraph CreatePoseGraph(int n_nodes) {
+    std::mt19937 rng(0);
+    std::vector<Eigen::Matrix4d> poses(1, Eigen::Matrix4d::Identity());
+    for (int i = 1; i < n_nodes; i++) {
+        poses.push_back(poses.back() * RandomMotion(rng, 0.05, 0.3));
+    }
+    registration::PoseGraph pose_graph;
+    pose_graph.nodes_.emplace_back(poses[0]);
+    for (int i = 1; i < n_nodes; i++) {
+        pose_graph.nodes_.emplace_back(poses[i] *
+                                       RandomMotion(rng, 0.02, 0.05));
+    }
+    const Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 100.0;
+    for (int i = 0; i + 1 < n_nodes; i++) {
+        pose_graph.edges_.emplace_back(i, i + 1,
+                                       poses[i + 1].inverse() * poses[i] *
+                                               RandomMotion(rng, 0.002, 0.005),
+                                       information, false);
+    }
+    std::uniform_int_distribution<int> offset(2, 20);
+    for (int k = 0; k < 2 * n_nodes; k++) {
+        int source = k / 2;
+        int target = std::min(n_nodes - 1, source + offset(rng));
+        if (target <= source + 1) {
+            continue;
+        }
+        Eigen::Matrix4d noise = k % 10 == 0 ? RandomMotion(rng, 0.3, 1.0)
+                                            : RandomMotion(rng, 0.002, 0.005);
+        pose_graph.edges_.emplace_back(
+                source, target,
+                poses[target].inverse() * poses[source] * noise, information,
+                true);
+    }
+    return pose_graph;
+}
+
+static void BM_GlobalOptimization(benchmark::State& state) {
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Error);
+    const registration::PoseGraph pose_graph =
+            CreatePoseGraph(int(state.range(0)));
+    for (auto _ : state) {
+        registration::PoseGraph result = pose_graph;
+        registration::GlobalOptimization(
+                result, registration::GlobalOptimizationLevenbergMarquardt());
+    }
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Info);
+}
+
+BENCHMARK(BM_GlobalOptimization)
+        ->Arg(100)
+        ->Arg(300)
+        ->Arg(1000)
+        ->Arg(3000)
+        ->Unit(benchmark::kMillisecond);
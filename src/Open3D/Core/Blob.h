@@ -28,10 +28,12 @@
 
 #include <cstddef>
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include "Open3D/Core/Device.h"
 #include "Open3D/Core/MemoryManager.h"
+#include "Open3D/Utility/MappedFile.h"
 
 namespace open3d {
 
@@ -48,6 +50,10 @@ namespace open3d {
 /// address. The only responsibility for Blob is to hold the beginning
 /// memory address and it's up to the user to access any addresses around it.
 ///
+/// A Blob can also be backed by a memory-mapped file on the CPU. The file
+/// stays mapped for the lifetime of the Blob and its pages are read from disk
+/// on first access.
+///
 /// In summary:
 /// - A Blob does not know about its memory size after construction.
 /// - A Blob cannot be deep-copied. However, the Tensor which owns the blob can
@@ -75,7 +81,22 @@ public:
          const std::function<void(void*)>& deleter)
         : deleter_(deleter), data_ptr_(data_ptr), device_(device) {}
 
+    /// Construct a CPU Blob backed by a memory-mapped file.
+    ///
+    /// \param mapped_file The mapping, which is kept alive by the Blob.
+    /// \param data_ptr Pointer to the blob's beginning inside \p mapped_file.
+    Blob(const std::shared_ptr<utility::MappedFile>& mapped_file,
+         void* data_ptr)
+        : deleter_(nullptr),
+          data_ptr_(data_ptr),
+          device_("CPU:0"),
+          mapped_file_(mapped_file) {}
+
     ~Blob() {
+        if (mapped_file_) {
+            // The mapping is released with the last reference to it.
+            return;
+        }
         if (deleter_) {
             // Our custom deleter's void* argument is not used. The deleter
             // function itself shall handle destruction without the argument.
@@ -93,6 +114,16 @@ public:
 
     const void* GetDataPtr() const { return data_ptr_; }
 
+    /// Returns the deleter of externally managed memory, or nullptr if the
+    /// memory is managed by MemoryManager.
+    const std::function<void(void*)>& GetDeleter() const { return deleter_; }
+
+    /// Returns the file mapping backing this Blob, or nullptr if the Blob is
+    /// not memory-mapped.
+    const std::shared_ptr<utility::MappedFile>& GetMappedFile() const {
+        return mapped_file_;
+    }
+
 protected:
     /// For externally managed memory, deleter != nullptr.
     std::function<void(void*)> deleter_ = nullptr;
@@ -102,6 +133,9 @@ protected:
 
     /// Device context for the blob.
     Device device_;
+
+    /// For memory-mapped blobs, mapped_file_ != nullptr.
+    std::shared_ptr<utility::MappedFile> mapped_file_ = nullptr;
 };
 
 }  // namespace open3d
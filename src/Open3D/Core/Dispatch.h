@@ -49,6 +49,10 @@
 #define DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, ...)               \
     [&] {                                                    \
         switch (DTYPE) {                                     \
+            case open3d::Dtype::Float16: {                   \
+                using scalar_t = open3d::Half;               \
+                return __VA_ARGS__();                        \
+            }                                                \
             case open3d::Dtype::Float32: {                   \
                 using scalar_t = float;                      \
                 return __VA_ARGS__();                        \
@@ -57,6 +61,10 @@
                 using scalar_t = double;                     \
                 return __VA_ARGS__();                        \
             }                                                \
+            case open3d::Dtype::Int16: {                     \
+                using scalar_t = int16_t;                    \
+                return __VA_ARGS__();                        \
+            }                                                \
             case open3d::Dtype::Int32: {                     \
                 using scalar_t = int32_t;                    \
                 return __VA_ARGS__();                        \
@@ -69,6 +77,10 @@
                 using scalar_t = uint8_t;                    \
                 return __VA_ARGS__();                        \
             }                                                \
+            case open3d::Dtype::UInt16: {                    \
+                using scalar_t = uint16_t;                   \
+                return __VA_ARGS__();                        \
+            }                                                \
             default:                                         \
                 utility::LogError("Unsupported data type."); \
         }                                                    \
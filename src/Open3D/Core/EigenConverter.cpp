@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/EigenConverter.h"
+
+#include "Open3D/Core/Blob.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/MemoryManager.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace eigen_converter {
+
+/// Blob deleter owning a std::vector that was moved into a Tensor. The vector
+/// is held by a shared_ptr since std::function requires copyable targets.
+template <typename T>
+struct EigenVectorOwner {
+    std::shared_ptr<std::vector<T>> vec_;
+
+    void operator()(void*) { vec_.reset(); }
+};
+
+template <typename T>
+static Tensor EigenVectorAsTensor(std::vector<T>& vec,
+                                  const std::shared_ptr<void>& owner) {
+    static_assert(sizeof(T) == 3 * sizeof(typename T::Scalar),
+                  "Eigen vectors must be tightly packed.");
+    int64_t num_vectors = static_cast<int64_t>(vec.size());
+    // The deleter only holds a reference to the owner, the memory is managed
+    // by vec.
+    auto blob = std::make_shared<Blob>(Device("CPU:0"), vec.data(),
+                                       [owner](void*) {});
+    return Tensor({num_vectors, 3}, {3, 1}, vec.data(),
+                  DtypeUtil::FromType<typename T::Scalar>(), blob);
+}
+
+template <typename T>
+static Tensor EigenVectorToTensor(std::vector<T>&& vec) {
+    static_assert(sizeof(T) == 3 * sizeof(typename T::Scalar),
+                  "Eigen vectors must be tightly packed.");
+    auto owned_vec = std::make_shared<std::vector<T>>(std::move(vec));
+    int64_t num_vectors = static_cast<int64_t>(owned_vec->size());
+    void* data_ptr = owned_vec->data();
+    auto blob = std::make_shared<Blob>(Device("CPU:0"), data_ptr,
+                                       EigenVectorOwner<T>{owned_vec});
+    return Tensor({num_vectors, 3}, {3, 1}, data_ptr,
+                  DtypeUtil::FromType<typename T::Scalar>(), blob);
+}
+
+template <typename T>
+static std::vector<T> TensorToEigenVectorCopy(const Tensor& tensor) {
+    if (tensor.NumDims() != 2 || tensor.GetShape(1) != 3) {
+        utility::LogError("Expected Tensor of shape {{N, 3}}, but got {}.",
+                          tensor.GetShape());
+    }
+    Tensor src = tensor.To(DtypeUtil::FromType<typename T::Scalar>())
+                         .Copy(Device("CPU:0"));
+    std::vector<T> vec(src.GetShape(0));
+    if (!vec.empty()) {
+        MemoryManager::MemcpyToHost(vec.data(), src.GetDataPtr(),
+                                    src.GetDevice(),
+                                    vec.size() * sizeof(T));
+    }
+    return vec;
+}
+
+template <typename T>
+static std::vector<T> TensorToEigenVectorMove(Tensor&& tensor) {
+    std::shared_ptr<Blob> blob = tensor.GetBlob();
+    const EigenVectorOwner<T>* vec_owner =
+            blob ? blob->GetDeleter().target<EigenVectorOwner<T>>() : nullptr;
+    if (vec_owner && vec_owner->vec_ &&
+        tensor.GetDataPtr() == vec_owner->vec_->data() &&
+        tensor.GetShape() ==
+                SizeVector({static_cast<int64_t>(vec_owner->vec_->size()),
+                            3}) &&
+        tensor.IsContiguous() &&
+        tensor.GetDtype() == DtypeUtil::FromType<typename T::Scalar>() &&
+        blob.use_count() == 2) {
+        // The vector is only referenced by tensor and the local blob, so no
+        // other Tensor can observe it being moved out.
+        tensor = Tensor();
+        return std::move(*vec_owner->vec_);
+    }
+    return TensorToEigenVectorCopy<T>(tensor);
+}
+
+Tensor EigenVector3dVectorAsTensor(std::vector<Eigen::Vector3d>& vec,
+                                   const std::shared_ptr<void>& owner) {
+    return EigenVectorAsTensor(vec, owner);
+}
+
+Tensor EigenVector3iVectorAsTensor(std::vector<Eigen::Vector3i>& vec,
+                                   const std::shared_ptr<void>& owner) {
+    return EigenVectorAsTensor(vec, owner);
+}
+
+Tensor EigenVector3dVectorToTensor(std::vector<Eigen::Vector3d>&& vec) {
+    return EigenVectorToTensor(std::move(vec));
+}
+
+Tensor EigenVector3iVectorToTensor(std::vector<Eigen::Vector3i>&& vec) {
+    return EigenVectorToTensor(std::move(vec));
+}
+
+std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(Tensor&& tensor) {
+    return TensorToEigenVectorMove<Eigen::Vector3d>(std::move(tensor));
+}
+
+std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(
+        const Tensor& tensor) {
+    return TensorToEigenVectorCopy<Eigen::Vector3d>(tensor);
+}
+
+std::vector<Eigen::Vector3i> TensorToEigenVector3iVector(Tensor&& tensor) {
+    return TensorToEigenVectorMove<Eigen::Vector3i>(std::move(tensor));
+}
+
+std::vector<Eigen::Vector3i> TensorToEigenVector3iVector(
+        const Tensor& tensor) {
+    return TensorToEigenVectorCopy<Eigen::Vector3i>(tensor);
+}
+
+}  // namespace eigen_converter
+}  // namespace open3d
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace eigen_converter {
+
+/// \brief Returns a {N, 3} Float64 Tensor sharing memory with \p vec.
+///
+/// No data is copied, writes through the Tensor are visible in \p vec and vice
+/// versa. This is meant for the storage of legacy geometries, e.g. the
+/// points_, normals_ and colors_ of geometry::PointCloud or the vertices_ of
+/// geometry::TriangleMesh.
+///
+/// The Tensor is invalidated when \p vec is resized or destroyed. Pass the
+/// object owning \p vec as \p owner, e.g. the
+/// std::shared_ptr<geometry::PointCloud>, to keep it alive as long as the
+/// Tensor or any view of it.
+Tensor EigenVector3dVectorAsTensor(
+        std::vector<Eigen::Vector3d>& vec,
+        const std::shared_ptr<void>& owner = nullptr);
+
+/// Same as EigenVector3dVectorAsTensor(), for Eigen::Vector3i storage such as
+/// geometry::TriangleMesh::triangles_. Returns an Int32 Tensor.
+Tensor EigenVector3iVectorAsTensor(
+        std::vector<Eigen::Vector3i>& vec,
+        const std::shared_ptr<void>& owner = nullptr);
+
+/// \brief Moves \p vec into a {N, 3} Float64 Tensor without copying.
+///
+/// The Tensor takes ownership of the data, which can be moved back with
+/// TensorToEigenVector3dVector(std::move(tensor)).
+Tensor EigenVector3dVectorToTensor(std::vector<Eigen::Vector3d>&& vec);
+
+/// Same as EigenVector3dVectorToTensor(), for Eigen::Vector3i. Returns an
+/// Int32 Tensor.
+Tensor EigenVector3iVectorToTensor(std::vector<Eigen::Vector3i>&& vec);
+
+/// \brief Converts a {N, 3} Tensor to a vector of Eigen::Vector3d.
+///
+/// If \p tensor holds the only reference to a vector moved in by
+/// EigenVector3dVectorToTensor() and spans all of it, the vector is moved out
+/// without copying and \p tensor is reset. Otherwise the data is copied,
+/// converted to Float64 and transferred to the CPU as needed.
+std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(Tensor&& tensor);
+
+/// Copies a {N, 3} Tensor to a vector of Eigen::Vector3d.
+std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(const Tensor& tensor);
+
+/// Same as TensorToEigenVector3dVector(Tensor&&), for Eigen::Vector3i and
+/// EigenVector3iVectorToTensor().
+std::vector<Eigen::Vector3i> TensorToEigenVector3iVector(Tensor&& tensor);
+
+/// Copies a {N, 3} Tensor to a vector of Eigen::Vector3i.
+std::vector<Eigen::Vector3i> TensorToEigenVector3iVector(const Tensor& tensor);
+
+}  // namespace eigen_converter
+}  // namespace open3d
@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+namespace open3d {
+
+/// \class Half
+///
+/// \brief IEEE 754 binary16 storage type for Dtype::Float16.
+///
+/// Half is a storage-only type: it converts implicitly to and from float, so
+/// all arithmetic, comparisons and math functions are evaluated in float and
+/// rounded back (round-to-nearest-even) on assignment. The conversions are
+/// implemented in software so that they work in both host and device code;
+/// bulk Float16 <-> Float32 copies on the CPU use F16C when available.
+struct Half {
+    struct FromBitsTag {};
+
+    Half() = default;
+    OPEN3D_HOST_DEVICE Half(float value) : bits_(FloatToBits(value)) {}
+    OPEN3D_HOST_DEVICE constexpr Half(uint16_t bits, FromBitsTag)
+        : bits_(bits) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return BitsToFloat(bits_); }
+
+    OPEN3D_HOST_DEVICE Half operator-() const {
+        return Half(static_cast<uint16_t>(bits_ ^ 0x8000), FromBitsTag());
+    }
+    OPEN3D_HOST_DEVICE Half& operator+=(float rhs) {
+        return *this = Half(float(*this) + rhs);
+    }
+    OPEN3D_HOST_DEVICE Half& operator-=(float rhs) {
+        return *this = Half(float(*this) - rhs);
+    }
+    OPEN3D_HOST_DEVICE Half& operator*=(float rhs) {
+        return *this = Half(float(*this) * rhs);
+    }
+    OPEN3D_HOST_DEVICE Half& operator/=(float rhs) {
+        return *this = Half(float(*this) / rhs);
+    }
+
+    static constexpr OPEN3D_HOST_DEVICE Half FromBits(uint16_t bits) {
+        return Half(bits, FromBitsTag());
+    }
+
+    /// Converts \p value to binary16 bits with round-to-nearest-even.
+    /// Overflow yields infinity and NaN payloads are kept quiet.
+    static OPEN3D_HOST_DEVICE uint16_t FloatToBits(float value) {
+        uint32_t x;
+        std::memcpy(&x, &value, sizeof(x));
+        const uint16_t sign = static_cast<uint16_t>((x >> 16) & 0x8000);
+        const uint32_t abs = x & 0x7FFFFFFF;
+        if (abs >= 0x7F800000) {  // Inf or NaN.
+            return sign | 0x7C00 |
+                   (abs > 0x7F800000 ? 0x0200 | ((abs >> 13) & 0x03FF) : 0);
+        }
+        if (abs >= 0x477FF000) {  // Rounds to a magnitude >= 65520.
+            return sign | 0x7C00;
+        }
+        uint32_t bits;
+        uint32_t rem;
+        uint32_t half_ulp;
+        if (abs >= 0x38800000) {  // Normal: rebias the exponent by 127 - 15.
+            bits = (abs - 0x38000000) >> 13;
+            rem = abs & 0x1FFF;
+            half_ulp = 0x1000;
+        } else if (abs >= 0x33000000) {  // Subnormal in binary16.
+            const uint32_t mantissa = (abs & 0x7FFFFF) | 0x800000;
+            const uint32_t shift = 126 - (abs >> 23);
+            bits = mantissa >> shift;
+            rem = mantissa & ((1u << shift) - 1);
+            half_ulp = 1u << (shift - 1);
+        } else {  // Underflows to zero.
+            return sign;
+        }
+        // A carry out of the mantissa correctly bumps the exponent.
+        if (rem > half_ulp || (rem == half_ulp && (bits & 1))) {
+            ++bits;
+        }
+        return sign | static_cast<uint16_t>(bits);
+    }
+
+    /// Converts binary16 \p bits to float. The conversion is exact.
+    static OPEN3D_HOST_DEVICE float BitsToFloat(uint16_t bits) {
+        const uint32_t sign = static_cast<uint32_t>(bits & 0x8000) << 16;
+        const uint32_t exponent = (bits >> 10) & 0x1F;
+        uint32_t mantissa = bits & 0x03FF;
+        uint32_t x;
+        if (exponent == 0x1F) {  // Inf or NaN.
+            x = sign | 0x7F800000 | (mantissa << 13);
+        } else if (exponent != 0) {
+            x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        } else if (mantissa == 0) {
+            x = sign;
+        } else {  // Subnormal: normalize into a float exponent.
+            uint32_t float_exponent = 113;
+            while ((mantissa & 0x0400) == 0) {
+                mantissa <<= 1;
+                --float_exponent;
+            }
+            x = sign | (float_exponent << 23) | ((mantissa & 0x03FF) << 13);
+        }
+        float value;
+        std::memcpy(&value, &x, sizeof(value));
+        return value;
+    }
+
+    uint16_t bits_;
+};
+
+static_assert(sizeof(Half) == 2, "Half must be 2 bytes");
+
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::Half> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int max_exponent = 16;
+    static constexpr int min_exponent = -13;
+
+    static constexpr open3d::Half min() noexcept {
+        return open3d::Half::FromBits(0x0400);
+    }
+    static constexpr open3d::Half max() noexcept {
+        return open3d::Half::FromBits(0x7BFF);
+    }
+    static constexpr open3d::Half lowest() noexcept {
+        return open3d::Half::FromBits(0xFBFF);
+    }
+    static constexpr open3d::Half epsilon() noexcept {
+        return open3d::Half::FromBits(0x1400);
+    }
+    static constexpr open3d::Half infinity() noexcept {
+        return open3d::Half::FromBits(0x7C00);
+    }
+    static constexpr open3d::Half quiet_NaN() noexcept {
+        return open3d::Half::FromBits(0x7E00);
+    }
+    static constexpr open3d::Half signaling_NaN() noexcept {
+        return open3d::Half::FromBits(0x7D00);
+    }
+};
+
+}  // namespace std
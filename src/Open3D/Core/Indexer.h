@@ -33,6 +33,7 @@
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace open3d {
@@ -297,6 +298,12 @@ public:
     /// Number of input Tensors.
     int64_t NumInputs() const { return num_inputs_; }
 
+    /// Returns the element stride of \p tr along the flattened workload index:
+    /// 1 if \p tr is contiguous w.r.t. the master shape, 0 if all workloads
+    /// map to the same element (e.g. a broadcasted scalar), or -1 otherwise.
+    /// Kernels use this to skip per-element offset computation.
+    int64_t GetFlatElementStride(const TensorRef& tr) const;
+
     /// Returns input TensorRef.
     TensorRef& GetInput(int64_t i) {
         if (i >= num_inputs_ || i < 0) {
@@ -486,6 +493,121 @@ protected:
     bool accumulate_ = false;
 };
 
+/// Walks a contiguous range of workloads of an Indexer and updates the data
+/// pointers of NARGS operands incrementally. Stepping to the next workload
+/// adds the innermost byte strides and only carries into the outer dimensions
+/// at the end of a row. This avoids the per-workload division and modulo of
+/// Indexer::GetInputPtr(). The division is done once, in the constructor.
+///
+/// \p NDIMS fixes Indexer::NumDims() at compile time so that the stride
+/// arithmetic is unrolled. NDIMS == 0 reads the number of dimensions at
+/// runtime. This walker is host-only.
+template <int NARGS, int NDIMS = 0>
+class IndexerWalker {
+public:
+    /// \param indexer The Indexer to walk.
+    /// \param refs The operands, e.g. {&indexer.GetInput(0),
+    /// &indexer.GetOutput()}. Their byte strides must follow the Indexer's
+    /// master shape, which holds for all inputs and outputs of \p indexer.
+    /// \param start The first workload index.
+    IndexerWalker(const Indexer& indexer,
+                  const TensorRef* const (&refs)[NARGS],
+                  int64_t start)
+        : ndims_(indexer.NumDims()) {
+        if (NDIMS > 0 && ndims_ != NDIMS) {
+            utility::LogError("Internal error: walker expects {} dims, got {}.",
+                              NDIMS, ndims_);
+        }
+        const int64_t* master_shape = indexer.GetMasterShape();
+        const int64_t* master_strides = indexer.GetMasterStrides();
+        for (int arg = 0; arg < NARGS; ++arg) {
+            ptrs_[arg] = static_cast<char*>(refs[arg]->data_ptr_);
+        }
+        for (int64_t dim = 0; dim < NumDims(); ++dim) {
+            shape_[dim] = master_shape[dim];
+            counter_[dim] = start / master_strides[dim];
+            start = start % master_strides[dim];
+            for (int arg = 0; arg < NARGS; ++arg) {
+                byte_strides_[dim][arg] = refs[arg]->byte_strides_[dim];
+                ptrs_[arg] += counter_[dim] * byte_strides_[dim][arg];
+            }
+        }
+    }
+
+    /// Calls \p func(ptrs) for the next \p n workloads, where ptrs[arg] is the
+    /// data pointer of the arg-th operand, and advances past them.
+    template <typename func_t>
+    void Walk(int64_t n, func_t func) {
+        if (NDIMS == 0 && ndims_ == 0) {
+            // A 0-d Indexer has exactly one workload.
+            for (; n > 0; --n) {
+                func(ptrs_);
+            }
+            return;
+        }
+        const int64_t inner = NumDims() - 1;
+        int64_t inner_strides[NARGS];
+        for (int arg = 0; arg < NARGS; ++arg) {
+            inner_strides[arg] = byte_strides_[inner][arg];
+        }
+        while (n > 0) {
+            int64_t count = std::min(n, shape_[inner] - counter_[inner]);
+            char* ptrs[NARGS];
+            for (int arg = 0; arg < NARGS; ++arg) {
+                ptrs[arg] = ptrs_[arg];
+            }
+            for (int64_t k = 0; k < count; ++k) {
+                func(ptrs);
+                for (int arg = 0; arg < NARGS; ++arg) {
+                    ptrs[arg] += inner_strides[arg];
+                }
+            }
+            for (int arg = 0; arg < NARGS; ++arg) {
+                ptrs_[arg] = ptrs[arg];
+            }
+            counter_[inner] += count;
+            n -= count;
+            if (counter_[inner] == shape_[inner]) {
+                Carry();
+            }
+        }
+    }
+
+    /// Returns the data pointers of the operands at the current workload.
+    char* const* GetPtrs() const { return ptrs_; }
+
+protected:
+    int64_t NumDims() const { return NDIMS > 0 ? NDIMS : ndims_; }
+
+    /// Rewinds every dimension that reached its end and advances the next
+    /// outer dimension.
+    void Carry() {
+        for (int64_t dim = NumDims() - 1; dim >= 0; --dim) {
+            if (counter_[dim] < shape_[dim]) {
+                return;
+            }
+            counter_[dim] = 0;
+            for (int arg = 0; arg < NARGS; ++arg) {
+                ptrs_[arg] -= shape_[dim] * byte_strides_[dim][arg];
+            }
+            if (dim > 0) {
+                counter_[dim - 1]++;
+                for (int arg = 0; arg < NARGS; ++arg) {
+                    ptrs_[arg] += byte_strides_[dim - 1][arg];
+                }
+            }
+        }
+    }
+
+    static constexpr int64_t kCapacity = NDIMS > 0 ? NDIMS : MAX_DIMS;
+
+    int64_t ndims_;
+    char* ptrs_[NARGS];
+    int64_t shape_[kCapacity];
+    int64_t counter_[kCapacity];
+    int64_t byte_strides_[kCapacity][NARGS];
+};
+
 class IndexerIterator {
 public:
     struct Iterator {
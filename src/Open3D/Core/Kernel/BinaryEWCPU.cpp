@@ -202,23 +202,32 @@ void BinaryEWCPU(const Tensor& lhs,
 
         });
     } else {
+        // SIMD kernel for contiguous operands, nullptr if not vectorized.
+        BinaryEWVecKernel vec_kernel =
+                src_dtype == dst_dtype
+                        ? GetBinaryEWVecKernel(op_code, src_dtype)
+                        : nullptr;
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
                     CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUAddElementKernel<scalar_t>);
+                            indexer, CPUAddElementKernel<scalar_t>,
+                            vec_kernel);
                     break;
                 case BinaryEWOpCode::Sub:
                     CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUSubElementKernel<scalar_t>);
+                            indexer, CPUSubElementKernel<scalar_t>,
+                            vec_kernel);
                     break;
                 case BinaryEWOpCode::Mul:
                     CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUMulElementKernel<scalar_t>);
+                            indexer, CPUMulElementKernel<scalar_t>,
+                            vec_kernel);
                     break;
                 case BinaryEWOpCode::Div:
                     CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUDivElementKernel<scalar_t>);
+                            indexer, CPUDivElementKernel<scalar_t>,
+                            vec_kernel);
                     break;
                 default:
                     break;
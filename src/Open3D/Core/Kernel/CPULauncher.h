@@ -26,68 +26,184 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
 #include "Open3D/Core/AdvancedIndexing.h"
 #include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Kernel/CPUVectorized.h"
 #include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace kernel {
 
 class CPULauncher {
 public:
+    /// Launches \p element_kernel(src_ptr, dst_ptr) for every workload.
+    ///
+    /// If the output is contiguous and the input is contiguous or a broadcasted
+    /// scalar, the per-element offset computation is skipped. In that case,
+    /// \p vec_kernel (if not nullptr) processes whole ranges with SIMD
+    /// instructions instead. \p vec_kernel performs any conversion between
+    /// the input and output dtypes itself, e.g. the Float16 <-> Float32
+    /// kernels of GetCopyVecKernel().
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
-                                    func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+                                    func_t element_kernel,
+                                    UnaryEWVecKernel vec_kernel = nullptr) {
+        const TensorRef& src = indexer.GetInput(0);
+        const TensorRef& dst = indexer.GetOutput();
+        const int64_t src_stride = indexer.GetFlatElementStride(src);
+        if (src_stride >= 0 && indexer.GetFlatElementStride(dst) == 1) {
+            const char* src_ptr = static_cast<const char*>(src.data_ptr_);
+            char* dst_ptr = static_cast<char*>(dst.data_ptr_);
+            const int64_t src_byte_stride = src_stride * src.dtype_byte_size_;
+            const int64_t dst_byte_stride = dst.dtype_byte_size_;
+            LaunchRangeKernel(
+                    indexer.NumWorkloads(), [&](int64_t start, int64_t end) {
+                        if (vec_kernel != nullptr) {
+                            vec_kernel(src_ptr + start * src_byte_stride,
+                                       src_stride,
+                                       dst_ptr + start * dst_byte_stride,
+                                       end - start);
+                            return;
+                        }
+                        for (int64_t i = start; i < end; ++i) {
+                            element_kernel(src_ptr + i * src_byte_stride,
+                                           dst_ptr + i * dst_byte_stride);
+                        }
+                    });
+            return;
         }
+
+        LaunchIndexerKernel<2>(indexer, {&src, &dst}, [&](char* const* ptrs) {
+            element_kernel(ptrs[0], ptrs[1]);
+        });
     }
 
+    /// Launches \p element_kernel(lhs_ptr, rhs_ptr, dst_ptr) for every
+    /// workload.
+    ///
+    /// If the output is contiguous and each input is contiguous or a
+    /// broadcasted scalar, the per-element offset computation is skipped. In
+    /// that case, \p vec_kernel (if not nullptr) processes whole ranges with
+    /// SIMD instructions instead. \p vec_kernel requires the inputs and output
+    /// to have the same dtype.
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
-                                     func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+                                     func_t element_kernel,
+                                     BinaryEWVecKernel vec_kernel = nullptr) {
+        const TensorRef& lhs = indexer.GetInput(0);
+        const TensorRef& rhs = indexer.GetInput(1);
+        const TensorRef& dst = indexer.GetOutput();
+        const int64_t lhs_stride = indexer.GetFlatElementStride(lhs);
+        const int64_t rhs_stride = indexer.GetFlatElementStride(rhs);
+        if (lhs_stride >= 0 && rhs_stride >= 0 &&
+            indexer.GetFlatElementStride(dst) == 1) {
+            const char* lhs_ptr = static_cast<const char*>(lhs.data_ptr_);
+            const char* rhs_ptr = static_cast<const char*>(rhs.data_ptr_);
+            char* dst_ptr = static_cast<char*>(dst.data_ptr_);
+            const int64_t lhs_byte_stride = lhs_stride * lhs.dtype_byte_size_;
+            const int64_t rhs_byte_stride = rhs_stride * rhs.dtype_byte_size_;
+            const int64_t dst_byte_stride = dst.dtype_byte_size_;
+            LaunchRangeKernel(
+                    indexer.NumWorkloads(), [&](int64_t start, int64_t end) {
+                        if (vec_kernel != nullptr) {
+                            vec_kernel(lhs_ptr + start * lhs_byte_stride,
+                                       lhs_stride,
+                                       rhs_ptr + start * rhs_byte_stride,
+                                       rhs_stride,
+                                       dst_ptr + start * dst_byte_stride,
+                                       end - start);
+                            return;
+                        }
+                        for (int64_t i = start; i < end; ++i) {
+                            element_kernel(lhs_ptr + i * lhs_byte_stride,
+                                           rhs_ptr + i * rhs_byte_stride,
+                                           dst_ptr + i * dst_byte_stride);
+                        }
+                    });
+            return;
         }
+
+        LaunchIndexerKernel<3>(indexer, {&lhs, &rhs, &dst},
+                               [&](char* const* ptrs) {
+                                   element_kernel(ptrs[0], ptrs[1], ptrs[2]);
+                               });
+    }
+
+    /// Calls \p element_kernel(ptrs) for every workload of \p indexer in
+    /// parallel, where ptrs[i] is the data pointer of \p refs[i] at that
+    /// workload. Each thread walks a contiguous range of workloads with an
+    /// IndexerWalker, which is specialized for Indexers of 1 to 4 dimensions.
+    template <int NARGS, typename func_t>
+    static void LaunchIndexerKernel(const Indexer& indexer,
+                                    const TensorRef* const (&refs)[NARGS],
+                                    func_t element_kernel) {
+        static constexpr int64_t kMinWorkloadsPerRange = 1024;
+        utility::ParallelFor(0, indexer.NumWorkloads(), kMinWorkloadsPerRange,
+                             [&](int64_t start, int64_t end) {
+                                 WalkIndexer<NARGS>(indexer, refs, start, end,
+                                                    element_kernel);
+                             });
+    }
+
+    /// Splits [0, num_workloads) into contiguous ranges and calls
+    /// \p range_kernel(start, end) on each range. The ranges are claimed
+    /// dynamically by the threads of utility::ParallelFor(); small workloads
+    /// run on the calling thread. Range boundaries are multiples of 64
+    /// workloads so that vectorized kernels only see a tail in the last range.
+    template <typename func_t>
+    static void LaunchRangeKernel(int64_t num_workloads, func_t range_kernel) {
+        static constexpr int64_t kMinWorkloadsPerRange = 4096;
+        static constexpr int64_t kRangeAlignment = 64;
+        if (num_workloads <= 0) {
+            return;
+        }
+        int64_t num_blocks =
+                (num_workloads + kRangeAlignment - 1) / kRangeAlignment;
+        utility::ParallelFor(
+                0, num_blocks, kMinWorkloadsPerRange / kRangeAlignment,
+                [&](int64_t block_begin, int64_t block_end) {
+                    range_kernel(block_begin * kRangeAlignment,
+                                 std::min(block_end * kRangeAlignment,
+                                          num_workloads));
+                });
+    }
+
+    /// Calls \p element_kernel(workload_idx) for every workload in parallel.
+    template <typename func_t>
+    static void LaunchElementKernel(int64_t num_workloads,
+                                    func_t element_kernel) {
+        static constexpr int64_t kMinWorkloadsPerRange = 1024;
+        utility::ParallelFor(0, num_workloads, kMinWorkloadsPerRange,
+                             [&](int64_t start, int64_t end) {
+                                 for (int64_t i = start; i < end; ++i) {
+                                     element_kernel(i);
+                                 }
+                             });
     }
 
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
+        LaunchElementKernel(indexer.NumWorkloads(), [&](int64_t workload_idx) {
             element_kernel(indexer.GetInputPtr(workload_idx),
                            indexer.GetOutputPtr(workload_idx));
-        }
+        });
     }
 
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelSerial(const Indexer& indexer,
                                             func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        WalkIndexer<2>(indexer, {&indexer.GetInput(0), &indexer.GetOutput()},
+                       0, indexer.NumWorkloads(), [&](char* const* ptrs) {
+                           element_kernel(ptrs[0], ptrs[1]);
+                       });
     }
 
     /// Create num_threads workers to compute partial reductions and then reduce
@@ -107,18 +223,15 @@ public:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        utility::ParallelForEach(0, num_threads, [&](int64_t thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                element_kernel(indexer.GetInputPtr(0, workload_idx),
-                               &thread_results[thread_idx]);
-            }
-        }
+            WalkIndexer<1>(indexer, {&indexer.GetInput(0)}, start, end,
+                           [&](char* const* ptrs) {
+                               element_kernel(ptrs[0],
+                                              &thread_results[thread_idx]);
+                           });
+        });
         void* output_ptr = indexer.GetOutputPtr(0);
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             element_kernel(&thread_results[thread_idx], output_ptr);
@@ -153,13 +266,45 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
+        utility::ParallelForEach(0, indexer_shape[best_dim], [&](int64_t i) {
             Indexer sub_indexer(indexer);
             sub_indexer.ShrinkDim(best_dim, i, 1);
             LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+        });
+    }
+
+    /// Calls \p element_kernel(ptrs) for the workloads [start, end) of
+    /// \p indexer on the calling thread, in order.
+    template <int NARGS, typename func_t>
+    static void WalkIndexer(const Indexer& indexer,
+                            const TensorRef* const (&refs)[NARGS],
+                            int64_t start,
+                            int64_t end,
+                            func_t element_kernel) {
+        if (start >= end) {
+            return;
+        }
+        switch (indexer.NumDims()) {
+            case 1:
+                IndexerWalker<NARGS, 1>(indexer, refs, start)
+                        .Walk(end - start, element_kernel);
+                break;
+            case 2:
+                IndexerWalker<NARGS, 2>(indexer, refs, start)
+                        .Walk(end - start, element_kernel);
+                break;
+            case 3:
+                IndexerWalker<NARGS, 3>(indexer, refs, start)
+                        .Walk(end - start, element_kernel);
+                break;
+            case 4:
+                IndexerWalker<NARGS, 4>(indexer, refs, start)
+                        .Walk(end - start, element_kernel);
+                break;
+            default:
+                IndexerWalker<NARGS>(indexer, refs, start)
+                        .Walk(end - start, element_kernel);
+                break;
         }
     }
 };
@@ -0,0 +1,702 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/CPUVectorized.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Open3D/Utility/CPUInfo.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+        defined(_M_IX86)
+#define OPEN3D_CPU_VECTORIZED_X86
+#include <immintrin.h>
+#endif
+
+// GCC and Clang only allow intrinsics in functions compiled for the matching
+// instruction set. Tagging the functions (instead of compiling this file with
+// -mavx2) keeps the rest of the binary runnable on older CPUs. MSVC accepts
+// all intrinsics without per-function flags.
+#if defined(__GNUC__)
+#define OPEN3D_TARGET_SSE2 __attribute__((target("sse2")))
+#define OPEN3D_TARGET_AVX2 __attribute__((target("avx2")))
+#define OPEN3D_TARGET_AVX512 __attribute__((target("avx512f")))
+#define OPEN3D_TARGET_F16C __attribute__((target("avx,f16c")))
+#else
+#define OPEN3D_TARGET_SSE2
+#define OPEN3D_TARGET_AVX2
+#define OPEN3D_TARGET_AVX512
+#define OPEN3D_TARGET_F16C
+#endif
+
+namespace open3d {
+namespace kernel {
+
+#ifdef OPEN3D_CPU_VECTORIZED_X86
+
+// Defines the contiguous loops and the kernel selectors for one instruction
+// set. Every function touching vector registers must carry the TARGET
+// attribute, hence the loops are stamped out per instruction set. The vector
+// traits V provide Load, Store, Set1 and the Binary<op> / Unary<op> templates.
+// Tails are computed on zero-padded stack buffers so that results are
+// bitwise identical to the scalar kernels.
+#define OPEN3D_DEFINE_VECTORIZED_LOOPS(TARGET)                                 \
+    template <typename V, BinaryEWOpCode op_code>                              \
+    TARGET void BinaryLoop(const void* lhs_ptr, int64_t lhs_stride,            \
+                           const void* rhs_ptr, int64_t rhs_stride,            \
+                           void* dst_ptr, int64_t num_elements) {              \
+        using scalar_t = typename V::Scalar;                                   \
+        using reg_t = typename V::Reg;                                         \
+        const scalar_t* lhs = static_cast<const scalar_t*>(lhs_ptr);           \
+        const scalar_t* rhs = static_cast<const scalar_t*>(rhs_ptr);           \
+        scalar_t* dst = static_cast<scalar_t*>(dst_ptr);                       \
+        const int64_t vec_end = num_elements - num_elements % V::kWidth;       \
+        int64_t i = 0;                                                         \
+        if (lhs_stride != 0 && rhs_stride != 0) {                              \
+            for (; i < vec_end; i += V::kWidth) {                              \
+                V::Store(dst + i,                                              \
+                         V::template Binary<op_code>(V::Load(lhs + i),         \
+                                                     V::Load(rhs + i)));       \
+            }                                                                  \
+        } else if (rhs_stride != 0) {                                          \
+            const reg_t a = V::Set1(*lhs);                                     \
+            for (; i < vec_end; i += V::kWidth) {                              \
+                V::Store(dst + i,                                              \
+                         V::template Binary<op_code>(a, V::Load(rhs + i)));    \
+            }                                                                  \
+        } else if (lhs_stride != 0) {                                          \
+            const reg_t b = V::Set1(*rhs);                                     \
+            for (; i < vec_end; i += V::kWidth) {                              \
+                V::Store(dst + i,                                              \
+                         V::template Binary<op_code>(V::Load(lhs + i), b));    \
+            }                                                                  \
+        } else {                                                               \
+            const reg_t c = V::template Binary<op_code>(V::Set1(*lhs),         \
+                                                        V::Set1(*rhs));        \
+            for (; i < vec_end; i += V::kWidth) {                              \
+                V::Store(dst + i, c);                                          \
+            }                                                                  \
+        }                                                                      \
+        if (i < num_elements) {                                                \
+            scalar_t a[V::kWidth] = {};                                        \
+            scalar_t b[V::kWidth] = {};                                        \
+            scalar_t c[V::kWidth];                                             \
+            for (int64_t k = 0; i + k < num_elements; ++k) {                   \
+                a[k] = lhs[(i + k) * lhs_stride];                              \
+                b[k] = rhs[(i + k) * rhs_stride];                              \
+            }                                                                  \
+            V::Store(c, V::template Binary<op_code>(V::Load(a), V::Load(b)));  \
+            std::memcpy(dst + i, c, (num_elements - i) * sizeof(scalar_t));    \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    template <typename V, UnaryEWOpCode op_code>                               \
+    TARGET void UnaryLoop(const void* src_ptr, int64_t src_stride,             \
+                          void* dst_ptr, int64_t num_elements) {               \
+        using scalar_t = typename V::Scalar;                                   \
+        const scalar_t* src = static_cast<const scalar_t*>(src_ptr);           \
+        scalar_t* dst = static_cast<scalar_t*>(dst_ptr);                       \
+        const int64_t vec_end = num_elements - num_elements % V::kWidth;       \
+        int64_t i = 0;                                                         \
+        if (src_stride != 0) {                                                 \
+            for (; i < vec_end; i += V::kWidth) {                              \
+                V::Store(dst + i,                                              \
+                         V::template Unary<op_code>(V::Load(src + i)));        \
+            }                                                                  \
+        } else {                                                               \
+            const typename V::Reg c =                                          \
+                    V::template Unary<op_code>(V::Set1(*src));                 \
+            for (; i < vec_end; i += V::kWidth) {                              \
+                V::Store(dst + i, c);                                          \
+            }                                                                  \
+        }                                                                      \
+        if (i < num_elements) {                                                \
+            scalar_t a[V::kWidth] = {};                                        \
+            scalar_t c[V::kWidth];                                             \
+            for (int64_t k = 0; i + k < num_elements; ++k) {                   \
+                a[k] = src[(i + k) * src_stride];                              \
+            }                                                                  \
+            V::Store(c, V::template Unary<op_code>(V::Load(a)));               \
+            std::memcpy(dst + i, c, (num_elements - i) * sizeof(scalar_t));    \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    template <typename V>                                                      \
+    BinaryEWVecKernel SelectBinaryEW(BinaryEWOpCode op_code) {                 \
+        switch (op_code) {                                                     \
+            case BinaryEWOpCode::Add:                                          \
+                return BinaryLoop<V, BinaryEWOpCode::Add>;                     \
+            case BinaryEWOpCode::Sub:                                          \
+                return BinaryLoop<V, BinaryEWOpCode::Sub>;                     \
+            case BinaryEWOpCode::Mul:                                          \
+                return V::kIsFloat ? BinaryLoop<V, BinaryEWOpCode::Mul>        \
+                                   : nullptr;                                  \
+            case BinaryEWOpCode::Div:                                          \
+                return V::kIsFloat ? BinaryLoop<V, BinaryEWOpCode::Div>        \
+                                   : nullptr;                                  \
+            default:                                                           \
+                return nullptr;                                                \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    template <typename V>                                                      \
+    UnaryEWVecKernel SelectUnaryEW(UnaryEWOpCode op_code) {                    \
+        switch (op_code) {                                                     \
+            case UnaryEWOpCode::Neg:                                           \
+                return UnaryLoop<V, UnaryEWOpCode::Neg>;                       \
+            case UnaryEWOpCode::Abs:                                           \
+                return V::kIsFloat ? UnaryLoop<V, UnaryEWOpCode::Abs>          \
+                                   : nullptr;                                  \
+            case UnaryEWOpCode::Sqrt:                                          \
+                return V::kIsFloat ? UnaryLoop<V, UnaryEWOpCode::Sqrt>         \
+                                   : nullptr;                                  \
+            default:                                                           \
+                return nullptr;                                                \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    BinaryEWVecKernel GetBinaryEWVecKernel(BinaryEWOpCode op_code,             \
+                                           Dtype dtype) {                      \
+        switch (dtype) {                                                       \
+            case Dtype::Float32:                                               \
+                return SelectBinaryEW<Float32>(op_code);                       \
+            case Dtype::Float64:                                               \
+                return SelectBinaryEW<Float64>(op_code);                       \
+            case Dtype::Int32:                                                 \
+                return SelectBinaryEW<Int32>(op_code);                         \
+            case Dtype::Int64:                                                 \
+                return SelectBinaryEW<Int64>(op_code);                         \
+            default:                                                           \
+                return nullptr;                                                \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    UnaryEWVecKernel GetUnaryEWVecKernel(UnaryEWOpCode op_code, Dtype dtype) { \
+        switch (dtype) {                                                       \
+            case Dtype::Float32:                                               \
+                return SelectUnaryEW<Float32>(op_code);                        \
+            case Dtype::Float64:                                               \
+                return SelectUnaryEW<Float64>(op_code);                        \
+            case Dtype::Int32:                                                 \
+                return SelectUnaryEW<Int32>(op_code);                          \
+            case Dtype::Int64:                                                 \
+                return SelectUnaryEW<Int64>(op_code);                          \
+            default:                                                           \
+                return nullptr;                                                \
+        }                                                                      \
+    }
+
+// Float vector traits. Neg and Abs flip / clear the sign bit, which matches
+// the scalar kernels for all inputs including NaN and -0.
+#define OPEN3D_DEFINE_FLOAT_BINARY_OPS(TARGET, PREFIX, SUFFIX)                 \
+    template <BinaryEWOpCode op_code>                                          \
+    TARGET static Reg Binary(Reg a, Reg b) {                                   \
+        switch (op_code) {                                                     \
+            case BinaryEWOpCode::Add:                                          \
+                return PREFIX##_add_##SUFFIX(a, b);                            \
+            case BinaryEWOpCode::Sub:                                          \
+                return PREFIX##_sub_##SUFFIX(a, b);                            \
+            case BinaryEWOpCode::Mul:                                          \
+                return PREFIX##_mul_##SUFFIX(a, b);                            \
+            case BinaryEWOpCode::Div:                                          \
+                return PREFIX##_div_##SUFFIX(a, b);                            \
+            default:                                                           \
+                return a;                                                      \
+        }                                                                      \
+    }
+
+#define OPEN3D_DEFINE_INT_BINARY_OPS(TARGET, PREFIX, SUFFIX)                   \
+    template <BinaryEWOpCode op_code>                                          \
+    TARGET static Reg Binary(Reg a, Reg b) {                                   \
+        switch (op_code) {                                                     \
+            case BinaryEWOpCode::Add:                                          \
+                return PREFIX##_add_##SUFFIX(a, b);                            \
+            case BinaryEWOpCode::Sub:                                          \
+                return PREFIX##_sub_##SUFFIX(a, b);                            \
+            default:                                                           \
+                return a;                                                      \
+        }                                                                      \
+    }                                                                          \
+    template <UnaryEWOpCode op_code>                                           \
+    TARGET static Reg Unary(Reg a) {                                           \
+        switch (op_code) {                                                     \
+            case UnaryEWOpCode::Neg:                                           \
+                return PREFIX##_sub_##SUFFIX(Zero(), a);                       \
+            default:                                                           \
+                return a;                                                      \
+        }                                                                      \
+    }
+
+namespace sse2 {
+
+struct Float32 {
+    using Scalar = float;
+    using Reg = __m128;
+    static constexpr int64_t kWidth = 4;
+    static constexpr bool kIsFloat = true;
+    OPEN3D_TARGET_SSE2 static Reg Load(const float* p) {
+        return _mm_loadu_ps(p);
+    }
+    OPEN3D_TARGET_SSE2 static void Store(float* p, Reg a) {
+        _mm_storeu_ps(p, a);
+    }
+    OPEN3D_TARGET_SSE2 static Reg Set1(float v) { return _mm_set1_ps(v); }
+    OPEN3D_DEFINE_FLOAT_BINARY_OPS(OPEN3D_TARGET_SSE2, _mm, ps)
+    template <UnaryEWOpCode op_code>
+    OPEN3D_TARGET_SSE2 static Reg Unary(Reg a) {
+        switch (op_code) {
+            case UnaryEWOpCode::Neg:
+                return _mm_xor_ps(a, _mm_set1_ps(-0.0f));
+            case UnaryEWOpCode::Abs:
+                return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+            case UnaryEWOpCode::Sqrt:
+                return _mm_sqrt_ps(a);
+            default:
+                return a;
+        }
+    }
+};
+
+struct Float64 {
+    using Scalar = double;
+    using Reg = __m128d;
+    static constexpr int64_t kWidth = 2;
+    static constexpr bool kIsFloat = true;
+    OPEN3D_TARGET_SSE2 static Reg Load(const double* p) {
+        return _mm_loadu_pd(p);
+    }
+    OPEN3D_TARGET_SSE2 static void Store(double* p, Reg a) {
+        _mm_storeu_pd(p, a);
+    }
+    OPEN3D_TARGET_SSE2 static Reg Set1(double v) { return _mm_set1_pd(v); }
+    OPEN3D_DEFINE_FLOAT_BINARY_OPS(OPEN3D_TARGET_SSE2, _mm, pd)
+    template <UnaryEWOpCode op_code>
+    OPEN3D_TARGET_SSE2 static Reg Unary(Reg a) {
+        switch (op_code) {
+            case UnaryEWOpCode::Neg:
+                return _mm_xor_pd(a, _mm_set1_pd(-0.0));
+            case UnaryEWOpCode::Abs:
+                return _mm_andnot_pd(_mm_set1_pd(-0.0), a);
+            case UnaryEWOpCode::Sqrt:
+                return _mm_sqrt_pd(a);
+            default:
+                return a;
+        }
+    }
+};
+
+struct Int32 {
+    using Scalar = int32_t;
+    using Reg = __m128i;
+    static constexpr int64_t kWidth = 4;
+    static constexpr bool kIsFloat = false;
+    OPEN3D_TARGET_SSE2 static Reg Load(const int32_t* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    OPEN3D_TARGET_SSE2 static void Store(int32_t* p, Reg a) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+    }
+    OPEN3D_TARGET_SSE2 static Reg Set1(int32_t v) { return _mm_set1_epi32(v); }
+    OPEN3D_TARGET_SSE2 static Reg Zero() { return _mm_setzero_si128(); }
+    OPEN3D_DEFINE_INT_BINARY_OPS(OPEN3D_TARGET_SSE2, _mm, epi32)
+};
+
+struct Int64 {
+    using Scalar = int64_t;
+    using Reg = __m128i;
+    static constexpr int64_t kWidth = 2;
+    static constexpr bool kIsFloat = false;
+    OPEN3D_TARGET_SSE2 static Reg Load(const int64_t* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    OPEN3D_TARGET_SSE2 static void Store(int64_t* p, Reg a) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+    }
+    OPEN3D_TARGET_SSE2 static Reg Set1(int64_t v) {
+        return _mm_set1_epi64x(v);
+    }
+    OPEN3D_TARGET_SSE2 static Reg Zero() { return _mm_setzero_si128(); }
+    OPEN3D_DEFINE_INT_BINARY_OPS(OPEN3D_TARGET_SSE2, _mm, epi64)
+};
+
+OPEN3D_DEFINE_VECTORIZED_LOOPS(OPEN3D_TARGET_SSE2)
+
+}  // namespace sse2
+
+namespace avx2 {
+
+struct Float32 {
+    using Scalar = float;
+    using Reg = __m256;
+    static constexpr int64_t kWidth = 8;
+    static constexpr bool kIsFloat = true;
+    OPEN3D_TARGET_AVX2 static Reg Load(const float* p) {
+        return _mm256_loadu_ps(p);
+    }
+    OPEN3D_TARGET_AVX2 static void Store(float* p, Reg a) {
+        _mm256_storeu_ps(p, a);
+    }
+    OPEN3D_TARGET_AVX2 static Reg Set1(float v) { return _mm256_set1_ps(v); }
+    OPEN3D_DEFINE_FLOAT_BINARY_OPS(OPEN3D_TARGET_AVX2, _mm256, ps)
+    template <UnaryEWOpCode op_code>
+    OPEN3D_TARGET_AVX2 static Reg Unary(Reg a) {
+        switch (op_code) {
+            case UnaryEWOpCode::Neg:
+                return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f));
+            case UnaryEWOpCode::Abs:
+                return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+            case UnaryEWOpCode::Sqrt:
+                return _mm256_sqrt_ps(a);
+            default:
+                return a;
+        }
+    }
+};
+
+struct Float64 {
+    using Scalar = double;
+    using Reg = __m256d;
+    static constexpr int64_t kWidth = 4;
+    static constexpr bool kIsFloat = true;
+    OPEN3D_TARGET_AVX2 static Reg Load(const double* p) {
+        return _mm256_loadu_pd(p);
+    }
+    OPEN3D_TARGET_AVX2 static void Store(double* p, Reg a) {
+        _mm256_storeu_pd(p, a);
+    }
+    OPEN3D_TARGET_AVX2 static Reg Set1(double v) { return _mm256_set1_pd(v); }
+    OPEN3D_DEFINE_FLOAT_BINARY_OPS(OPEN3D_TARGET_AVX2, _mm256, pd)
+    template <UnaryEWOpCode op_code>
+    OPEN3D_TARGET_AVX2 static Reg Unary(Reg a) {
+        switch (op_code) {
+            case UnaryEWOpCode::Neg:
+                return _mm256_xor_pd(a, _mm256_set1_pd(-0.0));
+            case UnaryEWOpCode::Abs:
+                return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+            case UnaryEWOpCode::Sqrt:
+                return _mm256_sqrt_pd(a);
+            default:
+                return a;
+        }
+    }
+};
+
+struct Int32 {
+    using Scalar = int32_t;
+    using Reg = __m256i;
+    static constexpr int64_t kWidth = 8;
+    static constexpr bool kIsFloat = false;
+    OPEN3D_TARGET_AVX2 static Reg Load(const int32_t* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    OPEN3D_TARGET_AVX2 static void Store(int32_t* p, Reg a) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+    }
+    OPEN3D_TARGET_AVX2 static Reg Set1(int32_t v) {
+        return _mm256_set1_epi32(v);
+    }
+    OPEN3D_TARGET_AVX2 static Reg Zero() { return _mm256_setzero_si256(); }
+    OPEN3D_DEFINE_INT_BINARY_OPS(OPEN3D_TARGET_AVX2, _mm256, epi32)
+};
+
+struct Int64 {
+    using Scalar = int64_t;
+    using Reg = __m256i;
+    static constexpr int64_t kWidth = 4;
+    static constexpr bool kIsFloat = false;
+    OPEN3D_TARGET_AVX2 static Reg Load(const int64_t* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    OPEN3D_TARGET_AVX2 static void Store(int64_t* p, Reg a) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+    }
+    OPEN3D_TARGET_AVX2 static Reg Set1(int64_t v) {
+        return _mm256_set1_epi64x(v);
+    }
+    OPEN3D_TARGET_AVX2 static Reg Zero() { return _mm256_setzero_si256(); }
+    OPEN3D_DEFINE_INT_BINARY_OPS(OPEN3D_TARGET_AVX2, _mm256, epi64)
+};
+
+OPEN3D_DEFINE_VECTORIZED_LOOPS(OPEN3D_TARGET_AVX2)
+
+}  // namespace avx2
+
+namespace avx512 {
+
+// AVX-512F has no floating point xor/and, so the sign bit is manipulated in
+// the integer domain.
+struct Float32 {
+    using Scalar = float;
+    using Reg = __m512;
+    static constexpr int64_t kWidth = 16;
+    static constexpr bool kIsFloat = true;
+    OPEN3D_TARGET_AVX512 static Reg Load(const float* p) {
+        return _mm512_loadu_ps(p);
+    }
+    OPEN3D_TARGET_AVX512 static void Store(float* p, Reg a) {
+        _mm512_storeu_ps(p, a);
+    }
+    OPEN3D_TARGET_AVX512 static Reg Set1(float v) { return _mm512_set1_ps(v); }
+    OPEN3D_DEFINE_FLOAT_BINARY_OPS(OPEN3D_TARGET_AVX512, _mm512, ps)
+    template <UnaryEWOpCode op_code>
+    OPEN3D_TARGET_AVX512 static Reg Unary(Reg a) {
+        switch (op_code) {
+            case UnaryEWOpCode::Neg:
+                return _mm512_castsi512_ps(
+                        _mm512_xor_si512(_mm512_castps_si512(a),
+                                         _mm512_set1_epi32(INT32_MIN)));
+            case UnaryEWOpCode::Abs:
+                return _mm512_castsi512_ps(
+                        _mm512_and_si512(_mm512_castps_si512(a),
+                                         _mm512_set1_epi32(INT32_MAX)));
+            case UnaryEWOpCode::Sqrt:
+                return _mm512_sqrt_ps(a);
+            default:
+                return a;
+        }
+    }
+};
+
+struct Float64 {
+    using Scalar = double;
+    using Reg = __m512d;
+    static constexpr int64_t kWidth = 8;
+    static constexpr bool kIsFloat = true;
+    OPEN3D_TARGET_AVX512 static Reg Load(const double* p) {
+        return _mm512_loadu_pd(p);
+    }
+    OPEN3D_TARGET_AVX512 static void Store(double* p, Reg a) {
+        _mm512_storeu_pd(p, a);
+    }
+    OPEN3D_TARGET_AVX512 static Reg Set1(double v) {
+        return _mm512_set1_pd(v);
+    }
+    OPEN3D_DEFINE_FLOAT_BINARY_OPS(OPEN3D_TARGET_AVX512, _mm512, pd)
+    template <UnaryEWOpCode op_code>
+    OPEN3D_TARGET_AVX512 static Reg Unary(Reg a) {
+        switch (op_code) {
+            case UnaryEWOpCode::Neg:
+                return _mm512_castsi512_pd(
+                        _mm512_xor_si512(_mm512_castpd_si512(a),
+                                         _mm512_set1_epi64(INT64_MIN)));
+            case UnaryEWOpCode::Abs:
+                return _mm512_castsi512_pd(
+                        _mm512_and_si512(_mm512_castpd_si512(a),
+                                         _mm512_set1_epi64(INT64_MAX)));
+            case UnaryEWOpCode::Sqrt:
+                return _mm512_sqrt_pd(a);
+            default:
+                return a;
+        }
+    }
+};
+
+struct Int32 {
+    using Scalar = int32_t;
+    using Reg = __m512i;
+    static constexpr int64_t kWidth = 16;
+    static constexpr bool kIsFloat = false;
+    OPEN3D_TARGET_AVX512 static Reg Load(const int32_t* p) {
+        return _mm512_loadu_si512(p);
+    }
+    OPEN3D_TARGET_AVX512 static void Store(int32_t* p, Reg a) {
+        _mm512_storeu_si512(p, a);
+    }
+    OPEN3D_TARGET_AVX512 static Reg Set1(int32_t v) {
+        return _mm512_set1_epi32(v);
+    }
+    OPEN3D_TARGET_AVX512 static Reg Zero() { return _mm512_setzero_si512(); }
+    OPEN3D_DEFINE_INT_BINARY_OPS(OPEN3D_TARGET_AVX512, _mm512, epi32)
+};
+
+struct Int64 {
+    using Scalar = int64_t;
+    using Reg = __m512i;
+    static constexpr int64_t kWidth = 8;
+    static constexpr bool kIsFloat = false;
+    OPEN3D_TARGET_AVX512 static Reg Load(const int64_t* p) {
+        return _mm512_loadu_si512(p);
+    }
+    OPEN3D_TARGET_AVX512 static void Store(int64_t* p, Reg a) {
+        _mm512_storeu_si512(p, a);
+    }
+    OPEN3D_TARGET_AVX512 static Reg Set1(int64_t v) {
+        return _mm512_set1_epi64(v);
+    }
+    OPEN3D_TARGET_AVX512 static Reg Zero() { return _mm512_setzero_si512(); }
+    OPEN3D_DEFINE_INT_BINARY_OPS(OPEN3D_TARGET_AVX512, _mm512, epi64)
+};
+
+OPEN3D_DEFINE_VECTORIZED_LOOPS(OPEN3D_TARGET_AVX512)
+
+}  // namespace avx512
+
+namespace f16c {
+
+// Float16 <-> Float32 conversion with F16C, 8 lanes at a time. The hardware
+// conversion rounds to nearest even and keeps NaNs quiet, exactly like
+// Half::FloatToBits(), so results match the scalar kernels.
+
+// The scalar tails first clear the upper YMM halves: the buffer copies may be
+// compiled to legacy SSE code or library calls, which would otherwise pay the
+// AVX-SSE transition penalty. The tails are converted with the 128-bit F16C
+// instructions on zero-padded buffers.
+
+OPEN3D_TARGET_F16C void HalfToFloat(const void* src_ptr,
+                                    int64_t src_stride,
+                                    void* dst_ptr,
+                                    int64_t num_elements) {
+    const uint16_t* src = static_cast<const uint16_t*>(src_ptr);
+    float* dst = static_cast<float*>(dst_ptr);
+    if (src_stride == 0) {
+        const __m128 value = _mm_cvtph_ps(
+                _mm_set1_epi16(static_cast<int16_t>(*src)));
+        const __m256 values = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(value), value, 1);
+        int64_t i = 0;
+        for (; i + 8 <= num_elements; i += 8) {
+            _mm256_storeu_ps(dst + i, values);
+        }
+        _mm256_zeroupper();
+        std::fill(dst + i, dst + num_elements, _mm_cvtss_f32(value));
+        return;
+    }
+    const int64_t vec_end = num_elements - num_elements % 8;
+    int64_t i = 0;
+    for (; i < vec_end; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    _mm256_zeroupper();
+    if (i < num_elements) {
+        alignas(16) uint16_t h[8] = {0};
+        alignas(16) float f[8];
+        std::copy(src + i, src + num_elements, h);
+        const __m128i hv = _mm_load_si128(reinterpret_cast<const __m128i*>(h));
+        _mm_store_ps(f, _mm_cvtph_ps(hv));
+        _mm_store_ps(f + 4, _mm_cvtph_ps(_mm_srli_si128(hv, 8)));
+        std::copy(f, f + (num_elements - i), dst + i);
+    }
+}
+
+OPEN3D_TARGET_F16C void FloatToHalf(const void* src_ptr,
+                                    int64_t src_stride,
+                                    void* dst_ptr,
+                                    int64_t num_elements) {
+    const float* src = static_cast<const float*>(src_ptr);
+    uint16_t* dst = static_cast<uint16_t*>(dst_ptr);
+    if (src_stride == 0) {
+        const __m128i value =
+                _mm_cvtps_ph(_mm_set1_ps(*src), _MM_FROUND_TO_NEAREST_INT);
+        const __m128i values = _mm_unpacklo_epi64(value, value);
+        int64_t i = 0;
+        for (; i + 8 <= num_elements; i += 8) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), values);
+        }
+        std::fill(dst + i, dst + num_elements,
+                  static_cast<uint16_t>(_mm_extract_epi16(value, 0)));
+        return;
+    }
+    const int64_t vec_end = num_elements - num_elements % 8;
+    int64_t i = 0;
+    for (; i < vec_end; i += 8) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+                                    _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+    _mm256_zeroupper();
+    if (i < num_elements) {
+        alignas(16) float f[8] = {0};
+        alignas(16) uint16_t h[8];
+        std::copy(src + i, src + num_elements, f);
+        const __m128i lo =
+                _mm_cvtps_ph(_mm_load_ps(f), _MM_FROUND_TO_NEAREST_INT);
+        const __m128i hi =
+                _mm_cvtps_ph(_mm_load_ps(f + 4), _MM_FROUND_TO_NEAREST_INT);
+        _mm_store_si128(reinterpret_cast<__m128i*>(h),
+                        _mm_unpacklo_epi64(lo, hi));
+        std::copy(h, h + (num_elements - i), dst + i);
+    }
+}
+
+}  // namespace f16c
+
+#endif  // OPEN3D_CPU_VECTORIZED_X86
+
+BinaryEWVecKernel GetBinaryEWVecKernel(BinaryEWOpCode op_code, Dtype dtype) {
+#ifdef OPEN3D_CPU_VECTORIZED_X86
+    switch (utility::GetSIMDLevel()) {
+        case utility::SIMDLevel::AVX512:
+            return avx512::GetBinaryEWVecKernel(op_code, dtype);
+        case utility::SIMDLevel::AVX2:
+            return avx2::GetBinaryEWVecKernel(op_code, dtype);
+        case utility::SIMDLevel::SSE2:
+            return sse2::GetBinaryEWVecKernel(op_code, dtype);
+        default:
+            return nullptr;
+    }
+#else
+    return nullptr;
+#endif
+}
+
+UnaryEWVecKernel GetUnaryEWVecKernel(UnaryEWOpCode op_code, Dtype dtype) {
+#ifdef OPEN3D_CPU_VECTORIZED_X86
+    switch (utility::GetSIMDLevel()) {
+        case utility::SIMDLevel::AVX512:
+            return avx512::GetUnaryEWVecKernel(op_code, dtype);
+        case utility::SIMDLevel::AVX2:
+            return avx2::GetUnaryEWVecKernel(op_code, dtype);
+        case utility::SIMDLevel::SSE2:
+            return sse2::GetUnaryEWVecKernel(op_code, dtype);
+        default:
+            return nullptr;
+    }
+#else
+    return nullptr;
+#endif
+}
+
+UnaryEWVecKernel GetCopyVecKernel(Dtype src_dtype, Dtype dst_dtype) {
+#ifdef OPEN3D_CPU_VECTORIZED_X86
+    // F16C shipped together with AVX2 on every x86 CPU, but it is still
+    // checked separately since the SIMD level can be capped.
+    if (utility::GetSIMDLevel() < utility::SIMDLevel::AVX2 ||
+        !utility::CPUSupportsF16C()) {
+        return nullptr;
+    }
+    if (src_dtype == Dtype::Float16 && dst_dtype == Dtype::Float32) {
+        return f16c::HalfToFloat;
+    } else if (src_dtype == Dtype::Float32 && dst_dtype == Dtype::Float16) {
+        return f16c::FloatToHalf;
+    }
+#endif
+    return nullptr;
+}
+
+}  // namespace kernel
+}  // namespace open3d
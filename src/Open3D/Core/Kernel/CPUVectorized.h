@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/UnaryEW.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Vectorized kernel for a contiguous binary elementwise op. \p lhs_stride and
+/// \p rhs_stride are element strides: 1 for contiguous operands, 0 for
+/// broadcasted scalars. \p dst is always contiguous.
+using BinaryEWVecKernel = void (*)(const void* lhs,
+                                   int64_t lhs_stride,
+                                   const void* rhs,
+                                   int64_t rhs_stride,
+                                   void* dst,
+                                   int64_t num_elements);
+
+/// Vectorized kernel for a contiguous unary elementwise op. \p src_stride is
+/// 1 for contiguous input or 0 for a broadcasted scalar.
+using UnaryEWVecKernel = void (*)(const void* src,
+                                  int64_t src_stride,
+                                  void* dst,
+                                  int64_t num_elements);
+
+/// Returns the SIMD kernel for \p op_code and \p dtype at the current
+/// utility::GetSIMDLevel(), or nullptr if the combination is not vectorized.
+/// Input and output dtypes must both be \p dtype.
+BinaryEWVecKernel GetBinaryEWVecKernel(BinaryEWOpCode op_code, Dtype dtype);
+
+/// Returns the SIMD kernel for \p op_code and \p dtype at the current
+/// utility::GetSIMDLevel(), or nullptr if the combination is not vectorized.
+/// Input and output dtypes must both be \p dtype.
+UnaryEWVecKernel GetUnaryEWVecKernel(UnaryEWOpCode op_code, Dtype dtype);
+
+/// Returns the SIMD kernel converting contiguous \p src_dtype values to
+/// \p dst_dtype, or nullptr if the conversion is not vectorized. Currently
+/// Float16 <-> Float32 is vectorized with F16C.
+UnaryEWVecKernel GetCopyVecKernel(Dtype src_dtype, Dtype dst_dtype);
+
+}  // namespace kernel
+}  // namespace open3d
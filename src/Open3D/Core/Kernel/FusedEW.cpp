@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst) {
+    if (inputs.empty() || program.empty()) {
+        utility::LogError("FusedEW requires at least one input and one op.");
+    }
+    if (static_cast<int64_t>(inputs.size()) > MAX_INPUTS) {
+        utility::LogError("FusedEW cannot have more than {} inputs, but got {}.",
+                          MAX_INPUTS, inputs.size());
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Input shape {} cannot be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+    }
+    for (size_t i = 0; i < program.size(); ++i) {
+        const FusedEWInstruction& inst = program[i];
+        int64_t num_regs = static_cast<int64_t>(i);
+        bool valid = true;
+        switch (inst.kind_) {
+            case FusedEWInstruction::Kind::Input:
+                valid = inst.input_idx_ >= 0 &&
+                        inst.input_idx_ < static_cast<int64_t>(inputs.size());
+                break;
+            case FusedEWInstruction::Kind::Unary:
+                valid = inst.lhs_ >= 0 && inst.lhs_ < num_regs &&
+                        inst.unary_op_code_ != UnaryEWOpCode::LogicalNot;
+                break;
+            case FusedEWInstruction::Kind::Binary:
+                valid = inst.lhs_ >= 0 && inst.lhs_ < num_regs &&
+                        inst.rhs_ >= 0 && inst.rhs_ < num_regs &&
+                        s_boolean_binary_ew_op_codes.find(
+                                inst.binary_op_code_) ==
+                                s_boolean_binary_ew_op_codes.end();
+                break;
+        }
+        if (!valid) {
+            utility::LogError("Invalid FusedEW instruction {}.", i);
+        }
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
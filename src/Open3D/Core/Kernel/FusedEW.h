@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/UnaryEW.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// One instruction of a fused elementwise program. The result of the i-th
+/// instruction is stored in register i; operands refer to the registers of
+/// earlier instructions.
+struct FusedEWInstruction {
+    enum class Kind { Input, Unary, Binary };
+
+    static FusedEWInstruction Input(int64_t input_idx) {
+        FusedEWInstruction inst;
+        inst.kind_ = Kind::Input;
+        inst.input_idx_ = input_idx;
+        return inst;
+    }
+    static FusedEWInstruction Unary(UnaryEWOpCode op_code, int64_t src) {
+        FusedEWInstruction inst;
+        inst.kind_ = Kind::Unary;
+        inst.unary_op_code_ = op_code;
+        inst.lhs_ = src;
+        return inst;
+    }
+    static FusedEWInstruction Binary(BinaryEWOpCode op_code,
+                                     int64_t lhs,
+                                     int64_t rhs) {
+        FusedEWInstruction inst;
+        inst.kind_ = Kind::Binary;
+        inst.binary_op_code_ = op_code;
+        inst.lhs_ = lhs;
+        inst.rhs_ = rhs;
+        return inst;
+    }
+
+    Kind kind_ = Kind::Input;
+    /// Index into the input tensors, for Kind::Input.
+    int64_t input_idx_ = 0;
+    /// Operand registers. Unary instructions only use lhs_.
+    int64_t lhs_ = 0;
+    int64_t rhs_ = 0;
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+};
+
+/// Evaluates \p program in a single pass over memory and writes the result of
+/// the last instruction to \p dst. The inputs are broadcasted to the shape of
+/// \p dst and must all have the same dtype as \p dst. Only arithmetic
+/// (Add, Sub, Mul, Div) and math (Sqrt, Sin, Cos, Neg, Exp, Abs) ops are
+/// supported.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst);
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,249 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Kernel/CPULauncher.h"
+#include "Open3D/Core/Kernel/CPUVectorized.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+namespace {
+
+/// Number of elements evaluated per register. Registers of a block stay in
+/// L1/L2 cache, so only the inputs and the output touch main memory.
+constexpr int64_t kFusedBlockSize = 256;
+
+template <typename scalar_t>
+void ApplyUnary(UnaryEWOpCode op_code,
+                const scalar_t* src,
+                scalar_t* dst,
+                int64_t n) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sqrt(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Sin:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sin(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Cos:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::cos(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Neg:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(-src[i]);
+            }
+            break;
+        case UnaryEWOpCode::Exp:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::exp(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Abs:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::abs(static_cast<double>(src[i])));
+            }
+            break;
+        default:
+            utility::LogError("Unsupported op_code for FusedEW.");
+    }
+}
+
+template <typename scalar_t>
+void ApplyBinary(BinaryEWOpCode op_code,
+                 const scalar_t* lhs,
+                 const scalar_t* rhs,
+                 scalar_t* dst,
+                 int64_t n) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] + rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Sub:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] - rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Mul:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] * rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Div:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] / rhs[i];
+            }
+            break;
+        default:
+            utility::LogError("Unsupported op_code for FusedEW.");
+    }
+}
+
+template <typename scalar_t>
+void LaunchFusedEWKernel(const Indexer& indexer,
+                         const std::vector<FusedEWInstruction>& program) {
+    const int64_t num_regs = static_cast<int64_t>(program.size());
+    const int64_t num_inputs = indexer.NumInputs();
+
+    // Contiguous inputs are read in place, broadcasted scalars are splatted
+    // once per block and all other inputs are gathered element by element.
+    std::vector<int64_t> input_strides(num_inputs);
+    for (int64_t i = 0; i < num_inputs; ++i) {
+        input_strides[i] = indexer.GetFlatElementStride(indexer.GetInput(i));
+    }
+    const bool dst_contiguous =
+            indexer.GetFlatElementStride(indexer.GetOutput()) == 1;
+    scalar_t* dst_base = static_cast<scalar_t*>(indexer.GetOutput().data_ptr_);
+
+    // Reuse the SIMD kernels of the eager ops where available.
+    std::vector<UnaryEWVecKernel> unary_vec_kernels(num_regs, nullptr);
+    std::vector<BinaryEWVecKernel> binary_vec_kernels(num_regs, nullptr);
+    const Dtype dtype = DtypeUtil::FromType<scalar_t>();
+    for (int64_t i = 0; i < num_regs; ++i) {
+        if (program[i].kind_ == FusedEWInstruction::Kind::Unary) {
+            unary_vec_kernels[i] =
+                    GetUnaryEWVecKernel(program[i].unary_op_code_, dtype);
+        } else if (program[i].kind_ == FusedEWInstruction::Kind::Binary) {
+            binary_vec_kernels[i] =
+                    GetBinaryEWVecKernel(program[i].binary_op_code_, dtype);
+        }
+    }
+
+    CPULauncher::LaunchRangeKernel(indexer.NumWorkloads(), [&](int64_t start,
+                                                              int64_t end) {
+        std::vector<scalar_t> buffer(num_regs * kFusedBlockSize);
+        std::vector<const scalar_t*> regs(num_regs, nullptr);
+        for (int64_t block_start = start; block_start < end;
+             block_start += kFusedBlockSize) {
+            const int64_t n = std::min(kFusedBlockSize, end - block_start);
+            for (int64_t r = 0; r < num_regs; ++r) {
+                const FusedEWInstruction& inst = program[r];
+                scalar_t* out = buffer.data() + r * kFusedBlockSize;
+                if (r == num_regs - 1 && dst_contiguous) {
+                    out = dst_base + block_start;
+                }
+                switch (inst.kind_) {
+                    case FusedEWInstruction::Kind::Input: {
+                        const int64_t stride = input_strides[inst.input_idx_];
+                        const scalar_t* base = static_cast<const scalar_t*>(
+                                indexer.GetInput(inst.input_idx_).data_ptr_);
+                        if (stride == 1 && out != dst_base + block_start) {
+                            out = const_cast<scalar_t*>(base + block_start);
+                        } else if (stride == 1) {
+                            std::copy(base + block_start,
+                                      base + block_start + n, out);
+                        } else if (stride == 0) {
+                            std::fill(out, out + n, *base);
+                        } else {
+                            scalar_t* it = out;
+                            CPULauncher::WalkIndexer<1>(
+                                    indexer,
+                                    {&indexer.GetInput(inst.input_idx_)},
+                                    block_start, block_start + n,
+                                    [&](char* const* ptrs) {
+                                        *it++ = *reinterpret_cast<
+                                                const scalar_t*>(ptrs[0]);
+                                    });
+                        }
+                        break;
+                    }
+                    case FusedEWInstruction::Kind::Unary:
+                        if (unary_vec_kernels[r] != nullptr) {
+                            unary_vec_kernels[r](regs[inst.lhs_], 1, out, n);
+                        } else {
+                            ApplyUnary(inst.unary_op_code_, regs[inst.lhs_],
+                                       out, n);
+                        }
+                        break;
+                    case FusedEWInstruction::Kind::Binary:
+                        if (binary_vec_kernels[r] != nullptr) {
+                            binary_vec_kernels[r](regs[inst.lhs_], 1,
+                                                  regs[inst.rhs_], 1, out, n);
+                        } else {
+                            ApplyBinary(inst.binary_op_code_, regs[inst.lhs_],
+                                        regs[inst.rhs_], out, n);
+                        }
+                        break;
+                }
+                regs[r] = out;
+            }
+            if (!dst_contiguous) {
+                const scalar_t* result = regs[num_regs - 1];
+                CPULauncher::WalkIndexer<1>(
+                        indexer, {&indexer.GetOutput()}, block_start,
+                        block_start + n, [&](char* const* ptrs) {
+                            *reinterpret_cast<scalar_t*>(ptrs[0]) = *result++;
+                        });
+            }
+        }
+    });
+}
+
+}  // unnamed namespace
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst) {
+    Dtype dtype = dst.GetDtype();
+    Indexer indexer(inputs, dst, DtypePolicy::ASSERT_SAME);
+
+    for (const FusedEWInstruction& inst : program) {
+        if (inst.kind_ == FusedEWInstruction::Kind::Unary &&
+            inst.unary_op_code_ != UnaryEWOpCode::Neg &&
+            inst.unary_op_code_ != UnaryEWOpCode::Abs &&
+            dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
+            utility::LogError(
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
+                    DtypeUtil::ToString(dtype));
+        }
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        LaunchFusedEWKernel<scalar_t>(indexer, program);
+    });
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Matmul.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    for (const Tensor& t : {rhs, dst}) {
+        if (lhs.GetDevice() != t.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              lhs.GetDevice().ToString(),
+                              t.GetDevice().ToString());
+        }
+        if (lhs.GetDtype() != t.GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              DtypeUtil::ToString(lhs.GetDtype()),
+                              DtypeUtil::ToString(t.GetDtype()));
+        }
+    }
+    int64_t ndims = lhs.NumDims();
+    if (ndims < 2 || rhs.NumDims() != ndims || dst.NumDims() != ndims) {
+        utility::LogError(
+                "Matmul expects Tensors with the same number (>= 2) of "
+                "dimensions, but got {}, {} and {}.",
+                lhs.GetShape(), rhs.GetShape(), dst.GetShape());
+    }
+    // Batch dimensions must already be broadcasted to the same shape.
+    SizeVector expected_shape = lhs.GetShape();
+    expected_shape[ndims - 1] = rhs.GetShape(ndims - 1);
+    SizeVector rhs_batch_shape = rhs.GetShape();
+    rhs_batch_shape[ndims - 2] = lhs.GetShape(ndims - 2);
+    rhs_batch_shape[ndims - 1] = rhs.GetShape(ndims - 1);
+    if (lhs.GetShape(ndims - 1) != rhs.GetShape(ndims - 2) ||
+        rhs_batch_shape != expected_shape || dst.GetShape() != expected_shape) {
+        utility::LogError("Matmul shape mismatch: {} @ {} -> {}.",
+                          lhs.GetShape(), rhs.GetShape(), dst.GetShape());
+    }
+    if (lhs.GetDtype() == Dtype::Bool) {
+        utility::LogError("Matmul does not support Bool.");
+    }
+
+    Device::DeviceType device_type = lhs.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MatmulCPU(lhs, rhs, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        utility::LogError("Matmul is not implemented for CUDA.");
+    } else {
+        utility::LogError("Matmul: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
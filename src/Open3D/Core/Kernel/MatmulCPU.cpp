@@ -0,0 +1,519 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Kernel/Matmul.h"
+#include "Open3D/Utility/CPUInfo.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+#ifdef OPEN3D_USE_BLAS
+#include <cblas.h>
+#endif
+
+// The micro-kernel is plain C++ that the compiler vectorizes. On x86 with GCC
+// or Clang, a second copy is compiled for AVX2 with FMA and selected at
+// runtime.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define OPEN3D_MATMUL_AVX2
+#endif
+
+namespace open3d {
+namespace kernel {
+
+/// Strided matrix, strides are in elements.
+template <typename scalar_t>
+struct MatrixRef {
+    scalar_t* data_;
+    int64_t row_stride_;
+    int64_t col_stride_;
+
+    scalar_t& operator()(int64_t row, int64_t col) const {
+        return data_[row * row_stride_ + col * col_stride_];
+    }
+};
+
+// Register block: the micro-kernel keeps kMR x kNR accumulators.
+static constexpr int64_t kMR = 4;
+static constexpr int64_t kNR = 8;
+
+// Cache blocks: the packed kMC x kKC block of lhs stays in L2 while each
+// packed kKC x kNR sliver of rhs is streamed from L1 by the micro-kernel.
+static constexpr int64_t kKC = 256;
+static constexpr int64_t kMC = 128;
+static constexpr int64_t kNC = 1024;
+
+// Products with fewer multiply-adds per matrix, or with very thin operands,
+// use the direct loops since packing would not pay off.
+static constexpr int64_t kMinBlockedFlops = 32 * 32 * 32;
+
+// Minimum number of multiply-adds per parallel work item.
+static constexpr int64_t kMinParallelFlops = 1 << 16;
+
+/// Computes the kMR x kNR block acc = a^T b, where a is a packed kc x kMR lhs
+/// sliver and b a packed kc x kNR rhs sliver. The fixed inner loops compile to
+/// SIMD multiply-adds on the accumulator rows.
+#define OPEN3D_DEFINE_GEMM_MICRO_KERNEL(NAME, TARGET)                      \
+    template <typename scalar_t>                                           \
+    TARGET static void NAME(int64_t kc, const scalar_t* a,                 \
+                            const scalar_t* b, scalar_t* out) {            \
+        scalar_t acc[kMR * kNR];                                           \
+        for (int64_t i = 0; i < kMR * kNR; ++i) {                          \
+            acc[i] = 0;                                                    \
+        }                                                                  \
+        for (int64_t p = 0; p < kc; ++p) {                                 \
+            for (int64_t i = 0; i < kMR; ++i) {                            \
+                const scalar_t a_val = a[p * kMR + i];                     \
+                for (int64_t j = 0; j < kNR; ++j) {                        \
+                    acc[i * kNR + j] += a_val * b[p * kNR + j];            \
+                }                                                          \
+            }                                                              \
+        }                                                                  \
+        for (int64_t i = 0; i < kMR * kNR; ++i) {                          \
+            out[i] = acc[i];                                               \
+        }                                                                  \
+    }
+
+OPEN3D_DEFINE_GEMM_MICRO_KERNEL(MicroKernel, )
+#ifdef OPEN3D_MATMUL_AVX2
+OPEN3D_DEFINE_GEMM_MICRO_KERNEL(MicroKernelAVX2,
+                                __attribute__((target("avx2,fma"))))
+#endif
+
+template <typename scalar_t>
+using MicroKernelFunc = void (*)(int64_t,
+                                 const scalar_t*,
+                                 const scalar_t*,
+                                 scalar_t*);
+
+template <typename scalar_t>
+static MicroKernelFunc<scalar_t> GetMicroKernel() {
+#ifdef OPEN3D_MATMUL_AVX2
+    static const bool has_fma = __builtin_cpu_supports("fma");
+    if (utility::GetSIMDLevel() >= utility::SIMDLevel::AVX2 && has_fma) {
+        return MicroKernelAVX2<scalar_t>;
+    }
+#endif
+    return MicroKernel<scalar_t>;
+}
+
+/// Packs a[row_begin : row_begin + mc, col_begin : col_begin + kc] into
+/// slivers of kMR rows. Each sliver is stored column by column and
+/// zero-padded to kMR rows.
+template <typename scalar_t>
+static void PackLhs(const MatrixRef<const scalar_t>& a,
+                    int64_t row_begin,
+                    int64_t mc,
+                    int64_t col_begin,
+                    int64_t kc,
+                    scalar_t* pack) {
+    for (int64_t is = 0; is < mc; is += kMR) {
+        int64_t mr = std::min(kMR, mc - is);
+        for (int64_t p = 0; p < kc; ++p) {
+            for (int64_t i = 0; i < kMR; ++i) {
+                *pack++ = i < mr ? a(row_begin + is + i, col_begin + p)
+                                 : scalar_t(0);
+            }
+        }
+    }
+}
+
+/// Packs b[row_begin : row_begin + kc, col_begin : col_begin + nc] into
+/// slivers of kNR columns. Each sliver is stored row by row and zero-padded to
+/// kNR columns.
+template <typename scalar_t>
+static void PackRhs(const MatrixRef<const scalar_t>& b,
+                    int64_t row_begin,
+                    int64_t kc,
+                    int64_t col_begin,
+                    int64_t nc,
+                    scalar_t* pack) {
+    for (int64_t js = 0; js < nc; js += kNR) {
+        int64_t nr = std::min(kNR, nc - js);
+        for (int64_t p = 0; p < kc; ++p) {
+            for (int64_t j = 0; j < kNR; ++j) {
+                *pack++ = j < nr ? b(row_begin + p, col_begin + js + j)
+                                 : scalar_t(0);
+            }
+        }
+    }
+}
+
+/// Computes the block c[row_begin : row_begin + mc, col_begin : col_begin +
+/// nc] of c = a @ b with packed panels.
+template <typename scalar_t>
+static void GemmBlocked(const MatrixRef<const scalar_t>& a,
+                        const MatrixRef<const scalar_t>& b,
+                        const MatrixRef<scalar_t>& c,
+                        int64_t k,
+                        int64_t row_begin,
+                        int64_t mc,
+                        int64_t col_begin,
+                        int64_t nc,
+                        MicroKernelFunc<scalar_t> micro_kernel) {
+    // Reused across calls in the same thread.
+    static thread_local std::vector<scalar_t> a_pack;
+    static thread_local std::vector<scalar_t> b_pack;
+    a_pack.resize(kMC * kKC);
+    b_pack.resize(kKC * ((kNC + kNR - 1) / kNR * kNR));
+
+    scalar_t tile[kMR * kNR];
+    for (int64_t p0 = 0; p0 < k; p0 += kKC) {
+        int64_t kc = std::min(kKC, k - p0);
+        PackRhs(b, p0, kc, col_begin, nc, b_pack.data());
+        PackLhs(a, row_begin, mc, p0, kc, a_pack.data());
+        for (int64_t js = 0; js < nc; js += kNR) {
+            int64_t nr = std::min(kNR, nc - js);
+            for (int64_t is = 0; is < mc; is += kMR) {
+                int64_t mr = std::min(kMR, mc - is);
+                micro_kernel(kc, a_pack.data() + is * kc,
+                             b_pack.data() + js * kc, tile);
+                for (int64_t i = 0; i < mr; ++i) {
+                    for (int64_t j = 0; j < nr; ++j) {
+                        scalar_t& dst =
+                                c(row_begin + is + i, col_begin + js + j);
+                        dst = (p0 == 0 ? scalar_t(0) : dst) +
+                              tile[i * kNR + j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Computes rows [row_begin, row_end) of c = a @ b without packing the lhs.
+/// \p b_dense is b copied to a dense row-major k x n buffer.
+template <typename scalar_t>
+static void GemmDirect(const MatrixRef<const scalar_t>& a,
+                       const scalar_t* b_dense,
+                       const MatrixRef<scalar_t>& c,
+                       int64_t n,
+                       int64_t k,
+                       int64_t row_begin,
+                       int64_t row_end) {
+    for (int64_t i = row_begin; i < row_end; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t acc = 0;
+            for (int64_t p = 0; p < k; ++p) {
+                acc += a(i, p) * b_dense[p * n + j];
+            }
+            c(i, j) = acc;
+        }
+    }
+}
+
+/// GemmDirect() with n and k known at compile time, so that the rhs and the
+/// lhs row are kept in registers.
+template <typename scalar_t, int64_t N, int64_t K>
+static void GemmDirectFixed(const MatrixRef<const scalar_t>& a,
+                            const scalar_t* b_dense,
+                            const MatrixRef<scalar_t>& c,
+                            int64_t,
+                            int64_t,
+                            int64_t row_begin,
+                            int64_t row_end) {
+    scalar_t b[K * N];
+    for (int64_t i = 0; i < K * N; ++i) {
+        b[i] = b_dense[i];
+    }
+    for (int64_t i = row_begin; i < row_end; ++i) {
+        scalar_t a_row[K];
+        for (int64_t p = 0; p < K; ++p) {
+            a_row[p] = a(i, p);
+        }
+        for (int64_t j = 0; j < N; ++j) {
+            scalar_t acc = 0;
+            for (int64_t p = 0; p < K; ++p) {
+                acc += a_row[p] * b[p * N + j];
+            }
+            c(i, j) = acc;
+        }
+    }
+}
+
+template <typename scalar_t>
+using GemmDirectFunc = void (*)(const MatrixRef<const scalar_t>&,
+                                const scalar_t*,
+                                const MatrixRef<scalar_t>&,
+                                int64_t,
+                                int64_t,
+                                int64_t,
+                                int64_t);
+
+// Largest n and k with a GemmDirectFixed() instantiation.
+static constexpr int64_t kMaxFixedSize = 4;
+
+/// Returns GemmDirectFixed() for small n and k, e.g. for N x 3 points times a
+/// 3 x 3 rotation, and GemmDirect() otherwise.
+template <typename scalar_t>
+static GemmDirectFunc<scalar_t> GetGemmDirect(int64_t n, int64_t k) {
+    static const GemmDirectFunc<scalar_t> fixed[kMaxFixedSize][kMaxFixedSize] =
+            {{GemmDirectFixed<scalar_t, 1, 1>, GemmDirectFixed<scalar_t, 1, 2>,
+              GemmDirectFixed<scalar_t, 1, 3>, GemmDirectFixed<scalar_t, 1, 4>},
+             {GemmDirectFixed<scalar_t, 2, 1>, GemmDirectFixed<scalar_t, 2, 2>,
+              GemmDirectFixed<scalar_t, 2, 3>, GemmDirectFixed<scalar_t, 2, 4>},
+             {GemmDirectFixed<scalar_t, 3, 1>, GemmDirectFixed<scalar_t, 3, 2>,
+              GemmDirectFixed<scalar_t, 3, 3>, GemmDirectFixed<scalar_t, 3, 4>},
+             {GemmDirectFixed<scalar_t, 4, 1>, GemmDirectFixed<scalar_t, 4, 2>,
+              GemmDirectFixed<scalar_t, 4, 3>,
+              GemmDirectFixed<scalar_t, 4, 4>}};
+    if (n >= 1 && n <= kMaxFixedSize && k >= 1 && k <= kMaxFixedSize) {
+        return fixed[n - 1][k - 1];
+    }
+    return GemmDirect<scalar_t>;
+}
+
+#ifdef OPEN3D_USE_BLAS
+/// Returns true if a rows x cols matrix with the given strides can be passed
+/// to cblas, along with its transpose flag and leading dimension.
+static bool GetBlasLayout(int64_t rows,
+                          int64_t cols,
+                          int64_t row_stride,
+                          int64_t col_stride,
+                          CBLAS_TRANSPOSE& trans,
+                          int64_t& ld) {
+    // Row-major, the stride of a size-1 dimension is irrelevant.
+    if ((cols == 1 || col_stride == 1) &&
+        (rows == 1 || row_stride >= std::max<int64_t>(cols, 1))) {
+        trans = CblasNoTrans;
+        ld = rows == 1 ? std::max<int64_t>(cols, 1) : row_stride;
+        return ld <= std::numeric_limits<int>::max();
+    }
+    // Column-major.
+    if ((rows == 1 || row_stride == 1) &&
+        (cols == 1 || col_stride >= std::max<int64_t>(rows, 1))) {
+        trans = CblasTrans;
+        ld = cols == 1 ? std::max<int64_t>(rows, 1) : col_stride;
+        return ld <= std::numeric_limits<int>::max();
+    }
+    return false;
+}
+
+static void BlasGemm(CBLAS_TRANSPOSE trans_a,
+                     CBLAS_TRANSPOSE trans_b,
+                     int m,
+                     int n,
+                     int k,
+                     const float* a,
+                     int lda,
+                     const float* b,
+                     int ldb,
+                     float* c,
+                     int ldc) {
+    cblas_sgemm(CblasRowMajor, trans_a, trans_b, m, n, k, 1.f, a, lda, b, ldb,
+                0.f, c, ldc);
+}
+
+static void BlasGemm(CBLAS_TRANSPOSE trans_a,
+                     CBLAS_TRANSPOSE trans_b,
+                     int m,
+                     int n,
+                     int k,
+                     const double* a,
+                     int lda,
+                     const double* b,
+                     int ldb,
+                     double* c,
+                     int ldc) {
+    cblas_dgemm(CblasRowMajor, trans_a, trans_b, m, n, k, 1., a, lda, b, ldb,
+                0., c, ldc);
+}
+
+template <typename scalar_t>
+struct IsBlasScalar
+    : std::integral_constant<bool,
+                             std::is_same<scalar_t, float>::value ||
+                                     std::is_same<scalar_t, double>::value> {};
+
+/// Runs all batches through BLAS. Returns false if the dtype or the strides
+/// are not supported by BLAS.
+template <typename scalar_t,
+          typename std::enable_if<!IsBlasScalar<scalar_t>::value,
+                                  int>::type = 0>
+static bool TryBlasMatmul(const std::vector<MatrixRef<const scalar_t>>&,
+                          const std::vector<MatrixRef<const scalar_t>>&,
+                          const std::vector<MatrixRef<scalar_t>>&,
+                          int64_t,
+                          int64_t,
+                          int64_t) {
+    return false;
+}
+
+template <typename scalar_t,
+          typename std::enable_if<IsBlasScalar<scalar_t>::value, int>::type = 0>
+static bool TryBlasMatmul(const std::vector<MatrixRef<const scalar_t>>& as,
+                          const std::vector<MatrixRef<const scalar_t>>& bs,
+                          const std::vector<MatrixRef<scalar_t>>& cs,
+                          int64_t m,
+                          int64_t n,
+                          int64_t k) {
+    const int64_t int_max = std::numeric_limits<int>::max();
+    if (m == 0 || n == 0 || k == 0 || m > int_max || n > int_max ||
+        k > int_max) {
+        return false;
+    }
+    std::vector<CBLAS_TRANSPOSE> trans_as(as.size()), trans_bs(as.size());
+    std::vector<int64_t> ldas(as.size()), ldbs(as.size()), ldcs(as.size());
+    for (size_t i = 0; i < as.size(); ++i) {
+        CBLAS_TRANSPOSE trans_c;
+        if (!GetBlasLayout(m, k, as[i].row_stride_, as[i].col_stride_,
+                           trans_as[i], ldas[i]) ||
+            !GetBlasLayout(k, n, bs[i].row_stride_, bs[i].col_stride_,
+                           trans_bs[i], ldbs[i]) ||
+            !GetBlasLayout(m, n, cs[i].row_stride_, cs[i].col_stride_,
+                           trans_c, ldcs[i]) ||
+            trans_c != CblasNoTrans) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < as.size(); ++i) {
+        BlasGemm(trans_as[i], trans_bs[i], int(m), int(n), int(k),
+                 as[i].data_, int(ldas[i]), bs[i].data_, int(ldbs[i]),
+                 cs[i].data_, int(ldcs[i]));
+    }
+    return true;
+}
+#endif
+
+template <typename scalar_t>
+static void MatmulCPUImpl(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    const int64_t ndims = dst.NumDims();
+    int64_t m = lhs.GetShape(ndims - 2);
+    int64_t k = lhs.GetShape(ndims - 1);
+    int64_t n = rhs.GetShape(ndims - 1);
+    const int64_t num_batches = dst.NumElements() / (m * n);
+
+    // Matrix views of each batch.
+    std::vector<MatrixRef<const scalar_t>> as(num_batches);
+    std::vector<MatrixRef<const scalar_t>> bs(num_batches);
+    std::vector<MatrixRef<scalar_t>> cs(num_batches);
+    for (int64_t batch = 0; batch < num_batches; ++batch) {
+        int64_t a_offset = 0;
+        int64_t b_offset = 0;
+        int64_t c_offset = 0;
+        int64_t idx = batch;
+        for (int64_t d = ndims - 3; d >= 0; --d) {
+            int64_t i = idx % dst.GetShape(d);
+            idx /= dst.GetShape(d);
+            a_offset += i * lhs.GetStride(d);
+            b_offset += i * rhs.GetStride(d);
+            c_offset += i * dst.GetStride(d);
+        }
+        as[batch] = {static_cast<const scalar_t*>(lhs.GetDataPtr()) + a_offset,
+                     lhs.GetStride(ndims - 2), lhs.GetStride(ndims - 1)};
+        bs[batch] = {static_cast<const scalar_t*>(rhs.GetDataPtr()) + b_offset,
+                     rhs.GetStride(ndims - 2), rhs.GetStride(ndims - 1)};
+        cs[batch] = {static_cast<scalar_t*>(dst.GetDataPtr()) + c_offset,
+                     dst.GetStride(ndims - 2), dst.GetStride(ndims - 1)};
+    }
+
+    const int64_t flops = m * n * k;
+#ifdef OPEN3D_USE_BLAS
+    if (flops >= kMinBlockedFlops &&
+        TryBlasMatmul<scalar_t>(as, bs, cs, m, n, k)) {
+        return;
+    }
+#endif
+
+    // For other thin products, e.g. projecting N x 32 features to N x 3,
+    // compute c^T = b^T a^T instead, so that the long dimension is vectorized
+    // by the micro-kernel.
+    const bool fixed_size = n <= kMaxFixedSize && k <= kMaxFixedSize;
+    if (!fixed_size && n < kNR && m > n) {
+        for (int64_t batch = 0; batch < num_batches; ++batch) {
+            MatrixRef<const scalar_t> a = as[batch];
+            as[batch] = {bs[batch].data_, bs[batch].col_stride_,
+                         bs[batch].row_stride_};
+            bs[batch] = {a.data_, a.col_stride_, a.row_stride_};
+            cs[batch] = {cs[batch].data_, cs[batch].col_stride_,
+                         cs[batch].row_stride_};
+        }
+        std::swap(m, n);
+    }
+
+    // A cap of one thread keeps small products on the calling thread.
+    const int max_threads = num_batches * flops >= kMinParallelFlops ? 0 : 1;
+    if (!fixed_size && flops >= kMinBlockedFlops && n >= kNR) {
+        MicroKernelFunc<scalar_t> micro_kernel = GetMicroKernel<scalar_t>();
+        const int64_t row_blocks = (m + kMC - 1) / kMC;
+        const int64_t col_blocks = (n + kNC - 1) / kNC;
+        const int64_t blocks_per_batch = row_blocks * col_blocks;
+        utility::ParallelForEach(
+                0, num_batches * blocks_per_batch,
+                [&](int64_t item) {
+                    int64_t batch = item / blocks_per_batch;
+                    int64_t row_begin =
+                            item % blocks_per_batch / col_blocks * kMC;
+                    int64_t col_begin = item % col_blocks * kNC;
+                    GemmBlocked(as[batch], bs[batch], cs[batch], k, row_begin,
+                                std::min(kMC, m - row_begin), col_begin,
+                                std::min(kNC, n - col_begin), micro_kernel);
+                },
+                1, max_threads);
+    } else {
+        // Small products, e.g. transforming N x 3 points or batches of 4 x 4
+        // transformations. The rows of all batches are split into work items.
+        const int64_t rows_per_item = std::max(
+                int64_t(1), kMinParallelFlops / std::max(int64_t(1), n * k));
+        const int64_t items_per_batch = (m + rows_per_item - 1) / rows_per_item;
+        GemmDirectFunc<scalar_t> gemm_direct = GetGemmDirect<scalar_t>(n, k);
+        std::vector<scalar_t> b_dense(num_batches * k * n);
+        for (int64_t batch = 0; batch < num_batches; ++batch) {
+            for (int64_t p = 0; p < k; ++p) {
+                for (int64_t j = 0; j < n; ++j) {
+                    b_dense[(batch * k + p) * n + j] = bs[batch](p, j);
+                }
+            }
+        }
+        utility::ParallelForEach(
+                0, num_batches * items_per_batch,
+                [&](int64_t item) {
+                    int64_t batch = item / items_per_batch;
+                    int64_t row_begin = item % items_per_batch * rows_per_item;
+                    gemm_direct(as[batch], b_dense.data() + batch * k * n,
+                                cs[batch], n, k, row_begin,
+                                std::min(m, row_begin + rows_per_item));
+                },
+                1, max_threads);
+    }
+}
+
+void MatmulCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    if (dst.NumElements() == 0) {
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        MatmulCPUImpl<scalar_t>(lhs, rhs, dst);
+    });
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -56,6 +56,17 @@ void Reduction(const Tensor& src,
         }
     }
 
+    if (float_reduce_ops.find(op_code) != float_reduce_ops.end()) {
+        if (src.GetDtype() != Dtype::Float16 &&
+            src.GetDtype() != Dtype::Float32 &&
+            src.GetDtype() != Dtype::Float64) {
+            utility::LogError(
+                    "Mean, Var and Std only support Float16, Float32 and "
+                    "Float64, but {} is used.",
+                    DtypeUtil::ToString(src.GetDtype()));
+        }
+    }
+
     SizeVector keepdim_shape =
             shape_util::ReductionShape(src.GetShape(), dims, true);
     SizeVector non_keepdim_shape =
@@ -69,9 +80,14 @@ void Reduction(const Tensor& src,
                           keepdim_shape.ToString(), dst.GetShape().ToString());
     }
 
-    // Directly copy for non-reduction.
+    // Directly copy for non-reduction. The variance of a single element is 0.
     if (dims.size() == 0) {
-        dst.AsRvalue() = src;
+        if (op_code == ReductionOpCode::Var ||
+            op_code == ReductionOpCode::Std) {
+            dst.Fill(0);
+        } else {
+            dst.AsRvalue() = src;
+        }
         return;
     }
 
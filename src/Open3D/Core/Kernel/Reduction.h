@@ -36,13 +36,30 @@
 namespace open3d {
 namespace kernel {
 
-enum class ReductionOpCode { Sum, Prod, Min, Max, ArgMin, ArgMax };
+enum class ReductionOpCode {
+    Sum,
+    Prod,
+    Min,
+    Max,
+    ArgMin,
+    ArgMax,
+    Mean,
+    Var,
+    Std,
+    Any,
+    All,
+};
 
 static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
         regular_reduce_ops = {ReductionOpCode::Sum, ReductionOpCode::Prod,
                               ReductionOpCode::Min, ReductionOpCode::Max};
 static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
         arg_reduce_ops = {ReductionOpCode::ArgMin, ReductionOpCode::ArgMax};
+static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
+        float_reduce_ops = {ReductionOpCode::Mean, ReductionOpCode::Var,
+                            ReductionOpCode::Std};
+static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
+        boolean_reduce_ops = {ReductionOpCode::Any, ReductionOpCode::All};
 
 void Reduction(const Tensor& src,
                Tensor& dst,
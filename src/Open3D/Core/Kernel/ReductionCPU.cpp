@@ -26,302 +26,744 @@
 
 #include "Open3D/Core/Kernel/Reduction.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "Open3D/Core/Dispatch.h"
-#include "Open3D/Core/Indexer.h"
 #include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace kernel {
 
+// Each reduction op defines:
+// - acc_t: the accumulator type.
+// - Identity(): the accumulator of an empty reduction.
+// - Reduce(acc, val, idx): accumulates val, the idx-th element in the
+//   flattened reduction dimensions.
+// - Combine(a, b): merges two partial accumulators.
+// - Project(acc, num_reduced, dst): writes the final value to dst.
+//
+// The engine splits a reduction into independent partial reductions in any
+// order, so Combine must not depend on which partial result came first.
+
+/// Scalar type used to accumulate sums and products of scalar_t. Float16 is
+/// accumulated in float, since its 11-bit mantissa stops absorbing increments
+/// after a few thousand elements.
 template <typename scalar_t>
-static inline scalar_t CPUSumReductionKernel(scalar_t src, scalar_t dst) {
-    return src + dst;
-}
+struct AccScalar {
+    using type = scalar_t;
+};
+template <>
+struct AccScalar<Half> {
+    using type = float;
+};
 
 template <typename scalar_t>
-static inline scalar_t CPUProdReductionKernel(scalar_t src, scalar_t dst) {
-    return src * dst;
-}
+struct SumReductionOp {
+    using acc_t = typename AccScalar<scalar_t>::type;
+    acc_t Identity() const { return 0; }
+    acc_t Reduce(acc_t acc, scalar_t val, int64_t) const { return acc + val; }
+    acc_t Combine(acc_t a, acc_t b) const { return a + b; }
+    acc_t Value(acc_t acc) const { return acc; }
+    void Project(acc_t acc, int64_t, void* dst) const {
+        *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(Value(acc));
+    }
+};
 
+/// Kahan-compensated sum. The true sum is sum_ - c_.
 template <typename scalar_t>
-static inline scalar_t CPUMinReductionKernel(scalar_t src, scalar_t dst) {
-    return std::min(src, dst);
-}
+struct KahanAcc {
+    scalar_t sum_;
+    scalar_t c_;
+};
 
+/// Float32 sums accumulate many millions of points in practice, where a plain
+/// float accumulator loses most of its precision. The branchless Kahan update
+/// keeps the lanes vectorizable.
 template <typename scalar_t>
-static inline scalar_t CPUMaxReductionKernel(scalar_t src, scalar_t dst) {
-    return std::max(src, dst);
-}
+struct KahanSumReductionOp {
+    using acc_scalar_t = typename AccScalar<scalar_t>::type;
+    using acc_t = KahanAcc<acc_scalar_t>;
+    acc_t Identity() const { return {0, 0}; }
+    acc_t Reduce(acc_t acc, acc_scalar_t val, int64_t) const {
+        acc_scalar_t y = val - acc.c_;
+        acc_scalar_t t = acc.sum_ + y;
+        acc.c_ = (t - acc.sum_) - y;
+        acc.sum_ = t;
+        return acc;
+    }
+    acc_t Combine(acc_t a, acc_t b) const {
+        acc_t acc = Reduce(a, b.sum_, 0);
+        acc.c_ += b.c_;
+        return acc;
+    }
+    acc_scalar_t Value(acc_t acc) const { return acc.sum_ - acc.c_; }
+    void Project(acc_t acc, int64_t, void* dst) const {
+        *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(Value(acc));
+    }
+};
 
+/// Selects the summation op for a dtype.
 template <typename scalar_t>
-static inline std::pair<int64_t, scalar_t> CPUArgMinReductionKernel(
-        int64_t a_idx, scalar_t a, int64_t b_idx, scalar_t b) {
-    if (a < b) {
-        return {a_idx, a};
-    } else {
-        return {b_idx, b};
+struct SumOpSelector {
+    using type = SumReductionOp<scalar_t>;
+};
+template <>
+struct SumOpSelector<float> {
+    using type = KahanSumReductionOp<float>;
+};
+template <>
+struct SumOpSelector<Half> {
+    using type = KahanSumReductionOp<Half>;
+};
+
+/// The mean is taken from the accumulator directly, so that Float16 sums
+/// beyond the Float16 range still produce a finite mean.
+template <typename scalar_t>
+struct MeanReductionOp : public SumOpSelector<scalar_t>::type {
+    using Base = typename SumOpSelector<scalar_t>::type;
+    using acc_t = typename Base::acc_t;
+    void Project(acc_t acc, int64_t num_reduced, void* dst) const {
+        using acc_scalar_t = typename AccScalar<scalar_t>::type;
+        *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
+                num_reduced == 0
+                        ? std::numeric_limits<acc_scalar_t>::quiet_NaN()
+                        : Base::Value(acc) /
+                                  static_cast<acc_scalar_t>(num_reduced));
     }
-}
+};
 
 template <typename scalar_t>
-static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
-        int64_t a_idx, scalar_t a, int64_t b_idx, scalar_t b) {
-    if (a > b) {
-        return {a_idx, a};
-    } else {
-        return {b_idx, b};
+struct ProdReductionOp {
+    using acc_t = typename AccScalar<scalar_t>::type;
+    acc_t Identity() const { return 1; }
+    acc_t Reduce(acc_t acc, scalar_t val, int64_t) const { return acc * val; }
+    acc_t Combine(acc_t a, acc_t b) const { return a * b; }
+    void Project(acc_t acc, int64_t, void* dst) const {
+        *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(acc);
     }
-}
+};
 
-class CPUReductionEngine {
-public:
-    CPUReductionEngine(const CPUReductionEngine&) = delete;
-    CPUReductionEngine& operator=(const CPUReductionEngine&) = delete;
-    CPUReductionEngine(const Indexer& indexer) : indexer_(indexer) {}
-
-    template <typename func_t, typename scalar_t>
-    void Run(const func_t& reduce_func, scalar_t identity) {
-        // See: PyTorch's TensorIterator::parallel_reduce for the reference
-        // design of reduction strategy.
-        if (parallel_util::GetMaxThreads() == 1 ||
-            parallel_util::InParallel()) {
-            LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
-        } else if (indexer_.NumOutputElements() <= 1) {
-            LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
-                                                   identity);
-        } else {
-            LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
-        }
+template <typename scalar_t>
+struct MinReductionOp {
+    using acc_t = scalar_t;
+    acc_t Identity() const {
+        return std::numeric_limits<scalar_t>::has_infinity
+                       ? std::numeric_limits<scalar_t>::infinity()
+                       : std::numeric_limits<scalar_t>::max();
+    }
+    acc_t Reduce(acc_t acc, scalar_t val, int64_t) const {
+        return val < acc ? val : acc;
     }
+    acc_t Combine(acc_t a, acc_t b) const { return b < a ? b : a; }
+    void Project(acc_t acc, int64_t, void* dst) const {
+        *static_cast<scalar_t*>(dst) = acc;
+    }
+};
 
-private:
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelSerial(const Indexer& indexer,
-                                            func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            scalar_t* src = reinterpret_cast<scalar_t*>(
-                    indexer.GetInputPtr(0, workload_idx));
-            scalar_t* dst = reinterpret_cast<scalar_t*>(
-                    indexer.GetOutputPtr(workload_idx));
-            *dst = element_kernel(*src, *dst);
-        }
+template <typename scalar_t>
+struct MaxReductionOp {
+    using acc_t = scalar_t;
+    acc_t Identity() const {
+        return std::numeric_limits<scalar_t>::has_infinity
+                       ? -std::numeric_limits<scalar_t>::infinity()
+                       : std::numeric_limits<scalar_t>::lowest();
+    }
+    acc_t Reduce(acc_t acc, scalar_t val, int64_t) const {
+        return val > acc ? val : acc;
     }
+    acc_t Combine(acc_t a, acc_t b) const { return b > a ? b : a; }
+    void Project(acc_t acc, int64_t, void* dst) const {
+        *static_cast<scalar_t*>(dst) = acc;
+    }
+};
 
-    /// Create num_threads workers to compute partial reductions and then reduce
-    /// to the final results. This only applies to reduction op with one output.
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelTwoPass(const Indexer& indexer,
-                                             func_t element_kernel,
-                                             scalar_t identity) {
-        if (indexer.NumOutputElements() > 1) {
-            utility::LogError(
-                    "Internal error: two-pass reduction only works for "
-                    "single-output reduction ops.");
+template <typename scalar_t>
+struct ArgAcc {
+    scalar_t val_;
+    int64_t idx_;  // -1 for the empty accumulator.
+};
+
+/// Arg-reduction returning the first index of the min (or max) value. \p
+/// Less returns true if the first value should be preferred.
+template <typename scalar_t, typename Less>
+struct ArgReductionOp {
+    using acc_t = ArgAcc<scalar_t>;
+    acc_t Identity() const { return {scalar_t(0), -1}; }
+    acc_t Reduce(acc_t acc, scalar_t val, int64_t idx) const {
+        if (acc.idx_ < 0 || Less()(val, acc.val_)) {
+            acc.val_ = val;
+            acc.idx_ = idx;
         }
-        int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = parallel_util::GetMaxThreads();
-        int64_t workload_per_thread =
-                (num_workloads + num_threads - 1) / num_threads;
-        std::vector<scalar_t> thread_results(num_threads, identity);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
-            }
+        return acc;
+    }
+    acc_t Combine(acc_t a, acc_t b) const {
+        if (b.idx_ < 0) {
+            return a;
+        } else if (a.idx_ < 0 || Less()(b.val_, a.val_) ||
+                   (!Less()(a.val_, b.val_) && b.idx_ < a.idx_)) {
+            return b;
+        } else {
+            return a;
         }
-        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            *dst = element_kernel(thread_results[thread_idx], *dst);
+    }
+    void Project(acc_t acc, int64_t, void* dst) const {
+        *static_cast<int64_t*>(dst) = acc.idx_;
+    }
+};
+
+template <typename scalar_t>
+using ArgMinReductionOp = ArgReductionOp<scalar_t, std::less<scalar_t>>;
+
+template <typename scalar_t>
+using ArgMaxReductionOp = ArgReductionOp<scalar_t, std::greater<scalar_t>>;
+
+/// Writes a bool: whether any (or all) of the values are non-zero.
+template <typename scalar_t, bool is_all>
+struct LogicalReductionOp {
+    using acc_t = bool;
+    acc_t Identity() const { return is_all; }
+    acc_t Reduce(acc_t acc, scalar_t val, int64_t) const {
+        return is_all ? (acc && static_cast<bool>(val))
+                      : (acc || static_cast<bool>(val));
+    }
+    acc_t Combine(acc_t a, acc_t b) const {
+        return is_all ? (a && b) : (a || b);
+    }
+    void Project(acc_t acc, int64_t, void* dst) const {
+        *static_cast<bool*>(dst) = acc;
+    }
+};
+
+/// Welford's running mean and sum of squared deviations, in double.
+struct WelfordAcc {
+    double mean_;
+    double m2_;
+    int64_t count_;
+};
+
+/// Population variance (or standard deviation). Partial results are merged
+/// with Chan et al.'s parallel update.
+template <typename scalar_t, bool is_std>
+struct VarianceReductionOp {
+    using acc_t = WelfordAcc;
+    acc_t Identity() const { return {0, 0, 0}; }
+    acc_t Reduce(acc_t acc, scalar_t val, int64_t) const {
+        double x = static_cast<double>(val);
+        acc.count_++;
+        double delta = x - acc.mean_;
+        acc.mean_ += delta / static_cast<double>(acc.count_);
+        acc.m2_ += delta * (x - acc.mean_);
+        return acc;
+    }
+    acc_t Combine(acc_t a, acc_t b) const {
+        if (a.count_ == 0) {
+            return b;
+        } else if (b.count_ == 0) {
+            return a;
         }
+        double count = static_cast<double>(a.count_ + b.count_);
+        double delta = b.mean_ - a.mean_;
+        double b_ratio = static_cast<double>(b.count_) / count;
+        acc_t acc;
+        acc.mean_ = a.mean_ + delta * b_ratio;
+        acc.m2_ = a.m2_ + b.m2_ +
+                  delta * delta * static_cast<double>(a.count_) * b_ratio;
+        acc.count_ = a.count_ + b.count_;
+        return acc;
     }
+    void Project(acc_t acc, int64_t, void* dst) const {
+        double var = acc.count_ == 0
+                             ? std::numeric_limits<double>::quiet_NaN()
+                             : acc.m2_ / static_cast<double>(acc.count_);
+        *static_cast<scalar_t*>(dst) =
+                static_cast<scalar_t>(is_std ? std::sqrt(var) : var);
+    }
+};
 
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionParallelDim(const Indexer& indexer,
-                                           func_t element_kernel) {
-        // Prefers outer dimension >= num_threads.
-        const int64_t* indexer_shape = indexer.GetMasterShape();
-        const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = parallel_util::GetMaxThreads();
+/// The reduction in canonical form. Dimensions of size 1 are dropped and
+/// adjacent dimensions of the same kind (kept or reduced) are merged when their
+/// strides allow it. Both lists keep the original dimension order, so the
+/// flattened index into the reduced dimensions is the row-major index that
+/// arg-reductions return.
+class CPUReductionLayout {
+public:
+    struct Dim {
+        int64_t size_;
+        int64_t src_byte_stride_;
+        int64_t dst_byte_stride_;
+    };
 
-        // Init best_dim as the outer-most non-reduction dim.
-        int64_t best_dim = num_dims - 1;
-        while (best_dim >= 0 && indexer.IsReductionDim(best_dim)) {
-            best_dim--;
+    CPUReductionLayout(const Tensor& src,
+                       const Tensor& dst,
+                       const SizeVector& dims) {
+        int64_t ndims = src.NumDims();
+        std::vector<bool> is_reduced(ndims, false);
+        for (int64_t dim : dims) {
+            is_reduced[shape_util::WrapDim(dim, ndims)] = true;
         }
-        for (int64_t dim = best_dim; dim >= 0 && !indexer.IsReductionDim(dim);
-             --dim) {
-            if (indexer_shape[dim] >= num_threads) {
-                best_dim = dim;
-                break;
-            } else if (indexer_shape[dim] > indexer_shape[best_dim]) {
-                best_dim = dim;
+        src_ptr_ = static_cast<const char*>(src.GetDataPtr());
+        dst_ptr_ = static_cast<char*>(const_cast<void*>(dst.GetDataPtr()));
+        src_byte_size_ = DtypeUtil::ByteSize(src.GetDtype());
+        int64_t dst_byte_size = DtypeUtil::ByteSize(dst.GetDtype());
+
+        bool last_reduced = false;
+        for (int64_t d = 0; d < ndims; ++d) {
+            if (src.GetShape(d) == 1) {
+                continue;
+            }
+            Dim dim{src.GetShape(d), src.GetStride(d) * src_byte_size_,
+                    is_reduced[d] ? 0 : dst.GetStride(d) * dst_byte_size};
+            std::vector<Dim>& group =
+                    is_reduced[d] ? reduced_dims_ : kept_dims_;
+            if (!group.empty() && last_reduced == is_reduced[d] &&
+                group.back().src_byte_stride_ ==
+                        dim.size_ * dim.src_byte_stride_ &&
+                group.back().dst_byte_stride_ ==
+                        dim.size_ * dim.dst_byte_stride_) {
+                group.back().size_ *= dim.size_;
+                group.back().src_byte_stride_ = dim.src_byte_stride_;
+                group.back().dst_byte_stride_ = dim.dst_byte_stride_;
+            } else {
+                group.push_back(dim);
             }
+            last_reduced = is_reduced[d];
         }
-        if (best_dim == -1) {
-            utility::LogError(
-                    "Internal error: all dims are reduction dims, use "
-                    "LaunchReductionKernelTwoPass instead.");
+
+        num_outputs_ = 1;
+        for (const Dim& dim : kept_dims_) {
+            num_outputs_ *= dim.size_;
+        }
+        num_reduced_ = 1;
+        for (const Dim& dim : reduced_dims_) {
+            num_reduced_ *= dim.size_;
         }
+    }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+    /// Returns the byte offsets of the \p idx -th (row-major) element of \p
+    /// dims in src and dst.
+    static void GetOffsets(const std::vector<Dim>& dims,
+                           int64_t num_dims,
+                           int64_t idx,
+                           int64_t& src_offset,
+                           int64_t& dst_offset) {
+        src_offset = 0;
+        dst_offset = 0;
+        for (int64_t d = num_dims - 1; d >= 0; --d) {
+            int64_t i = idx % dims[d].size_;
+            idx /= dims[d].size_;
+            src_offset += i * dims[d].src_byte_stride_;
+            dst_offset += i * dims[d].dst_byte_stride_;
         }
     }
 
-private:
-    Indexer indexer_;
+    const char* src_ptr_;
+    char* dst_ptr_;
+    int64_t src_byte_size_;
+    std::vector<Dim> kept_dims_;
+    std::vector<Dim> reduced_dims_;
+    int64_t num_outputs_;
+    int64_t num_reduced_;
 };
 
-class CPUArgReductionEngine {
+/// Number of independent accumulators for a single output.
+static constexpr int64_t kNumLanes = 8;
+/// Maximum number of outputs reduced together.
+static constexpr int64_t kTileWidth = 64;
+/// Minimum number of reduced elements per parallel work item.
+static constexpr int64_t kMinChunkSize = 32768;
+
+/// Tiled reduction engine.
+///
+/// Outputs are grouped into tiles. If the innermost kept dimension is denser in
+/// memory than the innermost reduced dimension (e.g. Sum({0}) of an (N, 3)
+/// Tensor), a tile is a run of up to kTileWidth outputs along that dimension,
+/// which are updated together for each reduced element. Otherwise a tile is a
+/// single output, reduced over contiguous runs with kNumLanes independent
+/// accumulators. Both inner loops have no loop-carried dependency across
+/// accumulators, so the compiler can keep them in SIMD registers.
+///
+/// Tiles run in parallel. When there are fewer tiles than threads, the
+/// reduction dimensions are also split into chunks whose partial accumulators
+/// are combined in a second pass.
+template <typename scalar_t, typename Op>
+class CPUReductionEngine {
 public:
-    CPUArgReductionEngine(const CPUArgReductionEngine&) = delete;
-    CPUArgReductionEngine& operator=(const CPUArgReductionEngine&) = delete;
-    CPUArgReductionEngine(const Indexer& indexer) : indexer_(indexer) {}
-
-    template <typename func_t, typename scalar_t>
-    void Run(const func_t& reduce_func, scalar_t identity) {
-        // Arg-reduction needs to iterate each output element separatly in
-        // sub-iterations. Each output elemnent corresponds to multiple input
-        // elements. We need to keep track of the indices within each
-        // sub-iteration.
-        int64_t num_input_elements = indexer_.NumWorkloads();
-        int64_t num_output_elements = indexer_.NumOutputElements();
-        int64_t ipo =
-                num_input_elements / num_output_elements;  // Inputs per output
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
-            // sub_indexer.NumWorkloads() == ipo.
-            // sub_indexer's workload_idx is indexer_'s ipo_idx.
-            Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
-            scalar_t dst_val = identity;
-            for (int64_t workload_idx = 0;
-                 workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
-                int64_t src_idx = workload_idx;
-                scalar_t* src_val = reinterpret_cast<scalar_t*>(
-                        sub_indexer.GetInputPtr(0, workload_idx));
-                int64_t* dst_idx = reinterpret_cast<int64_t*>(
-                        sub_indexer.GetOutputPtr(0, workload_idx));
-                std::tie(*dst_idx, dst_val) =
-                        reduce_func(src_idx, *src_val, *dst_idx, dst_val);
+    using acc_t = typename Op::acc_t;
+
+    CPUReductionEngine(const CPUReductionLayout& layout, const Op& op)
+        : layout_(layout), op_(op) {}
+
+    void Run() const {
+        const std::vector<CPUReductionLayout::Dim>& kept = layout_.kept_dims_;
+        const std::vector<CPUReductionLayout::Dim>& reduced =
+                layout_.reduced_dims_;
+        if (layout_.num_outputs_ == 0) {
+            return;
+        }
+        int64_t inner_reduced_stride =
+                reduced.empty() ? 0
+                                : std::abs(reduced.back().src_byte_stride_);
+        bool tile_outputs =
+                !kept.empty() && !reduced.empty() &&
+                std::abs(kept.back().src_byte_stride_) < inner_reduced_stride;
+        int64_t tile_width =
+                tile_outputs ? std::min(kTileWidth, kept.back().size_) : 1;
+        int64_t tiles_per_row =
+                tile_outputs ? (kept.back().size_ + tile_width - 1) / tile_width
+                             : 1;
+        int64_t num_tiles = tile_outputs
+                                    ? layout_.num_outputs_ /
+                                              kept.back().size_ * tiles_per_row
+                                    : layout_.num_outputs_;
+
+        int64_t num_threads = parallel_util::GetMaxThreads();
+        bool parallel =
+                num_threads > 1 &&
+                layout_.num_outputs_ * layout_.num_reduced_ >= kMinChunkSize;
+        int64_t num_chunks = 1;
+        if (parallel && num_tiles < num_threads) {
+            num_chunks = std::min(
+                    (num_threads + num_tiles - 1) / num_tiles,
+                    std::max(int64_t(1),
+                             layout_.num_reduced_ / kMinChunkSize));
+        }
+        int64_t num_items = num_tiles * num_chunks;
+        int64_t chunk_size =
+                (layout_.num_reduced_ + num_chunks - 1) / num_chunks;
+
+        // Partial accumulators, only used when num_chunks > 1.
+        std::vector<acc_t> partials(num_chunks > 1 ? num_items * tile_width
+                                                   : 0);
+
+        auto reduce_item = [&](int64_t item) {
+            int64_t tile = item / num_chunks;
+            int64_t chunk = item % num_chunks;
+            int64_t r_begin =
+                    std::min(chunk * chunk_size, layout_.num_reduced_);
+            int64_t r_end =
+                    std::min(r_begin + chunk_size, layout_.num_reduced_);
+
+            acc_t accs[kTileWidth];
+            int64_t width;
+            const char* src_ptr;
+            char* dst_ptr;
+            int64_t dst_stride;
+            GetTile(tile, tile_outputs, tile_width, tiles_per_row, width,
+                    src_ptr, dst_ptr, dst_stride);
+            if (tile_outputs) {
+                ReduceTile(src_ptr, kept.back().src_byte_stride_, width,
+                           r_begin, r_end, accs);
+            } else {
+                accs[0] = ReduceSingle(src_ptr, r_begin, r_end);
+            }
+
+            if (num_chunks == 1) {
+                for (int64_t j = 0; j < width; ++j) {
+                    op_.Project(accs[j], layout_.num_reduced_,
+                                dst_ptr + j * dst_stride);
+                }
+            } else {
+                std::copy(accs, accs + width,
+                          partials.begin() + item * tile_width);
+            }
+        };
+        // Items have equal cost. A cap of one thread keeps small reductions on
+        // the calling thread.
+        utility::ParallelForEach(0, num_items, reduce_item, 1,
+                                 parallel ? 0 : 1);
+
+        if (num_chunks > 1) {
+            for (int64_t tile = 0; tile < num_tiles; ++tile) {
+                int64_t width;
+                const char* src_ptr;
+                char* dst_ptr;
+                int64_t dst_stride;
+                GetTile(tile, tile_outputs, tile_width, tiles_per_row, width,
+                        src_ptr, dst_ptr, dst_stride);
+                for (int64_t j = 0; j < width; ++j) {
+                    acc_t acc = partials[tile * num_chunks * tile_width + j];
+                    for (int64_t chunk = 1; chunk < num_chunks; ++chunk) {
+                        acc = op_.Combine(
+                                acc, partials[(tile * num_chunks + chunk) *
+                                                      tile_width +
+                                              j]);
+                    }
+                    op_.Project(acc, layout_.num_reduced_,
+                                dst_ptr + j * dst_stride);
+                }
             }
         }
     }
 
 private:
-    Indexer indexer_;
+    /// Returns the first src and dst element of \p tile, the number of outputs
+    /// in the tile and their dst stride.
+    void GetTile(int64_t tile,
+                 bool tile_outputs,
+                 int64_t tile_width,
+                 int64_t tiles_per_row,
+                 int64_t& width,
+                 const char*& src_ptr,
+                 char*& dst_ptr,
+                 int64_t& dst_stride) const {
+        const std::vector<CPUReductionLayout::Dim>& kept = layout_.kept_dims_;
+        int64_t src_offset;
+        int64_t dst_offset;
+        if (tile_outputs) {
+            const CPUReductionLayout::Dim& inner = kept.back();
+            int64_t row = tile / tiles_per_row;
+            int64_t start = (tile % tiles_per_row) * tile_width;
+            CPUReductionLayout::GetOffsets(kept, kept.size() - 1, row,
+                                           src_offset, dst_offset);
+            src_offset += start * inner.src_byte_stride_;
+            dst_offset += start * inner.dst_byte_stride_;
+            width = std::min(tile_width, inner.size_ - start);
+            dst_stride = inner.dst_byte_stride_;
+        } else {
+            CPUReductionLayout::GetOffsets(kept, kept.size(), tile, src_offset,
+                                           dst_offset);
+            width = 1;
+            dst_stride = 0;
+        }
+        src_ptr = layout_.src_ptr_ + src_offset;
+        dst_ptr = layout_.dst_ptr_ + dst_offset;
+    }
+
+    /// Calls \p func(row_ptr, start, size, r) for each contiguous run of
+    /// reduced elements [r, r + size) in [r_begin, r_end), where the run
+    /// begins at the start-th element of the innermost reduced dimension.
+    template <typename func_t>
+    void ForEachRun(const char* src_ptr,
+                    int64_t r_begin,
+                    int64_t r_end,
+                    func_t func) const {
+        const std::vector<CPUReductionLayout::Dim>& reduced =
+                layout_.reduced_dims_;
+        int64_t inner_size = reduced.back().size_;
+        int64_t r = r_begin;
+        while (r < r_end) {
+            int64_t start = r % inner_size;
+            int64_t size = std::min(inner_size - start, r_end - r);
+            int64_t outer_offset;
+            int64_t unused;
+            CPUReductionLayout::GetOffsets(reduced, reduced.size() - 1,
+                                           r / inner_size, outer_offset,
+                                           unused);
+            func(src_ptr + outer_offset, start, size, r);
+            r += size;
+        }
+    }
+
+    /// Reduces the elements [r_begin, r_end) of a single output.
+    acc_t ReduceSingle(const char* src_ptr,
+                       int64_t r_begin,
+                       int64_t r_end) const {
+        if (layout_.reduced_dims_.empty()) {
+            return r_begin < r_end
+                           ? op_.Reduce(op_.Identity(),
+                                        *reinterpret_cast<const scalar_t*>(
+                                                src_ptr),
+                                        0)
+                           : op_.Identity();
+        }
+        int64_t stride = layout_.reduced_dims_.back().src_byte_stride_;
+        acc_t lanes[kNumLanes];
+        for (int64_t l = 0; l < kNumLanes; ++l) {
+            lanes[l] = op_.Identity();
+        }
+        ForEachRun(src_ptr, r_begin, r_end,
+                   [&](const char* row_ptr, int64_t start, int64_t size,
+                       int64_t r) {
+                       const char* ptr = row_ptr + start * stride;
+                       int64_t i = 0;
+                       if (stride == static_cast<int64_t>(sizeof(scalar_t))) {
+                           const scalar_t* vals =
+                                   reinterpret_cast<const scalar_t*>(ptr);
+                           for (; i + kNumLanes <= size; i += kNumLanes) {
+                               for (int64_t l = 0; l < kNumLanes; ++l) {
+                                   lanes[l] = op_.Reduce(lanes[l], vals[i + l],
+                                                         r + i + l);
+                               }
+                           }
+                       }
+                       for (; i < size; ++i) {
+                           lanes[i % kNumLanes] = op_.Reduce(
+                                   lanes[i % kNumLanes],
+                                   *reinterpret_cast<const scalar_t*>(
+                                           ptr + i * stride),
+                                   r + i);
+                       }
+                   });
+        for (int64_t width = kNumLanes / 2; width > 0; width /= 2) {
+            for (int64_t l = 0; l < width; ++l) {
+                lanes[l] = op_.Combine(lanes[l], lanes[l + width]);
+            }
+        }
+        return lanes[0];
+    }
+
+    /// Reduces the elements [r_begin, r_end) of \p width outputs that are
+    /// \p output_stride bytes apart in src.
+    void ReduceTile(const char* src_ptr,
+                    int64_t output_stride,
+                    int64_t width,
+                    int64_t r_begin,
+                    int64_t r_end,
+                    acc_t* accs) const {
+        int64_t stride = layout_.reduced_dims_.back().src_byte_stride_;
+        for (int64_t j = 0; j < width; ++j) {
+            accs[j] = op_.Identity();
+        }
+        bool contiguous =
+                output_stride == static_cast<int64_t>(sizeof(scalar_t));
+        ForEachRun(src_ptr, r_begin, r_end,
+                   [&](const char* row_ptr, int64_t start, int64_t size,
+                       int64_t r) {
+                       for (int64_t i = 0; i < size; ++i) {
+                           const char* ptr = row_ptr + (start + i) * stride;
+                           if (contiguous) {
+                               const scalar_t* vals =
+                                       reinterpret_cast<const scalar_t*>(ptr);
+                               for (int64_t j = 0; j < width; ++j) {
+                                   accs[j] =
+                                           op_.Reduce(accs[j], vals[j], r + i);
+                               }
+                           } else {
+                               for (int64_t j = 0; j < width; ++j) {
+                                   accs[j] = op_.Reduce(
+                                           accs[j],
+                                           *reinterpret_cast<const scalar_t*>(
+                                                   ptr + j * output_stride),
+                                           r + i);
+                               }
+                           }
+                       }
+                   });
+    }
+
+    const CPUReductionLayout& layout_;
+    Op op_;
 };
 
+template <typename scalar_t, typename Op>
+static void RunReduction(const CPUReductionLayout& layout, const Op& op) {
+    CPUReductionEngine<scalar_t, Op>(layout, op).Run();
+}
+
+static void AssertDstDtype(const Tensor& dst, Dtype dtype) {
+    if (dst.GetDtype() != dtype) {
+        utility::LogError("Expected output dtype {}, but got {}.",
+                          DtypeUtil::ToString(dtype),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+}
+
 void ReductionCPU(const Tensor& src,
                   Tensor& dst,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
-    if (regular_reduce_ops.find(op_code) != regular_reduce_ops.end()) {
-        DtypePolicy dtype_policy = DtypePolicy::ASSERT_SAME;
-        Indexer indexer({src}, dst, dtype_policy, dims);
-        CPUReductionEngine re(indexer);
-        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
-            scalar_t identity;
-            switch (op_code) {
-                case ReductionOpCode::Sum:
-                    identity = 0;
-                    dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
-                    break;
-                case ReductionOpCode::Prod:
-                    identity = 1;
-                    dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
-                    break;
-                case ReductionOpCode::Min:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport Min.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::max();
-                        dst.Fill(identity);
-                        re.Run(CPUMinReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                case ReductionOpCode::Max:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport Max.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::min();
-                        dst.Fill(identity);
-                        re.Run(CPUMaxReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                default:
-                    utility::LogError("Unsupported op code.");
-                    break;
-            }
-        });
-    } else if (arg_reduce_ops.find(op_code) != arg_reduce_ops.end()) {
-        if (dst.GetDtype() != Dtype::Int64) {
-            utility::LogError("Arg-reduction must have int64 output dtype.");
+    CPUReductionLayout layout(src, dst, dims);
+    Dtype dtype = src.GetDtype();
+
+    if (layout.num_reduced_ == 0 && layout.num_outputs_ > 0) {
+        // Min, Max and arg-reductions have no identity element.
+        static const std::unordered_map<ReductionOpCode, std::string,
+                                        utility::hash_enum_class::hash>
+                no_identity_ops = {{ReductionOpCode::Min, "Min"},
+                                   {ReductionOpCode::Max, "Max"},
+                                   {ReductionOpCode::ArgMin, "ArgMin"},
+                                   {ReductionOpCode::ArgMax, "ArgMax"}};
+        if (no_identity_ops.find(op_code) != no_identity_ops.end()) {
+            utility::LogError("Zero-size Tensor does not suport {}.",
+                              no_identity_ops.at(op_code));
         }
-        DtypePolicy dtype_policy = DtypePolicy::ASSERT_SAME_INPUTS;
-
-        // Accumulation buffer to store temporary min/max values.
-        Tensor dst_acc(dst.GetShape(), src.GetDtype(), src.GetDevice());
-
-        Indexer indexer({src}, {dst, dst_acc}, dtype_policy, dims);
-        CPUArgReductionEngine re(indexer);
-        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
-            scalar_t identity;
-            switch (op_code) {
-                case ReductionOpCode::ArgMin:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport ArgMin.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::max();
-                        dst_acc.Fill(identity);
-                        re.Run(CPUArgMinReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                case ReductionOpCode::ArgMax:
-                    if (indexer.NumWorkloads() == 0) {
-                        utility::LogError(
-                                "Zero-size Tensor does not suport ArgMax.");
-                    } else {
-                        identity = std::numeric_limits<scalar_t>::min();
-                        dst_acc.Fill(identity);
-                        re.Run(CPUArgMaxReductionKernel<scalar_t>, identity);
-                    }
-                    break;
-                default:
-                    utility::LogError("Unsupported op code.");
-                    break;
-            }
-        });
-    } else {
-        utility::LogError("Unsupported op code.");
+    }
+
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            AssertDstDtype(dst, dtype);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                using Op = typename SumOpSelector<scalar_t>::type;
+                RunReduction<scalar_t>(layout, Op());
+            });
+            break;
+        case ReductionOpCode::Prod:
+            AssertDstDtype(dst, dtype);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                RunReduction<scalar_t>(layout, ProdReductionOp<scalar_t>());
+            });
+            break;
+        case ReductionOpCode::Min:
+            AssertDstDtype(dst, dtype);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                RunReduction<scalar_t>(layout, MinReductionOp<scalar_t>());
+            });
+            break;
+        case ReductionOpCode::Max:
+            AssertDstDtype(dst, dtype);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                RunReduction<scalar_t>(layout, MaxReductionOp<scalar_t>());
+            });
+            break;
+        case ReductionOpCode::ArgMin:
+            AssertDstDtype(dst, Dtype::Int64);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                RunReduction<scalar_t>(layout, ArgMinReductionOp<scalar_t>());
+            });
+            break;
+        case ReductionOpCode::ArgMax:
+            AssertDstDtype(dst, Dtype::Int64);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                RunReduction<scalar_t>(layout, ArgMaxReductionOp<scalar_t>());
+            });
+            break;
+        case ReductionOpCode::Mean:
+            AssertDstDtype(dst, dtype);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                RunReduction<scalar_t>(layout, MeanReductionOp<scalar_t>());
+            });
+            break;
+        case ReductionOpCode::Var:
+            AssertDstDtype(dst, dtype);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                RunReduction<scalar_t>(
+                        layout, VarianceReductionOp<scalar_t, false>());
+            });
+            break;
+        case ReductionOpCode::Std:
+            AssertDstDtype(dst, dtype);
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                RunReduction<scalar_t>(layout,
+                                       VarianceReductionOp<scalar_t, true>());
+            });
+            break;
+        case ReductionOpCode::Any:
+            AssertDstDtype(dst, Dtype::Bool);
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+                RunReduction<scalar_t>(
+                        layout, LogicalReductionOp<scalar_t, false>());
+            });
+            break;
+        case ReductionOpCode::All:
+            AssertDstDtype(dst, Dtype::Bool);
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+                RunReduction<scalar_t>(layout,
+                                       LogicalReductionOp<scalar_t, true>());
+            });
+            break;
+        default:
+            utility::LogError("Unsupported op code.");
+            break;
     }
 }
 
@@ -100,12 +100,14 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                 DtypeUtil::ByteSize(src_dtype) * shape.NumElements());
     } else {
         Indexer indexer({src}, dst, DtypePolicy::NONE);
+        UnaryEWVecKernel vec_kernel = GetCopyVecKernel(src_dtype, dst_dtype);
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
             using src_t = scalar_t;
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                 using dst_t = scalar_t;
                 CPULauncher::LaunchUnaryEWKernel(
-                        indexer, CPUCopyElementKernel<src_t, dst_t>);
+                        indexer, CPUCopyElementKernel<src_t, dst_t>,
+                        vec_kernel);
             });
         });
     }
@@ -118,9 +120,11 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Indexer indexer({src}, dst, DtypePolicy::ASSERT_SAME_OR_BOOL_OUT);
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     DtypeUtil::ToString(dtype));
         }
     };
@@ -135,12 +139,17 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             });
         });
     } else {
+        // SIMD kernel for contiguous operands, nullptr if not vectorized.
+        UnaryEWVecKernel vec_kernel =
+                src_dtype == dst_dtype ? GetUnaryEWVecKernel(op_code, src_dtype)
+                                       : nullptr;
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSqrtElementKernel<scalar_t>);
+                            indexer, CPUSqrtElementKernel<scalar_t>,
+                            vec_kernel);
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
@@ -154,7 +163,8 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                     break;
                 case UnaryEWOpCode::Neg:
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUNegElementKernel<scalar_t>);
+                            indexer, CPUNegElementKernel<scalar_t>,
+                            vec_kernel);
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
@@ -163,7 +173,8 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                     break;
                 case UnaryEWOpCode::Abs:
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUAbsElementKernel<scalar_t>);
+                            indexer, CPUAbsElementKernel<scalar_t>,
+                            vec_kernel);
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
@@ -92,6 +92,31 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::SetCacheEnabled(const Device& device, bool enabled) {
+    GetDeviceMemoryManager(device)->SetCacheEnabled(enabled, device);
+}
+
+bool MemoryManager::IsCacheEnabled(const Device& device) {
+    return GetDeviceMemoryManager(device)->IsCacheEnabled(device);
+}
+
+void MemoryManager::SetCacheHighWaterMark(const Device& device,
+                                          int64_t byte_size) {
+    if (byte_size < 0) {
+        utility::LogError("Cache high-water mark must be >= 0, but got {}.",
+                          byte_size);
+    }
+    GetDeviceMemoryManager(device)->SetCacheHighWaterMark(byte_size, device);
+}
+
+void MemoryManager::ReleaseCache(const Device& device) {
+    GetDeviceMemoryManager(device)->ReleaseCache(device);
+}
+
+MemoryStatistics MemoryManager::GetStatistics(const Device& device) {
+    return GetDeviceMemoryManager(device)->GetStatistics(device);
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
@@ -113,4 +138,11 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
     return map_device_type_to_memory_manager.at(device.GetType());
 }
 
+void DeviceMemoryManager::SetCacheEnabled(bool enabled, const Device& device) {
+    if (enabled) {
+        utility::LogError("Caching allocator is not supported on device {}.",
+                          device.ToString());
+    }
+}
+
 }  // namespace open3d
@@ -38,6 +38,28 @@ namespace open3d {
 
 class DeviceMemoryManager;
 
+/// Allocation statistics of a device memory manager. All sizes are in bytes.
+/// Only allocations made while the cache is enabled are counted.
+struct MemoryStatistics {
+    /// Bytes currently held by Blobs, rounded up to the allocated block size.
+    int64_t bytes_in_use_ = 0;
+    /// Highest value of bytes_in_use_ seen so far.
+    int64_t peak_bytes_in_use_ = 0;
+    /// Bytes kept in the cache for later reuse.
+    int64_t bytes_cached_ = 0;
+    /// Number of Malloc calls.
+    int64_t num_mallocs_ = 0;
+    /// Number of Malloc calls served from the cache.
+    int64_t num_cache_hits_ = 0;
+
+    /// Fraction of Malloc calls served from the cache.
+    double HitRate() const {
+        return num_mallocs_ == 0 ? 0.0
+                                 : static_cast<double>(num_cache_hits_) /
+                                           static_cast<double>(num_mallocs_);
+    }
+};
+
 class MemoryManager {
 public:
     static void* Malloc(size_t byte_size, const Device& device);
@@ -58,6 +80,25 @@ public:
                              const Device& src_device,
                              size_t num_bytes);
 
+    /// Enable or disable the caching allocator of \p device. When enabled,
+    /// freed memory is kept for reuse by later allocations instead of being
+    /// returned to the system. Memory allocated before the switch can still
+    /// be freed after it.
+    static void SetCacheEnabled(const Device& device, bool enabled);
+
+    /// Returns true if the caching allocator of \p device is enabled.
+    static bool IsCacheEnabled(const Device& device);
+
+    /// Set the maximum number of bytes the cache of \p device may hold.
+    /// Freed blocks exceeding this limit are returned to the system.
+    static void SetCacheHighWaterMark(const Device& device, int64_t byte_size);
+
+    /// Return all cached memory of \p device to the system.
+    static void ReleaseCache(const Device& device);
+
+    /// Returns the allocation statistics of \p device.
+    static MemoryStatistics GetStatistics(const Device& device);
+
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
@@ -72,8 +113,24 @@ public:
                         const void* src_ptr,
                         const Device& src_device,
                         size_t num_bytes) = 0;
+
+    /// Devices without a caching allocator only accept enabled == false.
+    virtual void SetCacheEnabled(bool enabled, const Device& device);
+    virtual bool IsCacheEnabled(const Device& device) const { return false; }
+    virtual void SetCacheHighWaterMark(int64_t byte_size,
+                                       const Device& device) {}
+    virtual void ReleaseCache(const Device& device) {}
+    virtual MemoryStatistics GetStatistics(const Device& device) const {
+        return MemoryStatistics();
+    }
 };
 
+/// CPU memory manager with an optional caching allocator.
+///
+/// Small blocks are binned into size classes and recycled through per-thread
+/// free lists backed by a shared pool. Large blocks are mapped in huge-page
+/// sized slabs and recycled through the shared pool. The cache is disabled by
+/// default.
 class CPUMemoryManager : public DeviceMemoryManager {
 public:
     CPUMemoryManager();
@@ -84,6 +141,12 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+    void SetCacheEnabled(bool enabled, const Device& device) override;
+    bool IsCacheEnabled(const Device& device) const override;
+    void SetCacheHighWaterMark(int64_t byte_size,
+                               const Device& device) override;
+    void ReleaseCache(const Device& device) override;
+    MemoryStatistics GetStatistics(const Device& device) const override;
 };
 
 #ifdef BUILD_CUDA_MODULE
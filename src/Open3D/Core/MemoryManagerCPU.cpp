@@ -26,24 +26,509 @@
 
 #include "Open3D/Core/MemoryManager.h"
 
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "Open3D/Utility/Console.h"
 
 namespace open3d {
 
-CPUMemoryManager::CPUMemoryManager() {}
+namespace {
 
-void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
-    void* ptr;
-    ptr = std::malloc(byte_size);
-    if (byte_size != 0 && !ptr) {
-        utility::LogError("CPU malloc failed");
+// Blocks allocated while caching is enabled start with a header recording their
+// size class. Blocks allocated while it is disabled come from plain malloc().
+constexpr size_t kHeaderSize = 64;
+constexpr size_t kAlignment = 64;
+
+// Blocks up to kMaxSmallBlockSize are binned into size classes, four classes
+// per power of two, starting from kMinBlockSize.
+constexpr size_t kMinBlockSize = 64;
+constexpr size_t kMaxSmallBlockSize = 1 << 20;
+constexpr int kNumSizeClasses = 57;
+
+// Large blocks are mapped in multiples of the (transparent) huge page size. A
+// cached large block is reused for a request if at most 1/4 of it is wasted.
+constexpr size_t kHugePageSize = 2 << 20;
+
+// Per-thread free list limits. Blocks beyond these limits go to the shared
+// pool.
+constexpr size_t kMaxThreadCacheBlocksPerClass = 16;
+constexpr size_t kMaxThreadCacheBytes = 16 << 20;
+
+constexpr int64_t kDefaultHighWaterMark = int64_t(1) << 30;
+
+enum class BlockKind : uint32_t { Small, Large };
+
+struct BlockHeader {
+    /// Usable bytes after the header.
+    uint64_t block_size_;
+    BlockKind kind_;
+    int32_t size_class_;
+};
+static_assert(sizeof(BlockHeader) <= kHeaderSize, "Block header too large.");
+
+inline void* HeaderToPtr(BlockHeader* header) {
+    return reinterpret_cast<char*>(header) + kHeaderSize;
+}
+
+inline BlockHeader* PtrToHeader(void* ptr) {
+    return reinterpret_cast<BlockHeader*>(static_cast<char*>(ptr) -
+                                          kHeaderSize);
+}
+
+/// Rounds \p byte_size up to its size class and returns the class index.
+/// Only valid for byte_size <= kMaxSmallBlockSize.
+inline int ToSizeClass(size_t& byte_size) {
+    if (byte_size <= kMinBlockSize) {
+        byte_size = kMinBlockSize;
+        return 0;
+    }
+    // byte_size is in (2^p, 2^(p+1)], split into 4 steps of 2^(p-2).
+    int p = 6;
+    while ((size_t(1) << (p + 1)) < byte_size) {
+        p++;
+    }
+    size_t step = size_t(1) << (p - 2);
+    byte_size = (byte_size + step - 1) & ~(step - 1);
+    return 1 + (p - 6) * 4 + static_cast<int>((byte_size >> (p - 2)) - 5);
+}
+
+void* AlignedMalloc(size_t byte_size) {
+#ifdef _WIN32
+    return _aligned_malloc(byte_size, kAlignment);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, kAlignment, byte_size) != 0) {
+        return nullptr;
     }
     return ptr;
+#endif
+}
+
+void AlignedFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+/// Maps \p map_size bytes aligned to kHugePageSize and advises the kernel to
+/// back them with transparent huge pages.
+void* MapHugePages(size_t map_size) {
+#ifdef __linux__
+    size_t padded_size = map_size + kHugePageSize;
+    void* raw = mmap(nullptr, padded_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+    uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+    uintptr_t aligned = (begin + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    uintptr_t end = begin + padded_size;
+    if (aligned > begin) {
+        munmap(raw, aligned - begin);
+    }
+    if (end > aligned + map_size) {
+        munmap(reinterpret_cast<void*>(aligned + map_size),
+               end - aligned - map_size);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(reinterpret_cast<void*>(aligned), map_size, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(aligned);
+#else
+    return AlignedMalloc(map_size);
+#endif
+}
+
+void UnmapHugePages(void* ptr, size_t map_size) {
+#ifdef __linux__
+    munmap(ptr, map_size);
+#else
+    (void)map_size;
+    AlignedFree(ptr);
+#endif
+}
+
+BlockHeader* NewBlock(size_t block_size, BlockKind kind, int size_class) {
+    void* base = nullptr;
+    if (kind == BlockKind::Large) {
+        base = MapHugePages(block_size + kHeaderSize);
+    } else {
+        base = AlignedMalloc(block_size + kHeaderSize);
+    }
+    if (base == nullptr) {
+        utility::LogError("CPU malloc failed");
+    }
+    BlockHeader* header = static_cast<BlockHeader*>(base);
+    header->block_size_ = block_size;
+    header->kind_ = kind;
+    header->size_class_ = size_class;
+    return header;
+}
+
+void DeleteBlock(BlockHeader* header) {
+    if (header->kind_ == BlockKind::Large) {
+        UnmapHugePages(header, header->block_size_ + kHeaderSize);
+    } else {
+        AlignedFree(header);
+    }
+}
+
+/// Set of the blocks handed out by the cache. Free() looks pointers up here
+/// to tell them from plain malloc() blocks, instead of reading the memory in
+/// front of pointers it did not allocate. The set is sharded by address to
+/// keep threads from contending on one lock.
+class BlockRegistry {
+public:
+    void Insert(void* ptr) {
+        Shard& shard = GetShard(ptr);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        shard.ptrs_.insert(ptr);
+        size_++;
+    }
+
+    /// Removes \p ptr and returns true if it is in the set.
+    bool Erase(void* ptr) {
+        if (size_ == 0) {
+            return false;
+        }
+        Shard& shard = GetShard(ptr);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        if (shard.ptrs_.erase(ptr) == 0) {
+            return false;
+        }
+        size_--;
+        return true;
+    }
+
+private:
+    static constexpr int kNumShards = 64;
+
+    struct alignas(64) Shard {
+        std::mutex mutex_;
+        std::unordered_set<void*> ptrs_;
+    };
+
+    Shard& GetShard(void* ptr) {
+        return shards_[(reinterpret_cast<uintptr_t>(ptr) / kAlignment) %
+                       kNumShards];
+    }
+
+    Shard shards_[kNumShards];
+    std::atomic<int64_t> size_{0};
+};
+
+class CPUCachingAllocator;
+
+/// Per-thread free lists of small blocks. Blocks are handed to the shared pool
+/// when the owning thread exits.
+struct ThreadCache {
+    ~ThreadCache();
+
+    std::vector<BlockHeader*> free_lists_[kNumSizeClasses];
+    size_t byte_size_ = 0;
+    uint64_t epoch_ = 0;
+};
+
+// Set once the calling thread's cache is destroyed, Blobs freed afterwards
+// (e.g. during static destruction) go directly to the shared pool.
+thread_local bool t_thread_cache_destroyed = false;
+
+ThreadCache* GetThreadCache() {
+    if (t_thread_cache_destroyed) {
+        return nullptr;
+    }
+    static thread_local ThreadCache thread_cache;
+    return &thread_cache;
+}
+
+class CPUCachingAllocator {
+public:
+    /// The allocator is never destroyed, since Blobs with static storage
+    /// duration may be freed after all other statics are gone.
+    static CPUCachingAllocator& GetInstance() {
+        static CPUCachingAllocator* instance = new CPUCachingAllocator();
+        return *instance;
+    }
+
+    void* Malloc(size_t byte_size) {
+        if (!enabled_) {
+            void* ptr = std::malloc(byte_size);
+            if (byte_size != 0 && !ptr) {
+                utility::LogError("CPU malloc failed");
+            }
+            return ptr;
+        }
+        num_mallocs_++;
+        BlockHeader* header = nullptr;
+        if (byte_size <= kMaxSmallBlockSize) {
+            header = MallocSmall(byte_size);
+        } else {
+            header = MallocLarge(byte_size);
+        }
+        AddBytesInUse(header->block_size_);
+        void* ptr = HeaderToPtr(header);
+        registry_.Insert(ptr);
+        return ptr;
+    }
+
+    void Free(void* ptr) {
+        if (!registry_.Erase(ptr)) {
+            std::free(ptr);
+            return;
+        }
+        BlockHeader* header = PtrToHeader(ptr);
+        bytes_in_use_ -= header->block_size_;
+        if (!enabled_) {
+            DeleteBlock(header);
+        } else if (header->kind_ == BlockKind::Small) {
+            FreeSmall(header);
+        } else {
+            FreeLarge(header);
+        }
+    }
+
+    void SetEnabled(bool enabled) {
+        enabled_ = enabled;
+        if (!enabled) {
+            ReleaseCache();
+        }
+    }
+
+    bool IsEnabled() const { return enabled_; }
+
+    void SetHighWaterMark(int64_t byte_size) {
+        high_water_mark_ = byte_size;
+        if (bytes_cached_ > high_water_mark_) {
+            ReleaseCache();
+        }
+    }
+
+    /// Releases the shared pool and the calling thread's free lists. Other
+    /// threads release their free lists on their next Malloc or Free.
+    void ReleaseCache() {
+        epoch_++;
+        if (ThreadCache* thread_cache = GetThreadCache()) {
+            ReleaseThreadCache(*thread_cache);
+        }
+        {
+            std::lock_guard<std::mutex> lock(small_mutex_);
+            for (auto& free_list : small_free_lists_) {
+                for (BlockHeader* header : free_list) {
+                    bytes_cached_ -= header->block_size_;
+                    DeleteBlock(header);
+                }
+                free_list.clear();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(large_mutex_);
+            for (auto& it : large_free_blocks_) {
+                bytes_cached_ -= it.second->block_size_;
+                DeleteBlock(it.second);
+            }
+            large_free_blocks_.clear();
+        }
+    }
+
+    MemoryStatistics GetStatistics() const {
+        MemoryStatistics stats;
+        stats.bytes_in_use_ = bytes_in_use_;
+        stats.peak_bytes_in_use_ = peak_bytes_in_use_;
+        stats.bytes_cached_ = bytes_cached_;
+        stats.num_mallocs_ = num_mallocs_;
+        stats.num_cache_hits_ = num_cache_hits_;
+        return stats;
+    }
+
+    /// Moves all blocks of an exiting thread's free lists to the shared pool.
+    void FlushThreadCache(ThreadCache& thread_cache) {
+        if (thread_cache.epoch_ != epoch_ || !enabled_) {
+            ReleaseThreadCache(thread_cache);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(small_mutex_);
+        for (int i = 0; i < kNumSizeClasses; ++i) {
+            auto& src = thread_cache.free_lists_[i];
+            auto& dst = small_free_lists_[i];
+            dst.insert(dst.end(), src.begin(), src.end());
+            src.clear();
+        }
+        thread_cache.byte_size_ = 0;
+    }
+
+private:
+    CPUCachingAllocator() {}
+
+    BlockHeader* MallocSmall(size_t byte_size) {
+        int size_class = ToSizeClass(byte_size);
+        ThreadCache* thread_cache = GetValidThreadCache();
+        if (thread_cache != nullptr) {
+            auto& free_list = thread_cache->free_lists_[size_class];
+            if (!free_list.empty()) {
+                BlockHeader* header = free_list.back();
+                free_list.pop_back();
+                thread_cache->byte_size_ -= header->block_size_;
+                return TakeCachedBlock(header);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(small_mutex_);
+            auto& free_list = small_free_lists_[size_class];
+            if (!free_list.empty()) {
+                BlockHeader* header = free_list.back();
+                free_list.pop_back();
+                return TakeCachedBlock(header);
+            }
+        }
+        return NewBlock(byte_size, BlockKind::Small, size_class);
+    }
+
+    BlockHeader* MallocLarge(size_t byte_size) {
+        size_t map_size = byte_size + kHeaderSize;
+        map_size = (map_size + kHugePageSize - 1) & ~(kHugePageSize - 1);
+        size_t block_size = map_size - kHeaderSize;
+        {
+            std::lock_guard<std::mutex> lock(large_mutex_);
+            auto it = large_free_blocks_.lower_bound(block_size);
+            if (it != large_free_blocks_.end() &&
+                it->first - block_size <= block_size / 4) {
+                BlockHeader* header = it->second;
+                large_free_blocks_.erase(it);
+                return TakeCachedBlock(header);
+            }
+        }
+        return NewBlock(block_size, BlockKind::Large, -1);
+    }
+
+    void FreeSmall(BlockHeader* header) {
+        if (!ReserveCache(header->block_size_)) {
+            DeleteBlock(header);
+            return;
+        }
+        ThreadCache* thread_cache = GetValidThreadCache();
+        if (thread_cache != nullptr) {
+            auto& free_list = thread_cache->free_lists_[header->size_class_];
+            if (free_list.size() < kMaxThreadCacheBlocksPerClass &&
+                thread_cache->byte_size_ + header->block_size_ <=
+                        kMaxThreadCacheBytes) {
+                free_list.push_back(header);
+                thread_cache->byte_size_ += header->block_size_;
+                return;
+            }
+        }
+        std::lock_guard<std::mutex> lock(small_mutex_);
+        small_free_lists_[header->size_class_].push_back(header);
+    }
+
+    void FreeLarge(BlockHeader* header) {
+        if (!ReserveCache(header->block_size_)) {
+            DeleteBlock(header);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(large_mutex_);
+        large_free_blocks_.emplace(header->block_size_, header);
+    }
+
+    /// Accounts for a block being taken out of the cache.
+    BlockHeader* TakeCachedBlock(BlockHeader* header) {
+        bytes_cached_ -= header->block_size_;
+        num_cache_hits_++;
+        return header;
+    }
+
+    /// Accounts for a block about to be cached. Returns false if caching the
+    /// block would exceed the high-water mark.
+    bool ReserveCache(uint64_t block_size) {
+        int64_t cached = bytes_cached_;
+        do {
+            if (cached + static_cast<int64_t>(block_size) > high_water_mark_) {
+                return false;
+            }
+        } while (!bytes_cached_.compare_exchange_weak(
+                cached, cached + static_cast<int64_t>(block_size)));
+        return true;
+    }
+
+    void AddBytesInUse(uint64_t block_size) {
+        int64_t in_use = (bytes_in_use_ += block_size);
+        int64_t peak = peak_bytes_in_use_;
+        while (in_use > peak &&
+               !peak_bytes_in_use_.compare_exchange_weak(peak, in_use)) {
+        }
+    }
+
+    /// Returns the calling thread's cache after dropping its blocks if the
+    /// cache has been released since they were cached.
+    ThreadCache* GetValidThreadCache() {
+        ThreadCache* thread_cache = GetThreadCache();
+        if (thread_cache != nullptr && thread_cache->epoch_ != epoch_) {
+            ReleaseThreadCache(*thread_cache);
+        }
+        return thread_cache;
+    }
+
+    void ReleaseThreadCache(ThreadCache& thread_cache) {
+        for (auto& free_list : thread_cache.free_lists_) {
+            for (BlockHeader* header : free_list) {
+                bytes_cached_ -= header->block_size_;
+                DeleteBlock(header);
+            }
+            free_list.clear();
+        }
+        thread_cache.byte_size_ = 0;
+        thread_cache.epoch_ = epoch_;
+    }
+
+    BlockRegistry registry_;
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<int64_t> high_water_mark_{kDefaultHighWaterMark};
+    std::atomic<uint64_t> epoch_{0};
+
+    std::atomic<int64_t> bytes_in_use_{0};
+    std::atomic<int64_t> peak_bytes_in_use_{0};
+    std::atomic<int64_t> bytes_cached_{0};
+    std::atomic<int64_t> num_mallocs_{0};
+    std::atomic<int64_t> num_cache_hits_{0};
+
+    std::mutex small_mutex_;
+    std::vector<BlockHeader*> small_free_lists_[kNumSizeClasses];
+
+    std::mutex large_mutex_;
+    std::multimap<size_t, BlockHeader*> large_free_blocks_;
+};
+
+ThreadCache::~ThreadCache() {
+    CPUCachingAllocator::GetInstance().FlushThreadCache(*this);
+    t_thread_cache_destroyed = true;
+}
+
+}  // namespace
+
+CPUMemoryManager::CPUMemoryManager() {}
+
+void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    return CPUCachingAllocator::GetInstance().Malloc(byte_size);
 }
 
 void CPUMemoryManager::Free(void* ptr, const Device& device) {
     if (ptr) {
-        std::free(ptr);
+        CPUCachingAllocator::GetInstance().Free(ptr);
     }
 }
 
@@ -55,4 +540,25 @@ void CPUMemoryManager::Memcpy(void* dst_ptr,
     std::memcpy(dst_ptr, src_ptr, num_bytes);
 }
 
+void CPUMemoryManager::SetCacheEnabled(bool enabled, const Device& device) {
+    CPUCachingAllocator::GetInstance().SetEnabled(enabled);
+}
+
+bool CPUMemoryManager::IsCacheEnabled(const Device& device) const {
+    return CPUCachingAllocator::GetInstance().IsEnabled();
+}
+
+void CPUMemoryManager::SetCacheHighWaterMark(int64_t byte_size,
+                                             const Device& device) {
+    CPUCachingAllocator::GetInstance().SetHighWaterMark(byte_size);
+}
+
+void CPUMemoryManager::ReleaseCache(const Device& device) {
+    CPUCachingAllocator::GetInstance().ReleaseCache();
+}
+
+MemoryStatistics CPUMemoryManager::GetStatistics(const Device& device) const {
+    return CPUCachingAllocator::GetInstance().GetStatistics();
+}
+
 }  // namespace open3d
@@ -0,0 +1,735 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/NumpyIO.h"
+
+#include <zlib.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "Open3D/Core/Blob.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/MappedFile.h"
+
+// The .npy format is described in
+// https://numpy.org/doc/stable/reference/generated/numpy.lib.format.html and
+// .npz files are zip archives with one .npy file per array. Only
+// little-endian hosts are supported.
+
+namespace open3d {
+
+namespace {
+
+const char kNpyMagic[] = "\x93NUMPY";
+const int64_t kNpyMagicSize = 6;
+const int64_t kNpyHeaderAlignment = 64;
+
+const uint32_t kZipLocalHeaderSignature = 0x04034b50;
+const uint32_t kZipCentralHeaderSignature = 0x02014b50;
+const uint32_t kZipEndSignature = 0x06054b50;
+const uint32_t kZip64EndSignature = 0x06064b50;
+const uint32_t kZip64LocatorSignature = 0x07064b50;
+const uint16_t kZip64ExtraId = 0x0001;
+const uint32_t kZip32Max = 0xffffffff;
+const uint16_t kZip16Max = 0xffff;
+// 1980-01-01 00:00:00, the earliest MS-DOS timestamp.
+const uint16_t kZipDosDate = (1 << 5) | 1;
+
+template <typename T>
+T ReadLE(const char* ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void AppendLE(std::string& buffer, T value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+std::string DtypeToDescr(Dtype dtype) {
+    switch (dtype) {
+        case Dtype::Float16:
+            return "<f2";
+        case Dtype::Float32:
+            return "<f4";
+        case Dtype::Float64:
+            return "<f8";
+        case Dtype::Int16:
+            return "<i2";
+        case Dtype::Int32:
+            return "<i4";
+        case Dtype::Int64:
+            return "<i8";
+        case Dtype::UInt8:
+            return "|u1";
+        case Dtype::UInt16:
+            return "<u2";
+        case Dtype::Bool:
+            return "|b1";
+        default:
+            utility::LogError("Unsupported dtype {} for .npy files.",
+                              DtypeUtil::ToString(dtype));
+    }
+    return "";
+}
+
+Dtype DescrToDtype(const std::string& descr, const std::string& file_name) {
+    if (descr.size() < 3) {
+        utility::LogError("Invalid dtype '{}' in {}.", descr, file_name);
+    }
+    const char byte_order = descr[0];
+    const std::string type = descr.substr(1);
+    if (byte_order == '>' && type != "u1" && type != "b1") {
+        utility::LogError("Big-endian dtype '{}' in {} is not supported.",
+                          descr, file_name);
+    }
+    if (type == "f2") return Dtype::Float16;
+    if (type == "f4") return Dtype::Float32;
+    if (type == "f8") return Dtype::Float64;
+    if (type == "i2") return Dtype::Int16;
+    if (type == "i4") return Dtype::Int32;
+    if (type == "i8") return Dtype::Int64;
+    if (type == "u1") return Dtype::UInt8;
+    if (type == "u2") return Dtype::UInt16;
+    if (type == "b1") return Dtype::Bool;
+    utility::LogError("Unsupported dtype '{}' in {}.", descr, file_name);
+    return Dtype::Undefined;
+}
+
+/// Returns the .npy header (magic string, version, header length and header
+/// dict) for \p tensor.
+std::string MakeNpyHeader(const Tensor& tensor) {
+    std::string dict = "{'descr': '" + DtypeToDescr(tensor.GetDtype()) +
+                       "', 'fortran_order': False, 'shape': (";
+    const SizeVector& shape = tensor.GetShape();
+    for (size_t i = 0; i < shape.size(); ++i) {
+        dict += std::to_string(shape[i]);
+        if (i + 1 < shape.size() || shape.size() == 1) {
+            dict += ",";
+        }
+        if (i + 1 < shape.size()) {
+            dict += " ";
+        }
+    }
+    dict += "), }";
+
+    // Version 1.0 stores the header length in 2 bytes, version 2.0 in 4. The
+    // data starts at a multiple of kNpyHeaderAlignment bytes.
+    auto padded_dict_size = [&dict](int64_t preamble_size) {
+        int64_t size = preamble_size + static_cast<int64_t>(dict.size()) + 1;
+        size = (size + kNpyHeaderAlignment - 1) / kNpyHeaderAlignment *
+               kNpyHeaderAlignment;
+        return size - preamble_size;
+    };
+    int64_t dict_size = padded_dict_size(kNpyMagicSize + 4);
+    const bool version2 = dict_size > std::numeric_limits<uint16_t>::max();
+    if (version2) {
+        dict_size = padded_dict_size(kNpyMagicSize + 6);
+    }
+    dict.append(dict_size - dict.size() - 1, ' ');
+    dict += "\n";
+
+    std::string header(kNpyMagic, kNpyMagicSize);
+    header += static_cast<char>(version2 ? 2 : 1);
+    header += static_cast<char>(0);
+    if (version2) {
+        AppendLE<uint32_t>(header, static_cast<uint32_t>(dict.size()));
+    } else {
+        AppendLE<uint16_t>(header, static_cast<uint16_t>(dict.size()));
+    }
+    return header + dict;
+}
+
+struct NpyHeader {
+    Dtype dtype_;
+    SizeVector shape_;
+    bool fortran_order_;
+    /// Offset of the array data from the beginning of the .npy file.
+    int64_t data_offset_;
+};
+
+/// Returns the position right after "key": in \p dict.
+size_t FindDictValue(const std::string& dict,
+                     const std::string& key,
+                     const std::string& file_name) {
+    size_t pos = dict.find("'" + key + "'");
+    if (pos == std::string::npos) {
+        pos = dict.find("\"" + key + "\"");
+    }
+    if (pos == std::string::npos) {
+        utility::LogError("Key '{}' not found in the header of {}.", key,
+                          file_name);
+    }
+    pos = dict.find(':', pos);
+    if (pos == std::string::npos) {
+        utility::LogError("Invalid header in {}.", file_name);
+    }
+    pos = dict.find_first_not_of(" ", pos + 1);
+    if (pos == std::string::npos) {
+        utility::LogError("Invalid header in {}.", file_name);
+    }
+    return pos;
+}
+
+NpyHeader ParseNpyHeader(const char* data,
+                         int64_t size,
+                         const std::string& file_name) {
+    if (size < kNpyMagicSize + 4 ||
+        std::memcmp(data, kNpyMagic, kNpyMagicSize) != 0) {
+        utility::LogError("{} is not a valid .npy file.", file_name);
+    }
+    const int major_version = static_cast<uint8_t>(data[kNpyMagicSize]);
+    int64_t dict_size = 0;
+    int64_t dict_offset = 0;
+    if (major_version == 1) {
+        dict_size = ReadLE<uint16_t>(data + kNpyMagicSize + 2);
+        dict_offset = kNpyMagicSize + 4;
+    } else if (major_version == 2 || major_version == 3) {
+        if (size < kNpyMagicSize + 6) {
+            utility::LogError("{} is not a valid .npy file.", file_name);
+        }
+        dict_size = ReadLE<uint32_t>(data + kNpyMagicSize + 2);
+        dict_offset = kNpyMagicSize + 6;
+    } else {
+        utility::LogError("Unsupported .npy version {} in {}.", major_version,
+                          file_name);
+    }
+    if (dict_offset + dict_size > size) {
+        utility::LogError("{} is truncated.", file_name);
+    }
+    const std::string dict(data + dict_offset, dict_size);
+
+    NpyHeader header;
+    header.data_offset_ = dict_offset + dict_size;
+
+    size_t pos = FindDictValue(dict, "descr", file_name);
+    const char quote = dict[pos];
+    size_t end = dict.find(quote, pos + 1);
+    if ((quote != '\'' && quote != '"') || end == std::string::npos) {
+        utility::LogError("Unsupported dtype in {}.", file_name);
+    }
+    header.dtype_ = DescrToDtype(dict.substr(pos + 1, end - pos - 1),
+                                 file_name);
+
+    pos = FindDictValue(dict, "fortran_order", file_name);
+    header.fortran_order_ = dict.compare(pos, 4, "True") == 0;
+
+    pos = FindDictValue(dict, "shape", file_name);
+    end = dict.find(')', pos);
+    if (dict[pos] != '(' || end == std::string::npos) {
+        utility::LogError("Invalid shape in {}.", file_name);
+    }
+    const std::string shape_str = dict.substr(pos + 1, end - pos - 1);
+    size_t begin = 0;
+    while (begin < shape_str.size()) {
+        size_t comma = shape_str.find(',', begin);
+        if (comma == std::string::npos) {
+            comma = shape_str.size();
+        }
+        const std::string dim = shape_str.substr(begin, comma - begin);
+        if (dim.find_first_not_of(" ") != std::string::npos) {
+            int64_t value = -1;
+            try {
+                value = std::stoll(dim);
+            } catch (const std::invalid_argument&) {
+            } catch (const std::out_of_range&) {
+            }
+            if (value < 0) {
+                utility::LogError("Invalid shape in {}.", file_name);
+            }
+            header.shape_.push_back(value);
+        }
+        begin = comma + 1;
+    }
+    return header;
+}
+
+/// Creates a CPU Tensor from the .npy file at \p npy_data. If \p blob is not
+/// nullptr and the array data is suitably aligned, the Tensor references the
+/// data in place and keeps \p blob alive. Otherwise the data is copied.
+Tensor NpyToTensor(const char* npy_data,
+                   int64_t npy_size,
+                   const std::function<std::shared_ptr<Blob>(void*)>& blob_fn,
+                   const std::string& file_name) {
+    NpyHeader header = ParseNpyHeader(npy_data, npy_size, file_name);
+    const int64_t ndims = static_cast<int64_t>(header.shape_.size());
+    SizeVector shape = header.shape_;
+    if (header.fortran_order_) {
+        std::reverse(shape.begin(), shape.end());
+    }
+    const int64_t element_byte_size = DtypeUtil::ByteSize(header.dtype_);
+    const int64_t max_byte_size = std::numeric_limits<int64_t>::max();
+    int64_t num_elements = 1;
+    for (int64_t dim : shape) {
+        if (dim != 0 && num_elements > max_byte_size / dim) {
+            utility::LogError("Shape in {} is too large.", file_name);
+        }
+        num_elements *= dim;
+    }
+    if (num_elements > max_byte_size / element_byte_size) {
+        utility::LogError("Shape in {} is too large.", file_name);
+    }
+    const int64_t byte_size = num_elements * element_byte_size;
+    if (byte_size > npy_size - header.data_offset_) {
+        utility::LogError("{} is truncated.", file_name);
+    }
+
+    char* data = const_cast<char*>(npy_data) + header.data_offset_;
+    Tensor tensor;
+    if (blob_fn && reinterpret_cast<uintptr_t>(data) % element_byte_size == 0) {
+        tensor = Tensor(shape, Tensor::DefaultStrides(shape), data,
+                        header.dtype_, blob_fn(data));
+    } else {
+        tensor = Tensor(shape, header.dtype_, Device("CPU:0"));
+        std::memcpy(tensor.GetDataPtr(), data, byte_size);
+    }
+
+    if (header.fortran_order_ && ndims > 1) {
+        SizeVector dims(ndims);
+        for (int64_t i = 0; i < ndims; ++i) {
+            dims[i] = ndims - 1 - i;
+        }
+        tensor = tensor.Permute(dims);
+    }
+    return tensor;
+}
+
+std::function<std::shared_ptr<Blob>(void*)> MappedBlobFn(
+        const std::shared_ptr<utility::MappedFile>& mapped_file) {
+    return [mapped_file](void* data) {
+        return std::make_shared<Blob>(mapped_file, data);
+    };
+}
+
+/// Returns \p tensor as a contiguous CPU Tensor, copying only if needed.
+Tensor ToContiguousCPU(const Tensor& tensor) {
+    Device cpu("CPU:0");
+    if (tensor.GetDevice() != cpu) {
+        return tensor.Copy(cpu);
+    }
+    return tensor.Contiguous();
+}
+
+void WriteOrThrow(FILE* file,
+                  const void* data,
+                  int64_t size,
+                  const std::string& file_name) {
+    if (size > 0 && std::fwrite(data, 1, static_cast<size_t>(size), file) !=
+                            static_cast<size_t>(size)) {
+        std::fclose(file);
+        utility::LogError("Failed to write {}.", file_name);
+    }
+}
+
+uint32_t UpdateCRC32(uint32_t crc, const char* data, int64_t size) {
+    // zlib's crc32() takes 32-bit lengths.
+    const int64_t kChunkSize = 1 << 30;
+    while (size > 0) {
+        const int64_t chunk = std::min(size, kChunkSize);
+        crc = static_cast<uint32_t>(
+                crc32(crc, reinterpret_cast<const Bytef*>(data),
+                      static_cast<uInt>(chunk)));
+        data += chunk;
+        size -= chunk;
+    }
+    return crc;
+}
+
+struct ZipEntry {
+    std::string name_;
+    uint16_t method_ = 0;
+    uint32_t crc32_ = 0;
+    int64_t compressed_size_ = 0;
+    int64_t uncompressed_size_ = 0;
+    int64_t local_header_offset_ = 0;
+};
+
+std::vector<ZipEntry> ReadZipDirectory(const char* data,
+                                       int64_t size,
+                                       const std::string& file_name) {
+    // The end of central directory record is at least 22 bytes and may be
+    // followed by a comment of up to 65535 bytes.
+    int64_t end_offset = -1;
+    for (int64_t offset = size - 22;
+         offset >= 0 && offset >= size - 22 - kZip16Max; --offset) {
+        if (ReadLE<uint32_t>(data + offset) == kZipEndSignature) {
+            end_offset = offset;
+            break;
+        }
+    }
+    if (end_offset < 0) {
+        utility::LogError("{} is not a valid .npz file.", file_name);
+    }
+    int64_t num_entries = ReadLE<uint16_t>(data + end_offset + 10);
+    int64_t directory_offset = ReadLE<uint32_t>(data + end_offset + 16);
+    if (num_entries == kZip16Max || directory_offset == kZip32Max) {
+        const int64_t locator_offset = end_offset - 20;
+        if (locator_offset < 0 || ReadLE<uint32_t>(data + locator_offset) !=
+                                          kZip64LocatorSignature) {
+            utility::LogError("{} is not a valid .npz file.", file_name);
+        }
+        const int64_t end64_offset =
+                ReadLE<uint64_t>(data + locator_offset + 8);
+        if (end64_offset < 0 || end64_offset + 56 > size ||
+            ReadLE<uint32_t>(data + end64_offset) != kZip64EndSignature) {
+            utility::LogError("{} is not a valid .npz file.", file_name);
+        }
+        num_entries = ReadLE<uint64_t>(data + end64_offset + 32);
+        directory_offset = ReadLE<uint64_t>(data + end64_offset + 48);
+    }
+
+    std::vector<ZipEntry> entries;
+    int64_t offset = directory_offset;
+    for (int64_t i = 0; i < num_entries; ++i) {
+        if (offset < 0 || offset + 46 > size ||
+            ReadLE<uint32_t>(data + offset) != kZipCentralHeaderSignature) {
+            utility::LogError("{} is not a valid .npz file.", file_name);
+        }
+        ZipEntry entry;
+        entry.method_ = ReadLE<uint16_t>(data + offset + 10);
+        entry.crc32_ = ReadLE<uint32_t>(data + offset + 16);
+        entry.compressed_size_ = ReadLE<uint32_t>(data + offset + 20);
+        entry.uncompressed_size_ = ReadLE<uint32_t>(data + offset + 24);
+        const int64_t name_size = ReadLE<uint16_t>(data + offset + 28);
+        const int64_t extra_size = ReadLE<uint16_t>(data + offset + 30);
+        const int64_t comment_size = ReadLE<uint16_t>(data + offset + 32);
+        entry.local_header_offset_ = ReadLE<uint32_t>(data + offset + 42);
+        if (offset + 46 + name_size + extra_size > size) {
+            utility::LogError("{} is not a valid .npz file.", file_name);
+        }
+        entry.name_ = std::string(data + offset + 46, name_size);
+
+        // Sizes and offsets that do not fit in 32 bits are stored in the
+        // zip64 extra field, in this order.
+        const char* extra = data + offset + 46 + name_size;
+        const char* extra_end = extra + extra_size;
+        while (extra + 4 <= extra_end) {
+            const uint16_t id = ReadLE<uint16_t>(extra);
+            const uint16_t field_size = ReadLE<uint16_t>(extra + 2);
+            const char* field = extra + 4;
+            const char* field_end = field + field_size;
+            if (field_end > extra_end) {
+                break;
+            }
+            if (id == kZip64ExtraId) {
+                for (int64_t* value :
+                     {&entry.uncompressed_size_, &entry.compressed_size_,
+                      &entry.local_header_offset_}) {
+                    if (*value == kZip32Max && field + 8 <= field_end) {
+                        *value = ReadLE<uint64_t>(field);
+                        field += 8;
+                    }
+                }
+            }
+            extra = field_end;
+        }
+        entries.push_back(entry);
+        offset += 46 + name_size + extra_size + comment_size;
+    }
+    return entries;
+}
+
+/// Returns the offset of \p entry's data from the beginning of the archive.
+int64_t GetZipEntryDataOffset(const ZipEntry& entry,
+                              const char* data,
+                              int64_t size,
+                              const std::string& file_name) {
+    const int64_t offset = entry.local_header_offset_;
+    if (offset < 0 || offset + 30 > size ||
+        ReadLE<uint32_t>(data + offset) != kZipLocalHeaderSignature) {
+        utility::LogError("{} is not a valid .npz file.", file_name);
+    }
+    const int64_t data_offset = offset + 30 +
+                                ReadLE<uint16_t>(data + offset + 26) +
+                                ReadLE<uint16_t>(data + offset + 28);
+    if (data_offset + entry.compressed_size_ > size) {
+        utility::LogError("{} is truncated.", file_name);
+    }
+    return data_offset;
+}
+
+/// Decompresses a deflated zip entry into a new CPU Blob.
+std::shared_ptr<Blob> InflateZipEntry(const ZipEntry& entry,
+                                      const char* compressed,
+                                      const std::string& file_name) {
+    auto blob = std::make_shared<Blob>(entry.uncompressed_size_,
+                                       Device("CPU:0"));
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    // Negative window bits: raw deflate data without zlib header.
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        utility::LogError("Failed to initialize zlib.");
+    }
+    // zlib's counters are 32-bit, so feed and drain at most 1 GiB at a time.
+    const int64_t kChunkSize = 1 << 30;
+    int64_t in_remaining = entry.compressed_size_;
+    int64_t out_remaining = entry.uncompressed_size_;
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed));
+    stream.next_out = static_cast<Bytef*>(blob->GetDataPtr());
+    int status = Z_OK;
+    while (status == Z_OK) {
+        if (stream.avail_in == 0) {
+            stream.avail_in =
+                    static_cast<uInt>(std::min(in_remaining, kChunkSize));
+            in_remaining -= stream.avail_in;
+        }
+        if (stream.avail_out == 0) {
+            stream.avail_out =
+                    static_cast<uInt>(std::min(out_remaining, kChunkSize));
+            out_remaining -= stream.avail_out;
+        }
+        status = inflate(&stream, Z_NO_FLUSH);
+        if (status == Z_BUF_ERROR && stream.avail_in == 0 &&
+            in_remaining == 0) {
+            break;
+        }
+    }
+    const bool complete = status == Z_STREAM_END && stream.avail_out == 0 &&
+                          out_remaining == 0;
+    inflateEnd(&stream);
+    if (!complete) {
+        utility::LogError("Failed to decompress {} in {}.", entry.name_,
+                          file_name);
+    }
+    const uint32_t crc =
+            UpdateCRC32(0, static_cast<const char*>(blob->GetDataPtr()),
+                        entry.uncompressed_size_);
+    if (crc != entry.crc32_) {
+        utility::LogError("CRC mismatch for {} in {}.", entry.name_,
+                          file_name);
+    }
+    return blob;
+}
+
+}  // unnamed namespace
+
+Tensor ReadNpy(const std::string& file_name, bool mmap) {
+    auto mapped_file = std::make_shared<utility::MappedFile>(
+            file_name, mmap ? utility::MappedFile::Mode::CopyOnWrite
+                            : utility::MappedFile::Mode::ReadOnly);
+    return NpyToTensor(mapped_file->GetData(), mapped_file->GetSize(),
+                       mmap ? MappedBlobFn(mapped_file) : nullptr, file_name);
+}
+
+void WriteNpy(const std::string& file_name, const Tensor& tensor) {
+    Tensor src = ToContiguousCPU(tensor);
+    const std::string header = MakeNpyHeader(src);
+    FILE* file = utility::filesystem::FOpen(file_name, "wb");
+    if (file == nullptr) {
+        utility::LogError("Failed to open {} for writing.", file_name);
+    }
+    WriteOrThrow(file, header.data(), header.size(), file_name);
+    WriteOrThrow(file, src.GetDataPtr(),
+                 src.NumElements() * DtypeUtil::ByteSize(src.GetDtype()),
+                 file_name);
+    if (std::fclose(file) != 0) {
+        utility::LogError("Failed to write {}.", file_name);
+    }
+}
+
+std::unordered_map<std::string, Tensor> ReadNpz(const std::string& file_name,
+                                                bool mmap) {
+    auto mapped_file = std::make_shared<utility::MappedFile>(
+            file_name, mmap ? utility::MappedFile::Mode::CopyOnWrite
+                            : utility::MappedFile::Mode::ReadOnly);
+    const char* data = mapped_file->GetData();
+    const int64_t size = mapped_file->GetSize();
+
+    std::unordered_map<std::string, Tensor> tensors;
+    for (const ZipEntry& entry : ReadZipDirectory(data, size, file_name)) {
+        std::string name = entry.name_;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".npy") == 0) {
+            name.resize(name.size() - 4);
+        }
+        const char* entry_data =
+                data + GetZipEntryDataOffset(entry, data, size, file_name);
+        if (entry.method_ == 0) {
+            tensors[name] = NpyToTensor(
+                    entry_data, entry.compressed_size_,
+                    mmap ? MappedBlobFn(mapped_file) : nullptr, file_name);
+        } else if (entry.method_ == Z_DEFLATED) {
+            std::shared_ptr<Blob> blob =
+                    InflateZipEntry(entry, entry_data, file_name);
+            tensors[name] = NpyToTensor(
+                    static_cast<const char*>(blob->GetDataPtr()),
+                    entry.uncompressed_size_,
+                    [blob](void*) { return blob; }, file_name);
+        } else {
+            utility::LogError(
+                    "Unsupported compression method {} for {} in {}.",
+                    entry.method_, entry.name_, file_name);
+        }
+    }
+    return tensors;
+}
+
+void WriteNpz(const std::string& file_name,
+              const std::unordered_map<std::string, Tensor>& tensors) {
+    std::vector<std::string> names;
+    for (const auto& kv : tensors) {
+        names.push_back(kv.first);
+    }
+    std::sort(names.begin(), names.end());
+
+    FILE* file = utility::filesystem::FOpen(file_name, "wb");
+    if (file == nullptr) {
+        utility::LogError("Failed to open {} for writing.", file_name);
+    }
+
+    std::string directory;
+    int64_t offset = 0;
+    for (const std::string& name : names) {
+        Tensor src = ToContiguousCPU(tensors.at(name));
+        const std::string npy_header = MakeNpyHeader(src);
+        const char* npy_data = static_cast<const char*>(src.GetDataPtr());
+        const int64_t npy_data_size =
+                src.NumElements() * DtypeUtil::ByteSize(src.GetDtype());
+        const int64_t entry_size =
+                static_cast<int64_t>(npy_header.size()) + npy_data_size;
+        const uint32_t crc = UpdateCRC32(
+                UpdateCRC32(0, npy_header.data(), npy_header.size()), npy_data,
+                npy_data_size);
+        const std::string entry_name = name + ".npy";
+        const bool zip64_size = entry_size >= kZip32Max;
+        const bool zip64_offset = offset >= kZip32Max;
+        const uint16_t version = zip64_size || zip64_offset ? 45 : 20;
+        const uint32_t size32 =
+                zip64_size ? kZip32Max : static_cast<uint32_t>(entry_size);
+        const uint32_t offset32 =
+                zip64_offset ? kZip32Max : static_cast<uint32_t>(offset);
+
+        std::string local;
+        AppendLE<uint32_t>(local, kZipLocalHeaderSignature);
+        AppendLE<uint16_t>(local, version);
+        AppendLE<uint16_t>(local, 0);  // Flags.
+        AppendLE<uint16_t>(local, 0);  // Stored without compression.
+        AppendLE<uint16_t>(local, 0);  // Modification time.
+        AppendLE<uint16_t>(local, kZipDosDate);
+        AppendLE<uint32_t>(local, crc);
+        AppendLE<uint32_t>(local, size32);  // Compressed size.
+        AppendLE<uint32_t>(local, size32);  // Uncompressed size.
+        AppendLE<uint16_t>(local, static_cast<uint16_t>(entry_name.size()));
+        AppendLE<uint16_t>(local, zip64_size ? 20 : 0);
+        local += entry_name;
+        if (zip64_size) {
+            AppendLE<uint16_t>(local, kZip64ExtraId);
+            AppendLE<uint16_t>(local, 16);
+            AppendLE<uint64_t>(local, entry_size);
+            AppendLE<uint64_t>(local, entry_size);
+        }
+        WriteOrThrow(file, local.data(), local.size(), file_name);
+        WriteOrThrow(file, npy_header.data(), npy_header.size(), file_name);
+        WriteOrThrow(file, npy_data, npy_data_size, file_name);
+
+        std::string extra;
+        if (zip64_size) {
+            AppendLE<uint64_t>(extra, entry_size);
+            AppendLE<uint64_t>(extra, entry_size);
+        }
+        if (zip64_offset) {
+            AppendLE<uint64_t>(extra, offset);
+        }
+        const uint16_t extra_field_size =
+                extra.empty() ? 0 : static_cast<uint16_t>(extra.size() + 4);
+        AppendLE<uint32_t>(directory, kZipCentralHeaderSignature);
+        AppendLE<uint16_t>(directory, version);  // Version made by.
+        AppendLE<uint16_t>(directory, version);  // Version needed.
+        AppendLE<uint16_t>(directory, 0);        // Flags.
+        AppendLE<uint16_t>(directory, 0);        // Compression method.
+        AppendLE<uint16_t>(directory, 0);        // Modification time.
+        AppendLE<uint16_t>(directory, kZipDosDate);
+        AppendLE<uint32_t>(directory, crc);
+        AppendLE<uint32_t>(directory, size32);
+        AppendLE<uint32_t>(directory, size32);
+        AppendLE<uint16_t>(directory,
+                           static_cast<uint16_t>(entry_name.size()));
+        AppendLE<uint16_t>(directory, extra_field_size);
+        AppendLE<uint16_t>(directory, 0);  // Comment length.
+        AppendLE<uint16_t>(directory, 0);  // Disk number.
+        AppendLE<uint16_t>(directory, 0);  // Internal attributes.
+        AppendLE<uint32_t>(directory, 0);  // External attributes.
+        AppendLE<uint32_t>(directory, offset32);
+        directory += entry_name;
+        if (!extra.empty()) {
+            AppendLE<uint16_t>(directory, kZip64ExtraId);
+            AppendLE<uint16_t>(directory, static_cast<uint16_t>(extra.size()));
+            directory += extra;
+        }
+        offset += static_cast<int64_t>(local.size()) + entry_size;
+    }
+
+    const int64_t num_entries = static_cast<int64_t>(names.size());
+    const int64_t directory_size = static_cast<int64_t>(directory.size());
+    const bool zip64_end = num_entries >= kZip16Max ||
+                           offset >= kZip32Max || directory_size >= kZip32Max;
+    std::string end;
+    if (zip64_end) {
+        const int64_t end64_offset = offset + directory_size;
+        AppendLE<uint32_t>(end, kZip64EndSignature);
+        AppendLE<uint64_t>(end, 44);  // Size of the remaining record.
+        AppendLE<uint16_t>(end, 45);  // Version made by.
+        AppendLE<uint16_t>(end, 45);  // Version needed.
+        AppendLE<uint32_t>(end, 0);   // Disk number.
+        AppendLE<uint32_t>(end, 0);   // Disk with the central directory.
+        AppendLE<uint64_t>(end, num_entries);
+        AppendLE<uint64_t>(end, num_entries);
+        AppendLE<uint64_t>(end, directory_size);
+        AppendLE<uint64_t>(end, offset);
+        AppendLE<uint32_t>(end, kZip64LocatorSignature);
+        AppendLE<uint32_t>(end, 0);
+        AppendLE<uint64_t>(end, end64_offset);
+        AppendLE<uint32_t>(end, 1);  // Total number of disks.
+    }
+    AppendLE<uint32_t>(end, kZipEndSignature);
+    AppendLE<uint16_t>(end, 0);  // Disk number.
+    AppendLE<uint16_t>(end, 0);  // Disk with the central directory.
+    for (int i = 0; i < 2; ++i) {
+        AppendLE<uint16_t>(end, zip64_end ? kZip16Max
+                                          : static_cast<uint16_t>(num_entries));
+    }
+    AppendLE<uint32_t>(end, zip64_end ? kZip32Max
+                                      : static_cast<uint32_t>(directory_size));
+    AppendLE<uint32_t>(end,
+                       zip64_end ? kZip32Max : static_cast<uint32_t>(offset));
+    AppendLE<uint16_t>(end, 0);  // Comment length.
+
+    WriteOrThrow(file, directory.data(), directory.size(), file_name);
+    WriteOrThrow(file, end.data(), end.size(), file_name);
+    if (std::fclose(file) != 0) {
+        utility::LogError("Failed to write {}.", file_name);
+    }
+}
+
+}  // namespace open3d
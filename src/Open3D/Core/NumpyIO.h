@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// Reads a Tensor from a NumPy .npy file.
+///
+/// \param file_name Path to the .npy file.
+/// \param mmap If true, the returned CPU Tensor is backed by a copy-on-write
+/// memory mapping of the file. Opening is instant, pages are read on first
+/// access, and modifications are never written back to the file. If false,
+/// the data is copied into memory.
+///
+/// Fortran-ordered arrays are returned as a transposed (non-contiguous) view.
+Tensor ReadNpy(const std::string& file_name, bool mmap = false);
+
+/// Writes \p tensor to a NumPy .npy file.
+void WriteNpy(const std::string& file_name, const Tensor& tensor);
+
+/// Reads all arrays from a NumPy .npz file, keyed by array name. Entries stored
+/// without compression (numpy.savez()) can be memory-mapped, see ReadNpy().
+/// Compressed entries (numpy.savez_compressed()) are always decompressed into
+/// memory.
+std::unordered_map<std::string, Tensor> ReadNpz(const std::string& file_name,
+                                                bool mmap = false);
+
+/// Writes \p tensors to an uncompressed NumPy .npz file, like numpy.savez().
+/// Arrays are stored in the order of their names.
+void WriteNpz(const std::string& file_name,
+              const std::unordered_map<std::string, Tensor>& tensors);
+
+}  // namespace open3d
@@ -26,25 +26,18 @@
 
 #pragma once
 
+#include "Open3D/Utility/Parallel.h"
+
 namespace open3d {
 namespace kernel {
 namespace parallel_util {
 
-inline int GetMaxThreads() {
-#ifdef _OPENMP
-    return omp_get_max_threads();
-#else
-    return 1;
-#endif
-}
+/// Number of threads CPU kernels may use, see utility::GetMaxThreads().
+inline int GetMaxThreads() { return utility::GetMaxThreads(); }
 
-inline bool InParallel() {
-#ifdef _OPENMP
-    return omp_in_parallel();
-#else
-    return false;
-#endif
-}
+/// Whether the caller runs inside a parallel loop, see
+/// utility::InParallel().
+inline bool InParallel() { return utility::InParallel(); }
 
 }  // namespace parallel_util
 }  // namespace kernel
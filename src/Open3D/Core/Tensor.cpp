@@ -26,6 +26,7 @@
 
 #include "Open3D/Core/Tensor.h"
 
+#include <limits>
 #include <sstream>
 
 #include "Open3D/Core/AdvancedIndexing.h"
@@ -34,10 +35,13 @@
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Dtype.h"
 #include "Open3D/Core/Kernel/Kernel.h"
+#include "Open3D/Core/NumpyIO.h"
 #include "Open3D/Core/ShapeUtil.h"
 #include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/TensorExpr.h"
 #include "Open3D/Core/TensorKey.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
 
 namespace open3d {
 
@@ -73,6 +77,18 @@ Tensor& Tensor::operator=(Tensor&& other) && {
     return *this;
 }
 
+/// Tensor assignment lvalue = expression, e.g. `tensor_a = expr`
+Tensor& Tensor::operator=(const TensorExpr& expr) & {
+    *this = expr.Contiguous();
+    return *this;
+}
+
+/// Tensor assignment rvalue = expression, e.g. `tensor_a[0] = expr`
+Tensor& Tensor::operator=(const TensorExpr& expr) && {
+    expr.AssignTo(*this);
+    return *this;
+}
+
 Tensor Tensor::Empty(const SizeVector& shape,
                      Dtype dtype,
                      const Device& device) {
@@ -362,6 +378,42 @@ Tensor Tensor::Contiguous() const {
     }
 }
 
+Tensor Tensor::Load(const std::string& file_name, bool mmap) {
+    std::string ext =
+            utility::filesystem::GetFileExtensionInLowerCase(file_name);
+    if (ext == "npy") {
+        return ReadNpy(file_name, mmap);
+    } else if (ext == "npz") {
+        std::unordered_map<std::string, Tensor> tensors =
+                ReadNpz(file_name, mmap);
+        if (tensors.size() != 1) {
+            utility::LogError(
+                    "{} holds {} arrays, but Load() expects exactly one. Use "
+                    "ReadNpz() instead.",
+                    file_name, tensors.size());
+        }
+        return tensors.begin()->second;
+    }
+    utility::LogError(
+            "Unsupported file extension of {}, expected .npy or .npz.",
+            file_name);
+    return Tensor();
+}
+
+void Tensor::Save(const std::string& file_name) const {
+    std::string ext =
+            utility::filesystem::GetFileExtensionInLowerCase(file_name);
+    if (ext == "npy") {
+        WriteNpy(file_name, *this);
+    } else if (ext == "npz") {
+        WriteNpz(file_name, {{"arr_0", *this}});
+    } else {
+        utility::LogError(
+                "Unsupported file extension of {}, expected .npy or .npz.",
+                file_name);
+    }
+}
+
 SizeVector Tensor::DefaultStrides(const SizeVector& shape) {
     SizeVector strides(shape.size());
     int64_t stride_size = 1;
@@ -488,6 +540,9 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
     std::string str = "";
     if (dtype_ == Dtype::Bool) {
         str = *static_cast<const unsigned char*>(ptr) ? "True" : "False";
+    } else if (dtype_ == Dtype::Float16) {
+        str = fmt::format("{}",
+                          static_cast<float>(*static_cast<const Half*>(ptr)));
     } else {
         DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
             str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
@@ -626,6 +681,8 @@ Tensor Tensor::T() const {
     }
 }
 
+TensorExpr Tensor::Lazy() const { return TensorExpr(*this); }
+
 Tensor Tensor::Add(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -716,6 +773,102 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
+    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
+               GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Mean);
+    return dst;
+}
+
+Tensor Tensor::Var(const SizeVector& dims, bool keepdim, int64_t ddof) const {
+    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
+               GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Var);
+    if (ddof != 0) {
+        // The kernel computes the population variance, rescale from N to
+        // N - ddof degrees of freedom.
+        int64_t num_reduced = dst.NumElements() == 0
+                                      ? 0
+                                      : NumElements() / dst.NumElements();
+        double scale =
+                num_reduced > ddof
+                        ? double(num_reduced) / double(num_reduced - ddof)
+                        : std::numeric_limits<double>::quiet_NaN();
+        dst.Mul_(Tensor::Full({}, scale, dtype_, GetDevice()));
+    }
+    return dst;
+}
+
+Tensor Tensor::Std(const SizeVector& dims, bool keepdim, int64_t ddof) const {
+    if (ddof != 0) {
+        return Var(dims, keepdim, ddof).Sqrt();
+    }
+    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
+               GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Std);
+    return dst;
+}
+
+Tensor Tensor::Any(const SizeVector& dims, bool keepdim) const {
+    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), Dtype::Bool,
+               GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Any);
+    return dst;
+}
+
+Tensor Tensor::All(const SizeVector& dims, bool keepdim) const {
+    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), Dtype::Bool,
+               GetDevice());
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::All);
+    return dst;
+}
+
+Tensor Tensor::Matmul(const Tensor& rhs) const {
+    if (NumDims() == 0 || rhs.NumDims() == 0) {
+        utility::LogError(
+                "Matmul does not support 0-dim Tensors, but got shapes {} and "
+                "{}.",
+                shape_, rhs.shape_);
+    }
+    // Promote 1-D operands to matrices.
+    Tensor lhs_mat = NumDims() == 1 ? Reshape({1, shape_[0]}) : *this;
+    Tensor rhs_mat =
+            rhs.NumDims() == 1 ? rhs.Reshape({rhs.shape_[0], 1}) : rhs;
+    const SizeVector& lhs_shape = lhs_mat.GetShape();
+    const SizeVector& rhs_shape = rhs_mat.GetShape();
+    int64_t m = lhs_shape[lhs_shape.size() - 2];
+    int64_t k = lhs_shape[lhs_shape.size() - 1];
+    int64_t n = rhs_shape[rhs_shape.size() - 1];
+    if (rhs_shape[rhs_shape.size() - 2] != k) {
+        utility::LogError("Matmul shape mismatch: {} @ {}.", shape_,
+                          rhs.shape_);
+    }
+
+    SizeVector batch_shape = shape_util::BroadcastedShape(
+            SizeVector(lhs_shape.begin(), lhs_shape.end() - 2),
+            SizeVector(rhs_shape.begin(), rhs_shape.end() - 2));
+    SizeVector lhs_expanded_shape = batch_shape;
+    lhs_expanded_shape.insert(lhs_expanded_shape.end(), {m, k});
+    SizeVector rhs_expanded_shape = batch_shape;
+    rhs_expanded_shape.insert(rhs_expanded_shape.end(), {k, n});
+    SizeVector dst_shape = batch_shape;
+    dst_shape.insert(dst_shape.end(), {m, n});
+
+    Tensor dst(dst_shape, dtype_, GetDevice());
+    kernel::Matmul(lhs_mat.Expand(lhs_expanded_shape),
+                   rhs_mat.Expand(rhs_expanded_shape), dst);
+
+    // Remove the promoted dimensions.
+    SizeVector result_shape = batch_shape;
+    if (NumDims() != 1) {
+        result_shape.push_back(m);
+    }
+    if (rhs.NumDims() != 1) {
+        result_shape.push_back(n);
+    }
+    return dst.Reshape(result_shape);
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -41,6 +41,8 @@
 
 namespace open3d {
 
+class TensorExpr;
+
 /// A Tensor is a "view" of a data Blob with shape, stride, data_ptr.
 /// Tensor can also be used to perform numerical operations.
 class Tensor {
@@ -125,6 +127,15 @@ public:
     /// Tensor assignment rvalue = rvalue, e.g. `tensor_a[0] = tensor_b[0]`
     Tensor& operator=(Tensor&& other) &&;
 
+    /// Tensor assignment lvalue = expression, e.g. `tensor_a = tensor_b.Lazy()
+    /// + tensor_c`. The expression is evaluated into a new contiguous Tensor.
+    Tensor& operator=(const TensorExpr& expr) &;
+
+    /// Tensor assignment rvalue = expression, e.g. `tensor_a[0] =
+    /// tensor_b.Lazy() + tensor_c`. The expression is evaluated directly into
+    /// the memory of tensor_a[0].
+    Tensor& operator=(const TensorExpr& expr) &&;
+
     /// Tensor assignment rvalue = rvalue_scalar, e.g. `tensor_a[0] = 100`
     /// Implicit casting is performed to the underlying dtype.
     ///
@@ -259,6 +270,19 @@ public:
         return dlpack::FromDLPack(src);
     }
 
+    /// Loads a Tensor from a NumPy .npy file, or from a .npz file holding a
+    /// single array. Use ReadNpz() for .npz files with several arrays.
+    ///
+    /// If \p mmap is true, the returned CPU Tensor is backed by a copy-on-write
+    /// memory mapping of the file, so that large files open instantly and are
+    /// paged in on demand. Modifications are not written back to the file.
+    static Tensor Load(const std::string& file_name, bool mmap = false);
+
+    /// Saves the Tensor to a NumPy .npy or .npz file, chosen by the extension
+    /// of \p file_name. In a .npz file the Tensor is named "arr_0", like
+    /// numpy.savez() does.
+    void Save(const std::string& file_name) const;
+
     /// Assign (copy) values from another Tensor, shape, dtype, device may
     /// change. Slices of the original Tensor still keeps the original memory.
     /// After assignment, the Tensor will be contiguous.
@@ -398,6 +422,11 @@ public:
         return value;
     }
 
+    /// Returns a deferred expression referencing this tensor. Elementwise ops
+    /// on the expression are recorded and evaluated in a single fused pass on
+    /// assignment or TensorExpr::Contiguous(). See TensorExpr.
+    TensorExpr Lazy() const;
+
     /// Adds a tensor and returns the resulting tensor.
     Tensor Add(const Tensor& value) const;
     template <typename T>
@@ -538,6 +567,53 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Returns the mean of the tensor along the given \p dims. Only Float16,
+    /// Float32 and Float64 are supported.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    Tensor Mean(const SizeVector& dims, bool keepdim = false) const;
+
+    /// Returns the variance of the tensor along the given \p dims, i.e. the
+    /// sum of squared deviations from the mean divided by N - \p ddof, where N
+    /// is the number of reduced elements. Only Float16, Float32 and Float64
+    /// are supported.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    /// \param ddof Delta degrees of freedom, 1 for the unbiased estimator.
+    Tensor Var(const SizeVector& dims,
+               bool keepdim = false,
+               int64_t ddof = 0) const;
+
+    /// Returns the standard deviation of the tensor along the given \p dims,
+    /// the square root of Var(). Only Float16, Float32 and Float64 are
+    /// supported.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    /// \param ddof Delta degrees of freedom, 1 for the unbiased estimator.
+    Tensor Std(const SizeVector& dims,
+               bool keepdim = false,
+               int64_t ddof = 0) const;
+
+    /// Returns a boolean tensor, true where any element along the given \p
+    /// dims is non-zero.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    Tensor Any(const SizeVector& dims, bool keepdim = false) const;
+
+    /// Returns a boolean tensor, true where all elements along the given \p
+    /// dims are non-zero.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    Tensor All(const SizeVector& dims, bool keepdim = false) const;
+
+    /// Matrix product with the same semantics as numpy.matmul. Both Tensors
+    /// must have at least 1 dimension. A 1-D operand is promoted to a matrix
+    /// by prepending (lhs) or appending (rhs) a dimension of size 1, which is
+    /// removed from the result. Leading batch dimensions are broadcasted.
+    ///
+    /// E.g. {2, 1, 4, 3} @ {5, 3, 6} -> {2, 5, 4, 6}, {4, 3} @ {3} -> {4}.
+    Tensor Matmul(const Tensor& rhs) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
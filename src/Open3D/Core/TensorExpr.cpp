@@ -0,0 +1,345 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/TensorExpr.h"
+
+#include <vector>
+
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Kernel/FusedEW.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+struct TensorExpr::Node {
+    enum class Kind { Leaf, Unary, Binary };
+
+    Kind kind_ = Kind::Leaf;
+    /// Referenced tensor, for Kind::Leaf.
+    Tensor tensor_;
+    kernel::UnaryEWOpCode unary_op_code_ = kernel::UnaryEWOpCode::Neg;
+    kernel::BinaryEWOpCode binary_op_code_ = kernel::BinaryEWOpCode::Add;
+    /// Operands. Unary nodes only use lhs_.
+    std::shared_ptr<const Node> lhs_;
+    std::shared_ptr<const Node> rhs_;
+
+    SizeVector shape_;
+    Dtype dtype_ = Dtype::Undefined;
+    Device device_;
+    /// Number of leaves in the subtree, counting repeated tensors repeatedly.
+    int64_t num_leaves_ = 1;
+    /// Number of ops in the subtree.
+    int64_t num_ops_ = 0;
+};
+
+namespace {
+
+using NodePtr = std::shared_ptr<const TensorExpr::Node>;
+
+NodePtr MakeUnaryNode(kernel::UnaryEWOpCode op_code, const NodePtr& src) {
+    if (op_code != kernel::UnaryEWOpCode::Neg &&
+        op_code != kernel::UnaryEWOpCode::Abs &&
+        src->dtype_ != Dtype::Float16 && src->dtype_ != Dtype::Float32 &&
+        src->dtype_ != Dtype::Float64) {
+        utility::LogError(
+                "Only supports Float16, Float32 and Float64, but {} is used.",
+                DtypeUtil::ToString(src->dtype_));
+    }
+    auto node = std::make_shared<TensorExpr::Node>();
+    node->kind_ = TensorExpr::Node::Kind::Unary;
+    node->unary_op_code_ = op_code;
+    node->lhs_ = src;
+    node->shape_ = src->shape_;
+    node->dtype_ = src->dtype_;
+    node->device_ = src->device_;
+    node->num_leaves_ = src->num_leaves_;
+    node->num_ops_ = src->num_ops_ + 1;
+    return node;
+}
+
+NodePtr MakeBinaryNode(kernel::BinaryEWOpCode op_code,
+                       const NodePtr& lhs,
+                       const NodePtr& rhs) {
+    if (lhs->device_ != rhs->device_) {
+        utility::LogError("Device mismatch {} != {}.", lhs->device_.ToString(),
+                          rhs->device_.ToString());
+    }
+    if (lhs->dtype_ != rhs->dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(lhs->dtype_),
+                          DtypeUtil::ToString(rhs->dtype_));
+    }
+    auto node = std::make_shared<TensorExpr::Node>();
+    node->kind_ = TensorExpr::Node::Kind::Binary;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = lhs;
+    node->rhs_ = rhs;
+    node->shape_ = shape_util::BroadcastedShape(lhs->shape_, rhs->shape_);
+    node->dtype_ = lhs->dtype_;
+    node->device_ = lhs->device_;
+    node->num_leaves_ = lhs->num_leaves_ + rhs->num_leaves_;
+    node->num_ops_ = lhs->num_ops_ + rhs->num_ops_ + 1;
+    return node;
+}
+
+/// Evaluates the expression op by op with the eager Tensor ops.
+Tensor EvaluateEager(const NodePtr& node) {
+    switch (node->kind_) {
+        case TensorExpr::Node::Kind::Leaf:
+            return node->tensor_;
+        case TensorExpr::Node::Kind::Unary: {
+            Tensor src = EvaluateEager(node->lhs_);
+            switch (node->unary_op_code_) {
+                case kernel::UnaryEWOpCode::Sqrt:
+                    return src.Sqrt();
+                case kernel::UnaryEWOpCode::Sin:
+                    return src.Sin();
+                case kernel::UnaryEWOpCode::Cos:
+                    return src.Cos();
+                case kernel::UnaryEWOpCode::Neg:
+                    return src.Neg();
+                case kernel::UnaryEWOpCode::Exp:
+                    return src.Exp();
+                case kernel::UnaryEWOpCode::Abs:
+                    return src.Abs();
+                default:
+                    break;
+            }
+            break;
+        }
+        case TensorExpr::Node::Kind::Binary: {
+            Tensor lhs = EvaluateEager(node->lhs_);
+            Tensor rhs = EvaluateEager(node->rhs_);
+            switch (node->binary_op_code_) {
+                case kernel::BinaryEWOpCode::Add:
+                    return lhs.Add(rhs);
+                case kernel::BinaryEWOpCode::Sub:
+                    return lhs.Sub(rhs);
+                case kernel::BinaryEWOpCode::Mul:
+                    return lhs.Mul(rhs);
+                case kernel::BinaryEWOpCode::Div:
+                    return lhs.Div(rhs);
+                default:
+                    break;
+            }
+            break;
+        }
+    }
+    utility::LogError("Unsupported op in TensorExpr.");
+    return Tensor();
+}
+
+/// Flattens an expression tree into a fused kernel program. Repeated tensors
+/// are loaded once. Since a kernel takes at most MAX_INPUTS inputs, subtrees
+/// that do not fit into the remaining input slots are evaluated separately
+/// and enter the program as a single input.
+class FusedProgramBuilder {
+public:
+    int64_t AddNode(const NodePtr& node) {
+        const int64_t num_free = MAX_INPUTS - NumInputs();
+        switch (node->kind_) {
+            case TensorExpr::Node::Kind::Leaf:
+                return AddInput(node->tensor_);
+            case TensorExpr::Node::Kind::Unary: {
+                int64_t src = AddNode(node->lhs_);
+                return Emit(kernel::FusedEWInstruction::Unary(
+                        node->unary_op_code_, src));
+            }
+            case TensorExpr::Node::Kind::Binary: {
+                if (node->num_leaves_ > num_free && num_free < 2) {
+                    return AddInput(EvaluateSubtree(node));
+                }
+                // Keep at least one input slot for the rhs.
+                int64_t lhs = node->lhs_->num_leaves_ > num_free - 1
+                                      ? AddInput(EvaluateSubtree(node->lhs_))
+                                      : AddNode(node->lhs_);
+                int64_t rhs = AddNode(node->rhs_);
+                return Emit(kernel::FusedEWInstruction::Binary(
+                        node->binary_op_code_, lhs, rhs));
+            }
+        }
+        utility::LogError("Unsupported op in TensorExpr.");
+        return -1;
+    }
+
+    int64_t NumInputs() const { return static_cast<int64_t>(inputs_.size()); }
+
+    const std::vector<Tensor>& GetInputs() const { return inputs_; }
+
+    const std::vector<kernel::FusedEWInstruction>& GetProgram() const {
+        return program_;
+    }
+
+private:
+    int64_t AddInput(const Tensor& tensor) {
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            if (inputs_[i].GetDataPtr() == tensor.GetDataPtr() &&
+                inputs_[i].GetShape() == tensor.GetShape() &&
+                inputs_[i].GetStrides() == tensor.GetStrides() &&
+                inputs_[i].GetDtype() == tensor.GetDtype()) {
+                return input_regs_[i];
+            }
+        }
+        inputs_.push_back(tensor);
+        input_regs_.push_back(Emit(kernel::FusedEWInstruction::Input(
+                static_cast<int64_t>(inputs_.size()) - 1)));
+        return input_regs_.back();
+    }
+
+    int64_t Emit(const kernel::FusedEWInstruction& inst) {
+        program_.push_back(inst);
+        return static_cast<int64_t>(program_.size()) - 1;
+    }
+
+    static Tensor EvaluateSubtree(const NodePtr& node) {
+        return TensorExpr(node).Contiguous();
+    }
+
+    std::vector<Tensor> inputs_;
+    std::vector<int64_t> input_regs_;
+    std::vector<kernel::FusedEWInstruction> program_;
+};
+
+}  // unnamed namespace
+
+TensorExpr::TensorExpr(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->kind_ = Node::Kind::Leaf;
+    node->tensor_ = tensor;
+    node->shape_ = tensor.GetShape();
+    node->dtype_ = tensor.GetDtype();
+    node->device_ = tensor.GetDevice();
+    node_ = node;
+}
+
+TensorExpr::TensorExpr(const std::shared_ptr<const Node>& node) : node_(node) {}
+
+SizeVector TensorExpr::GetShape() const { return node_->shape_; }
+
+Dtype TensorExpr::GetDtype() const { return node_->dtype_; }
+
+Device TensorExpr::GetDevice() const { return node_->device_; }
+
+bool TensorExpr::IsLeaf() const { return node_->kind_ == Node::Kind::Leaf; }
+
+int64_t TensorExpr::NumOps() const { return node_->num_ops_; }
+
+Tensor TensorExpr::Contiguous() const {
+    if (IsLeaf()) {
+        return node_->tensor_.Contiguous();
+    }
+    Tensor dst(GetShape(), GetDtype(), GetDevice());
+    AssignTo(dst);
+    return dst;
+}
+
+void TensorExpr::AssignTo(Tensor& dst) const {
+    if (dst.GetDevice() != GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          GetDevice().ToString(), dst.GetDevice().ToString());
+    }
+    if (dst.GetDtype() != GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(GetDtype()),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+    if (!shape_util::CanBeBrocastedToShape(GetShape(), dst.GetShape())) {
+        utility::LogError("Expression shape {} cannot be broadcasted to {}.",
+                          GetShape(), dst.GetShape());
+    }
+    if (IsLeaf()) {
+        dst.AsRvalue() = node_->tensor_;
+        return;
+    }
+    if (GetDevice().GetType() != Device::DeviceType::CPU) {
+        dst.AsRvalue() = EvaluateEager(node_);
+        return;
+    }
+
+    FusedProgramBuilder builder;
+    builder.AddNode(node_);
+
+    // A single pass is only safe if dst does not overlap an input through a
+    // different view, otherwise elements could be overwritten before they are
+    // read.
+    for (const Tensor& input : builder.GetInputs()) {
+        if (input.GetBlob() == dst.GetBlob() &&
+            (input.GetDataPtr() != dst.GetDataPtr() ||
+             input.GetShape() != dst.GetShape() ||
+             input.GetStrides() != dst.GetStrides())) {
+            dst.AsRvalue() = Contiguous();
+            return;
+        }
+    }
+    kernel::FusedEW(builder.GetInputs(), builder.GetProgram(), dst);
+}
+
+TensorExpr TensorExpr::Add(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(kernel::BinaryEWOpCode::Add, node_, value.node_));
+}
+
+TensorExpr TensorExpr::Sub(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(kernel::BinaryEWOpCode::Sub, node_, value.node_));
+}
+
+TensorExpr TensorExpr::Mul(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(kernel::BinaryEWOpCode::Mul, node_, value.node_));
+}
+
+TensorExpr TensorExpr::Div(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(kernel::BinaryEWOpCode::Div, node_, value.node_));
+}
+
+TensorExpr TensorExpr::Sqrt() const {
+    return TensorExpr(MakeUnaryNode(kernel::UnaryEWOpCode::Sqrt, node_));
+}
+
+TensorExpr TensorExpr::Sin() const {
+    return TensorExpr(MakeUnaryNode(kernel::UnaryEWOpCode::Sin, node_));
+}
+
+TensorExpr TensorExpr::Cos() const {
+    return TensorExpr(MakeUnaryNode(kernel::UnaryEWOpCode::Cos, node_));
+}
+
+TensorExpr TensorExpr::Neg() const {
+    return TensorExpr(MakeUnaryNode(kernel::UnaryEWOpCode::Neg, node_));
+}
+
+TensorExpr TensorExpr::Exp() const {
+    return TensorExpr(MakeUnaryNode(kernel::UnaryEWOpCode::Exp, node_));
+}
+
+TensorExpr TensorExpr::Abs() const {
+    return TensorExpr(MakeUnaryNode(kernel::UnaryEWOpCode::Abs, node_));
+}
+
+}  // namespace open3d
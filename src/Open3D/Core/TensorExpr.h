@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// \class TensorExpr
+///
+/// \brief Deferred elementwise expression over Tensors.
+///
+/// Arithmetic on a TensorExpr records the operations instead of executing
+/// them. The whole expression is evaluated in a single fused pass over memory
+/// when it is assigned to a Tensor or when Contiguous() is called, instead of
+/// materializing a full-size temporary per operator. Broadcasting and dtype
+/// rules are the same as for the eager Tensor ops, and so are the results.
+///
+/// Expressions are started with Tensor::Lazy():
+/// ```cpp
+/// Tensor r = ((a.Lazy() - b) * c + d).Contiguous();
+/// r.Slice(0, 0, 1) = (a.Slice(0, 0, 1).Lazy() * 2).Abs();
+/// ```
+///
+/// Only Add, Sub, Mul, Div, Sqrt, Sin, Cos, Neg, Exp and Abs are recorded.
+/// On non-CPU devices, the expression is evaluated eagerly op by op.
+class TensorExpr {
+public:
+    /// Leaf expression referencing \p tensor. The tensor is not copied, so
+    /// later modifications of its values are visible at evaluation time.
+    TensorExpr(const Tensor& tensor);
+
+    /// Shape of the evaluated expression.
+    SizeVector GetShape() const;
+
+    /// Dtype of the evaluated expression.
+    Dtype GetDtype() const;
+
+    /// Device of the evaluated expression.
+    Device GetDevice() const;
+
+    /// Returns true if the expression is a plain Tensor without any op.
+    bool IsLeaf() const;
+
+    /// Number of recorded ops in the expression tree.
+    int64_t NumOps() const;
+
+    /// Evaluates the expression into a new contiguous Tensor.
+    Tensor Contiguous() const;
+
+    /// Evaluates the expression into the memory of \p dst. The expression's
+    /// shape must be broadcastable to \p dst's shape and the dtypes and devices
+    /// must match. Equivalent to `dst.AsRvalue() = expr`.
+    void AssignTo(Tensor& dst) const;
+
+    TensorExpr Add(const TensorExpr& value) const;
+    TensorExpr Sub(const TensorExpr& value) const;
+    TensorExpr Mul(const TensorExpr& value) const;
+    TensorExpr Div(const TensorExpr& value) const;
+
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+    TensorExpr operator-() const { return Neg(); }
+
+    // Exact matches for Tensor operands, so that the generic scalar-lhs
+    // operators declared in Tensor.h are not selected for `expr op tensor`.
+    TensorExpr operator+(const Tensor& value) const {
+        return Add(TensorExpr(value));
+    }
+    TensorExpr operator-(const Tensor& value) const {
+        return Sub(TensorExpr(value));
+    }
+    TensorExpr operator*(const Tensor& value) const {
+        return Mul(TensorExpr(value));
+    }
+    TensorExpr operator/(const Tensor& value) const {
+        return Div(TensorExpr(value));
+    }
+
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator+(T scalar_value) const {
+        return Add(Scalar(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator-(T scalar_value) const {
+        return Sub(Scalar(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator*(T scalar_value) const {
+        return Mul(Scalar(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator/(T scalar_value) const {
+        return Div(Scalar(scalar_value));
+    }
+
+    TensorExpr Sqrt() const;
+    TensorExpr Sin() const;
+    TensorExpr Cos() const;
+    TensorExpr Neg() const;
+    TensorExpr Exp() const;
+    TensorExpr Abs() const;
+
+    /// Recorded expression node, defined in TensorExpr.cpp.
+    struct Node;
+
+    /// Expression with the root \p node, for internal use.
+    explicit TensorExpr(const std::shared_ptr<const Node>& node);
+
+protected:
+    template <typename T>
+    Tensor Scalar(T scalar_value) const {
+        return Tensor::Full({}, scalar_value, GetDtype(), GetDevice());
+    }
+
+    std::shared_ptr<const Node> node_;
+};
+
+}  // namespace open3d
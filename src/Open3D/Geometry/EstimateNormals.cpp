@@ -25,10 +25,13 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Eigenvalues>
+#include <limits>
+#include <tuple>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 
@@ -217,38 +220,8 @@ Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
     }
 }
 
-Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
-                              const std::vector<int> &indices,
+Eigen::Vector3d ComputeNormal(Eigen::Matrix3d &covariance,
                               bool fast_normal_computation) {
-    if (indices.size() == 0) {
-        return Eigen::Vector3d::Zero();
-    }
-    Eigen::Matrix3d covariance;
-    Eigen::Matrix<double, 9, 1> cumulants;
-    cumulants.setZero();
-    for (size_t i = 0; i < indices.size(); i++) {
-        const Eigen::Vector3d &point = cloud.points_[indices[i]];
-        cumulants(0) += point(0);
-        cumulants(1) += point(1);
-        cumulants(2) += point(2);
-        cumulants(3) += point(0) * point(0);
-        cumulants(4) += point(0) * point(1);
-        cumulants(5) += point(0) * point(2);
-        cumulants(6) += point(1) * point(1);
-        cumulants(7) += point(1) * point(2);
-        cumulants(8) += point(2) * point(2);
-    }
-    cumulants /= (double)indices.size();
-    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
-    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
-    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
-    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
-    covariance(1, 0) = covariance(0, 1);
-    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
-    covariance(2, 0) = covariance(0, 2);
-    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
-    covariance(2, 1) = covariance(1, 2);
-
     if (fast_normal_computation) {
         return FastEigen3x3(covariance);
     } else {
@@ -258,6 +231,99 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     }
 }
 
+/// Number of points whose neighbors are looked up before their covariances
+/// are computed.
+constexpr int kNormalBlockSize = 8;
+
+/// Computes the covariances of the neighborhoods of \p num_lanes points. The
+/// neighbors of lane l are indices[l][0] to indices[l][counts[l] - 1] in the
+/// xyz-interleaved \p points.
+void ComputeCovarianceBlock(const double *points,
+                            const int *const *indices,
+                            const int *counts,
+                            int num_lanes,
+                            Eigen::Matrix3d *covariances) {
+    for (int l = 0; l < num_lanes; l++) {
+        Eigen::Matrix<double, 9, 1> cumulants;
+        cumulants.setZero();
+        for (int i = 0; i < counts[l]; i++) {
+            const double *point = points + 3 * int64_t(indices[l][i]);
+            cumulants(0) += point[0];
+            cumulants(1) += point[1];
+            cumulants(2) += point[2];
+            cumulants(3) += point[0] * point[0];
+            cumulants(4) += point[0] * point[1];
+            cumulants(5) += point[0] * point[2];
+            cumulants(6) += point[1] * point[1];
+            cumulants(7) += point[1] * point[2];
+            cumulants(8) += point[2] * point[2];
+        }
+        cumulants /= (double)std::max(counts[l], 1);
+        Eigen::Matrix3d &covariance = covariances[l];
+        covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
+        covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
+        covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
+        covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
+        covariance(1, 0) = covariance(0, 1);
+        covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
+        covariance(2, 0) = covariance(0, 2);
+        covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
+        covariance(2, 1) = covariance(1, 2);
+    }
+}
+
+/// Estimates the normals of points [begin, end) of \p cloud in blocks of
+/// kNormalBlockSize points. \p get_neighbors(i, buffer) returns the pointer
+/// to and the number of the neighbor indices of point i, and may use
+/// \p buffer to store them.
+template <typename func_t>
+void EstimateNormalsInBlocks(PointCloud &cloud,
+                             int64_t begin,
+                             int64_t end,
+                             bool has_normal,
+                             bool fast_normal_computation,
+                             func_t get_neighbors) {
+    const double *points = (const double *)cloud.points_.data();
+    utility::ParallelFor(begin, end, 256, [&](int64_t chunk_begin,
+                                              int64_t chunk_end) {
+        std::vector<int> buffers[kNormalBlockSize];
+        const int *indices[kNormalBlockSize];
+        int counts[kNormalBlockSize];
+        Eigen::Matrix3d covariances[kNormalBlockSize];
+        for (int64_t block = chunk_begin; block < chunk_end;
+             block += kNormalBlockSize) {
+            const int num_lanes = int(
+                    std::min<int64_t>(kNormalBlockSize, chunk_end - block));
+            for (int l = 0; l < num_lanes; l++) {
+                std::tie(indices[l], counts[l]) =
+                        get_neighbors(block + l, buffers[l]);
+            }
+            ComputeCovarianceBlock(points, indices, counts, num_lanes,
+                                   covariances);
+            for (int l = 0; l < num_lanes; l++) {
+                const int64_t i = block + l;
+                if (counts[l] < 3) {
+                    cloud.normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
+                    continue;
+                }
+                Eigen::Vector3d normal =
+                        ComputeNormal(covariances[l], fast_normal_computation);
+                if (normal.norm() == 0.0) {
+                    if (has_normal) {
+                        normal = cloud.normals_[i];
+                    } else {
+                        normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                    }
+                }
+                if (has_normal && normal.dot(cloud.normals_[i]) < 0.0) {
+                    normal *= -1.0;
+                }
+                cloud.normals_[i] = normal;
+            }
+        }
+    });
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -271,34 +337,76 @@ bool PointCloud::EstimateNormals(
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
-            if (normal.norm() == 0.0) {
-                if (has_normal) {
-                    normal = normals_[i];
-                } else {
-                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
-                }
-            }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
-                normal *= -1.0;
-            }
-            normals_[i] = normal;
-        } else {
-            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
-        }
-    }
+    kdtree.SearchBatchInBlocks(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)points_.data(),
+                                              3, points_.size()),
+            search_param,
+            [&](int64_t begin, int64_t end, const KDTreeSearchResult &result) {
+                EstimateNormalsInBlocks(
+                        *this, begin, end, has_normal, fast_normal_computation,
+                        [&](int64_t i, std::vector<int> &) {
+                            return std::make_pair(
+                                    result.Indices(i - begin),
+                                    result.NumNeighbors(i - begin));
+                        });
+            });
 
     return true;
 }
 
+bool PointCloud::EstimateNormalsOrganized(
+        int width,
+        int height,
+        int window_radius /* = 2 */,
+        double max_neighbor_distance /* = 0.0 */,
+        bool fast_normal_computation /* = true */) {
+    if (width <= 0 || height <= 0 ||
+        int64_t(width) * int64_t(height) != int64_t(points_.size())) {
+        utility::LogWarning(
+                "[EstimateNormalsOrganized] {:d} points do not form a {:d} x "
+                "{:d} grid.",
+                points_.size(), width, height);
+        return false;
+    }
+    if (window_radius < 1) {
+        utility::LogWarning(
+                "[EstimateNormalsOrganized] window_radius must be positive.");
+        return false;
+    }
+    bool has_normal = HasNormals();
+    if (HasNormals() == false) {
+        normals_.resize(points_.size());
+    }
+    const double max_distance2 =
+            max_neighbor_distance > 0.0
+                    ? max_neighbor_distance * max_neighbor_distance
+                    : std::numeric_limits<double>::infinity();
+    EstimateNormalsInBlocks(
+            *this, 0, int64_t(points_.size()), has_normal,
+            fast_normal_computation, [&](int64_t i, std::vector<int> &buffer) {
+                // NaN points, i.e. pixels without depth, fail the distance
+                // test and are neither neighbors nor centers.
+                buffer.clear();
+                const Eigen::Vector3d &center = points_[i];
+                const int v = int(i / width);
+                const int u = int(i % width);
+                for (int nv = std::max(v - window_radius, 0);
+                     nv <= std::min(v + window_radius, height - 1); nv++) {
+                    for (int nu = std::max(u - window_radius, 0);
+                         nu <= std::min(u + window_radius, width - 1); nu++) {
+                        const int j = nv * width + nu;
+                        if ((points_[j] - center).squaredNorm() <=
+                            max_distance2) {
+                            buffer.push_back(j);
+                        }
+                    }
+                }
+                return std::make_pair((const int *)buffer.data(),
+                                      int(buffer.size()));
+            });
+    return true;
+}
+
 bool PointCloud::OrientNormalsToAlignWithDirection(
         const Eigen::Vector3d &orientation_reference
         /* = Eigen::Vector3d(0.0, 0.0, 1.0)*/) {
@@ -307,17 +415,14 @@ bool PointCloud::OrientNormalsToAlignWithDirection(
                 "[OrientNormalsToAlignWithDirection] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelForEach(0, int64_t(points_.size()), [&](int64_t i) {
         auto &normal = normals_[i];
         if (normal.norm() == 0.0) {
             normal = orientation_reference;
         } else if (normal.dot(orientation_reference) < 0.0) {
             normal *= -1.0;
         }
-    }
+    });
     return true;
 }
 
@@ -328,10 +433,7 @@ bool PointCloud::OrientNormalsTowardsCameraLocation(
                 "[OrientNormalsTowardsCameraLocation] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelForEach(0, int64_t(points_.size()), [&](int64_t i) {
         Eigen::Vector3d orientation_reference = camera_location - points_[i];
         auto &normal = normals_[i];
         if (normal.norm() == 0.0) {
@@ -344,7 +446,7 @@ bool PointCloud::OrientNormalsTowardsCameraLocation(
         } else if (normal.dot(orientation_reference) < 0.0) {
             normal *= -1.0;
         }
-    }
+    });
     return true;
 }
 }  // namespace geometry
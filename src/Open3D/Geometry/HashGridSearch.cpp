@@ -0,0 +1,366 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/HashGridSearch.h"
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+HashGridSearch::HashGridSearch() {}
+
+HashGridSearch::HashGridSearch(const std::vector<Eigen::Vector3d> &points,
+                               double cell_size) {
+    SetPoints(points, cell_size);
+}
+
+HashGridSearch::~HashGridSearch() {}
+
+bool HashGridSearch::SetPoints(const std::vector<Eigen::Vector3d> &points,
+                               double cell_size) {
+    if (cell_size <= 0.0) {
+        utility::LogWarning(
+                "[HashGridSearch::SetPoints] Illegal cell size {}.",
+                cell_size);
+        return false;
+    }
+    cell_size_ = cell_size;
+    const int64_t num_points = int64_t(points.size());
+    std::vector<Cell> point_cells(num_points);
+    utility::ParallelForEach(
+            0, num_points,
+            [&](int64_t i) { point_cells[i] = GetCell(points[i]); }, 4096);
+    Cell min_cell = Cell::Zero();
+    Cell max_cell = Cell::Zero();
+    if (num_points > 0) {
+        min_cell = max_cell = point_cells[0];
+    }
+    for (const Cell &cell : point_cells) {
+        min_cell = min_cell.min(cell);
+        max_cell = max_cell.max(cell);
+    }
+
+    // Linear cell keys with z varying fastest. The key only decides the
+    // memory layout, so wrapping around on huge grids is harmless.
+    const Cell extent = max_cell - min_cell + 1;
+    std::vector<uint64_t> keys(num_points);
+    uint64_t max_key = 0;
+    for (int64_t i = 0; i < num_points; i++) {
+        const Cell offset = point_cells[i] - min_cell;
+        keys[i] = (uint64_t(offset(0)) * uint64_t(extent(1)) +
+                   uint64_t(offset(1))) *
+                          uint64_t(extent(2)) +
+                  uint64_t(offset(2));
+        max_key = std::max(max_key, keys[i]);
+    }
+
+    // Sort by key: a parallel counting sort into key ranges, then a sort of
+    // every range. Ties are broken by cell and index so that the layout does
+    // not depend on the thread schedule.
+    const int64_t num_ranges = std::max(int64_t(1), num_points / 256);
+    const uint64_t range_width = max_key / uint64_t(num_ranges) + 1;
+    std::unique_ptr<std::atomic<int>[]> counts(
+            new std::atomic<int>[num_ranges]);
+    for (int64_t r = 0; r < num_ranges; r++) {
+        counts[r] = 0;
+    }
+    utility::ParallelForEach(
+            0, num_points,
+            [&](int64_t i) {
+                counts[keys[i] / range_width].fetch_add(
+                        1, std::memory_order_relaxed);
+            },
+            4096);
+    std::vector<int> range_offsets(num_ranges + 1, 0);
+    for (int64_t r = 0; r < num_ranges; r++) {
+        range_offsets[r + 1] = range_offsets[r] + counts[r];
+        counts[r] = range_offsets[r];
+    }
+    indices_.resize(num_points);
+    utility::ParallelForEach(
+            0, num_points,
+            [&](int64_t i) {
+                int pos = counts[keys[i] / range_width].fetch_add(
+                        1, std::memory_order_relaxed);
+                indices_[pos] = int(i);
+            },
+            4096);
+    auto less = [&](int a, int b) {
+        if (keys[a] != keys[b]) {
+            return keys[a] < keys[b];
+        }
+        const Cell &ca = point_cells[a];
+        const Cell &cb = point_cells[b];
+        return std::make_tuple(ca(0), ca(1), ca(2), a) <
+               std::make_tuple(cb(0), cb(1), cb(2), b);
+    };
+    points_.resize(num_points);
+    utility::ParallelFor(0, num_ranges, 16, [&](int64_t begin, int64_t end) {
+        for (int64_t r = begin; r < end; r++) {
+            std::sort(indices_.begin() + range_offsets[r],
+                      indices_.begin() + range_offsets[r + 1], less);
+            for (int k = range_offsets[r]; k < range_offsets[r + 1]; k++) {
+                points_[k] = points[indices_[k]];
+            }
+        }
+    });
+
+    cells_.clear();
+    for (int k = 0; k < int(num_points); k++) {
+        const Cell &cell = point_cells[indices_[k]];
+        if (cells_.empty() || (cells_.back().cell_ != cell).any()) {
+            cells_.push_back(CellRange{cell, k, k});
+        }
+        cells_.back().end_ = k + 1;
+    }
+    // At most half of the slots are used, which keeps probe chains short.
+    size_t table_size = 1;
+    while (table_size < 2 * cells_.size()) {
+        table_size <<= 1;
+    }
+    table_.assign(table_size, -1);
+    for (int c = 0; c < int(cells_.size()); c++) {
+        size_t slot = GetSlot(cells_[c].cell_);
+        while (table_[slot] >= 0) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        table_[slot] = c;
+    }
+    return true;
+}
+
+int HashGridSearch::Search(const Eigen::Vector3d &query,
+                           const KDTreeSearchParam &param,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadius(
+                    query, ((const KDTreeSearchParamRadius &)param).radius_,
+                    indices, distance2);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybrid(
+                    query, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
+                    distance2);
+        case KDTreeSearchParam::SearchType::Knn:
+        default:
+            return -1;
+    }
+    return -1;
+}
+
+int HashGridSearch::SearchRadius(const Eigen::Vector3d &query,
+                                 double radius,
+                                 std::vector<int> &indices,
+                                 std::vector<double> &distance2) const {
+    if (points_.empty() || radius < 0.0) {
+        return -1;
+    }
+    return SearchNeighbors(query, radius, -1, indices, distance2);
+}
+
+int HashGridSearch::SearchHybrid(const Eigen::Vector3d &query,
+                                 double radius,
+                                 int max_nn,
+                                 std::vector<int> &indices,
+                                 std::vector<double> &distance2) const {
+    if (points_.empty() || radius < 0.0 || max_nn < 0) {
+        return -1;
+    }
+    return SearchNeighbors(query, radius, max_nn, indices, distance2);
+}
+
+bool HashGridSearch::SearchBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        const KDTreeSearchParam &param,
+        KDTreeSearchResult &result) const {
+    const int64_t num_queries = queries.cols();
+    std::vector<std::vector<int>> indices(num_queries);
+    std::vector<std::vector<double>> distance2(num_queries);
+    bool valid = queries.rows() == 3 && !points_.empty() &&
+                 param.GetSearchType() != KDTreeSearchParam::SearchType::Knn;
+    if (valid) {
+        std::vector<char> failed(num_queries, 0);
+        utility::ParallelForEach(
+                0, num_queries,
+                [&](int64_t i) {
+                    Eigen::Vector3d query = queries.col(i);
+                    failed[i] = Search(query, param, indices[i],
+                                       distance2[i]) < 0;
+                },
+                64);
+        valid = std::find(failed.begin(), failed.end(), 1) == failed.end();
+    }
+    if (!valid) {
+        result.offsets_.assign(num_queries + 1, 0);
+        result.indices_.clear();
+        result.distance2_.clear();
+        return false;
+    }
+    result.offsets_.resize(num_queries + 1);
+    result.offsets_[0] = 0;
+    for (int64_t i = 0; i < num_queries; i++) {
+        result.offsets_[i + 1] = result.offsets_[i] + indices[i].size();
+    }
+    result.indices_.resize(result.offsets_[num_queries]);
+    result.distance2_.resize(result.offsets_[num_queries]);
+    utility::ParallelForEach(
+            0, num_queries,
+            [&](int64_t i) {
+                std::copy(indices[i].begin(), indices[i].end(),
+                          result.indices_.begin() + result.offsets_[i]);
+                std::copy(distance2[i].begin(), distance2[i].end(),
+                          result.distance2_.begin() + result.offsets_[i]);
+            },
+            1024);
+    return true;
+}
+
+HashGridSearch::Cell HashGridSearch::GetCell(
+        const Eigen::Vector3d &point) const {
+    return (point.array() / cell_size_).floor().cast<int64_t>();
+}
+
+size_t HashGridSearch::GetSlot(const Cell &cell) const {
+    // Spatial hash of Teschner et al., "Optimized Spatial Hashing for
+    // Collision Detection of Deformable Objects", 2003, followed by a
+    // Fibonacci hash to mix its bits.
+    const uint64_t hash = (uint64_t(cell(0)) * 73856093) ^
+                          (uint64_t(cell(1)) * 19349663) ^
+                          (uint64_t(cell(2)) * 83492791);
+    return size_t((hash * 0x9E3779B97F4A7C15ull) >> 32) & (table_.size() - 1);
+}
+
+int HashGridSearch::FindCell(const Cell &cell) const {
+    if (table_.empty()) {
+        return -1;
+    }
+    for (size_t slot = GetSlot(cell); table_[slot] >= 0;
+         slot = (slot + 1) & (table_.size() - 1)) {
+        if ((cells_[table_[slot]].cell_ == cell).all()) {
+            return table_[slot];
+        }
+    }
+    return -1;
+}
+
+int HashGridSearch::SearchNeighbors(const Eigen::Vector3d &query,
+                                    double radius,
+                                    int max_nn,
+                                    std::vector<int> &indices,
+                                    std::vector<double> &distance2) const {
+    // The squared radius is rounded to float and compared strictly, as in
+    // KDTreeFlann, so that both backends find the same neighbors.
+    const double radius2 = float(radius * radius);
+    const int64_t reach = int64_t(std::ceil(radius / cell_size_));
+    const int64_t width = 2 * reach + 1;
+
+    std::vector<std::pair<double, int>> neighbors;
+    neighbors.reserve(64);
+    auto scan = [&](int begin, int end) {
+        for (int k = begin; k < end; k++) {
+            double d2 = (points_[k] - query).squaredNorm();
+            if (d2 < radius2) {
+                neighbors.emplace_back(d2, indices_[k]);
+            }
+        }
+    };
+    if (double(width) * width * width >= double(cells_.size())) {
+        scan(0, int(points_.size()));
+    } else {
+        // Visits the rows of cells along z in the order of points_, skipping
+        // the cells whose box is out of reach of the sphere. Consecutive
+        // occupied cells of a row are consecutive in cells_, so a row
+        // usually takes a single hash lookup and a single scan.
+        const Cell center = GetCell(query);
+        const Eigen::Array3d offset =
+                query.array() / cell_size_ - center.cast<double>();
+        // The slack keeps rounding errors from dropping a boundary cell.
+        const double reach2 = radius2 / (cell_size_ * cell_size_) + 1e-9;
+        auto gap2 = [&](int64_t d, int dim) {
+            double gap = d < 0 ? offset(dim) + double(-d - 1)
+                               : (d > 0 ? double(d) - offset(dim) : 0.0);
+            return gap * gap;
+        };
+        for (int64_t x = -reach; x <= reach; x++) {
+            const double gap2_x = gap2(x, 0);
+            for (int64_t y = -reach; y <= reach; y++) {
+                const double gap2_xy = gap2_x + gap2(y, 1);
+                int64_t z_min = -reach;
+                while (z_min <= reach && gap2_xy + gap2(z_min, 2) >= reach2) {
+                    z_min++;
+                }
+                int64_t z_max = reach;
+                while (z_max >= z_min && gap2_xy + gap2(z_max, 2) >= reach2) {
+                    z_max--;
+                }
+                Cell cell = center + Cell(x, y, z_min);
+                while (cell(2) <= center(2) + z_max) {
+                    int c = FindCell(cell);
+                    if (c < 0) {
+                        cell(2)++;
+                        continue;
+                    }
+                    const int begin = cells_[c].begin_;
+                    int end = cells_[c].end_;
+                    for (cell(2)++; cell(2) <= center(2) + z_max &&
+                                    c + 1 < int(cells_.size()) &&
+                                    (cells_[c + 1].cell_ == cell).all();
+                         cell(2)++) {
+                        end = cells_[++c].end_;
+                    }
+                    scan(begin, end);
+                }
+            }
+        }
+    }
+    if (max_nn >= 0 && neighbors.size() > size_t(max_nn)) {
+        std::partial_sort(neighbors.begin(), neighbors.begin() + max_nn,
+                          neighbors.end());
+        neighbors.resize(max_nn);
+    } else {
+        std::sort(neighbors.begin(), neighbors.end());
+    }
+    indices.resize(neighbors.size());
+    distance2.resize(neighbors.size());
+    for (size_t i = 0; i < neighbors.size(); i++) {
+        distance2[i] = neighbors[i].first;
+        indices[i] = neighbors[i].second;
+    }
+    return int(neighbors.size());
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class HashGridSearch
+///
+/// \brief Fixed radius neighbor search with a spatially hashed voxel grid.
+///
+/// Points are sorted by the cubic cell that contains them and the occupied
+/// cells are found through a hash table, so a query only scans the cells
+/// overlapping its search sphere. With a cell size equal to the search
+/// radius, that is 27 cells, which makes radius queries on clouds of
+/// roughly uniform density much faster than a KDTree. Only radius and
+/// hybrid searches are supported. Results are sorted by distance, then by
+/// index.
+class HashGridSearch {
+public:
+    /// \brief Default Constructor.
+    HashGridSearch();
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param points Points to index.
+    /// \param cell_size Edge length of the grid cells, normally the search
+    /// radius.
+    HashGridSearch(const std::vector<Eigen::Vector3d> &points,
+                   double cell_size);
+    ~HashGridSearch();
+
+public:
+    /// \brief Indexes a copy of \p points in cells of size \p cell_size.
+    ///
+    /// The points are sorted in parallel by a linear key of their cell, so
+    /// that neighboring cells tend to be close in memory.
+    bool SetPoints(const std::vector<Eigen::Vector3d> &points,
+                   double cell_size);
+
+    /// Edge length of the grid cells.
+    double GetCellSize() const { return cell_size_; }
+
+    /// Runs a radius or hybrid search. Returns -1 for KNN parameters.
+    int Search(const Eigen::Vector3d &query,
+               const KDTreeSearchParam &param,
+               std::vector<int> &indices,
+               std::vector<double> &distance2) const;
+
+    int SearchRadius(const Eigen::Vector3d &query,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    int SearchHybrid(const Eigen::Vector3d &query,
+                     double radius,
+                     int max_nn,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    /// See KDTreeFlann::SearchBatch(). Returns false for KNN parameters.
+    bool SearchBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                     const KDTreeSearchParam &param,
+                     KDTreeSearchResult &result) const;
+
+    /// See KDTreeFlann::SearchBatchInBlocks().
+    template <typename func_t>
+    void SearchBatchInBlocks(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                             const KDTreeSearchParam &param,
+                             func_t func,
+                             int64_t block_size = 65536) const {
+        KDTreeSearchResult result;
+        const int64_t num_queries = queries.cols();
+        for (int64_t begin = 0; begin < num_queries; begin += block_size) {
+            int64_t end = std::min(begin + block_size, num_queries);
+            SearchBatch(queries.middleCols(begin, end - begin), param, result);
+            func(begin, end, result);
+        }
+    }
+
+private:
+    /// Integer coordinates of a grid cell.
+    typedef Eigen::Array<int64_t, 3, 1> Cell;
+
+    /// Points of an occupied cell are points_[begin_] to points_[end_ - 1].
+    struct CellRange {
+        Cell cell_;
+        int begin_;
+        int end_;
+    };
+
+    /// Cell containing \p point.
+    Cell GetCell(const Eigen::Vector3d &point) const;
+    /// Slot of \p cell in table_ where probing starts.
+    size_t GetSlot(const Cell &cell) const;
+    /// Index in cells_ of \p cell, or -1 if the cell holds no point.
+    int FindCell(const Cell &cell) const;
+
+    /// Collects up to \p max_nn neighbors within \p radius, or all of them if
+    /// \p max_nn is negative.
+    int SearchNeighbors(const Eigen::Vector3d &query,
+                        double radius,
+                        int max_nn,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2) const;
+
+protected:
+    double cell_size_ = 0.0;
+    /// Points sorted by cell.
+    std::vector<Eigen::Vector3d> points_;
+    /// Index in the input of each point of points_.
+    std::vector<int> indices_;
+    /// Occupied cells, in the order of points_.
+    std::vector<CellRange> cells_;
+    /// Open addressing hash table of indices into cells_, -1 for empty
+    /// slots. Its size is a power of two.
+    std::vector<int> table_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
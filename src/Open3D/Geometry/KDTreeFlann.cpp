@@ -37,10 +37,193 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+template <typename Scalar>
+using FlannIndex = flann::Index<flann::L2<Scalar>>;
+
+/// Number of queries handed to a single FLANN multi-query search.
+constexpr int64_t kQueriesPerChunk = 256;
+
+/// Wraps columns [begin, end) of \p queries as FLANN query rows.
+flann::Matrix<double> QueryChunk(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        int64_t begin,
+        int64_t end,
+        std::vector<double> & /*buffer*/) {
+    return flann::Matrix<double>((double *)queries.col(begin).data(),
+                                 end - begin, queries.rows(),
+                                 queries.outerStride() * sizeof(double));
+}
+
+/// Converts columns [begin, end) of \p queries to FLANN query rows stored in
+/// \p buffer.
+flann::Matrix<float> QueryChunk(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        int64_t begin,
+        int64_t end,
+        std::vector<float> &buffer) {
+    buffer.resize((end - begin) * queries.rows());
+    Eigen::Map<Eigen::MatrixXf>(buffer.data(), queries.rows(), end - begin) =
+            queries.middleCols(begin, end - begin).cast<float>();
+    return flann::Matrix<float>(buffer.data(), end - begin, queries.rows());
+}
+
+/// Gives each of \p num_queries queries no neighbors.
+void ClearSearchResult(int64_t num_queries, KDTreeSearchResult &result) {
+    result.offsets_.assign(num_queries + 1, 0);
+    result.indices_.clear();
+    result.distance2_.clear();
+}
+
+/// Packs the first counts[i] entries of row i of the dense \p width wide
+/// neighbor rows into \p result. result.offsets_[i + 1] holds counts[i].
+template <typename Scalar>
+void PackSearchRows(const std::vector<int> &indices,
+                    const std::vector<Scalar> &distance2,
+                    int64_t width,
+                    KDTreeSearchResult &result) {
+    const int64_t num_queries = result.NumQueries();
+    result.offsets_[0] = 0;
+    for (int64_t i = 0; i < num_queries; i++) {
+        result.offsets_[i + 1] += result.offsets_[i];
+    }
+    result.indices_.resize(result.offsets_[num_queries]);
+    result.distance2_.resize(result.offsets_[num_queries]);
+    utility::ParallelForEach(
+            0, num_queries,
+            [&](int64_t i) {
+                const int64_t n = result.offsets_[i + 1] - result.offsets_[i];
+                std::copy_n(indices.begin() + i * width, n,
+                            result.indices_.begin() + result.offsets_[i]);
+                std::copy_n(distance2.begin() + i * width, n,
+                            result.distance2_.begin() + result.offsets_[i]);
+            },
+            1024);
+}
+
+template <typename Scalar>
+void SearchKNNBatchImpl(FlannIndex<Scalar> &index,
+                        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                        int64_t k,
+                        KDTreeSearchResult &result) {
+    // An exact search always finds min(knn, dataset size) neighbors, so every
+    // query owns a fixed-size slot and FLANN writes the indices in place.
+    const int64_t num_queries = queries.cols();
+    result.offsets_.resize(num_queries + 1);
+    for (int64_t i = 0; i <= num_queries; i++) {
+        result.offsets_[i] = i * k;
+    }
+    result.indices_.resize(num_queries * k);
+    result.distance2_.resize(num_queries * k);
+    if (k == 0) {
+        return;
+    }
+    utility::ParallelFor(
+            0, num_queries, kQueriesPerChunk,
+            [&](int64_t begin, int64_t end) {
+                std::vector<Scalar> query_buffer;
+                std::vector<Scalar> dists((end - begin) * k);
+                flann::Matrix<int> indices_flann(
+                        result.indices_.data() + begin * k, end - begin, k);
+                flann::Matrix<Scalar> dists_flann(dists.data(), end - begin,
+                                                  k);
+                index.knnSearch(QueryChunk(queries, begin, end, query_buffer),
+                                indices_flann, dists_flann, k,
+                                flann::SearchParams(-1, 0.0));
+                std::copy(dists.begin(), dists.end(),
+                          result.distance2_.begin() + begin * k);
+            });
+}
+
+template <typename Scalar>
+void SearchRadiusBatchImpl(FlannIndex<Scalar> &index,
+                           const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           KDTreeSearchResult &result) {
+    // The neighbor count is unbounded, so FLANN collects each query into its
+    // own vector and the vectors are packed once all counts are known.
+    const int64_t num_queries = queries.cols();
+    std::vector<std::vector<int>> indices(num_queries);
+    std::vector<std::vector<Scalar>> distance2(num_queries);
+    utility::ParallelFor(
+            0, num_queries, kQueriesPerChunk,
+            [&](int64_t begin, int64_t end) {
+                flann::SearchParams param(-1, 0.0);
+                param.max_neighbors = -1;
+                std::vector<Scalar> query_buffer;
+                std::vector<std::vector<int>> indices_chunk;
+                std::vector<std::vector<Scalar>> dists_chunk;
+                index.radiusSearch(
+                        QueryChunk(queries, begin, end, query_buffer),
+                        indices_chunk, dists_chunk, float(radius * radius),
+                        param);
+                for (int64_t i = begin; i < end; i++) {
+                    indices[i] = std::move(indices_chunk[i - begin]);
+                    distance2[i] = std::move(dists_chunk[i - begin]);
+                }
+            });
+    result.offsets_.resize(num_queries + 1);
+    result.offsets_[0] = 0;
+    for (int64_t i = 0; i < num_queries; i++) {
+        result.offsets_[i + 1] = result.offsets_[i] + indices[i].size();
+    }
+    result.indices_.resize(result.offsets_[num_queries]);
+    result.distance2_.resize(result.offsets_[num_queries]);
+    utility::ParallelForEach(
+            0, num_queries,
+            [&](int64_t i) {
+                std::copy(indices[i].begin(), indices[i].end(),
+                          result.indices_.begin() + result.offsets_[i]);
+                std::copy(distance2[i].begin(), distance2[i].end(),
+                          result.distance2_.begin() + result.offsets_[i]);
+            },
+            1024);
+}
+
+template <typename Scalar>
+void SearchHybridBatchImpl(FlannIndex<Scalar> &index,
+                           const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           int max_nn,
+                           KDTreeSearchResult &result) {
+    // FLANN fills a dense max_nn wide row per query and marks the end of a
+    // short row with index -1. The rows are then packed without the padding.
+    const int64_t num_queries = queries.cols();
+    std::vector<int> indices(num_queries * max_nn);
+    std::vector<Scalar> distance2(num_queries * max_nn);
+    result.offsets_.resize(num_queries + 1);
+    utility::ParallelFor(
+            0, num_queries, kQueriesPerChunk,
+            [&](int64_t begin, int64_t end) {
+                flann::SearchParams param(-1, 0.0);
+                param.max_neighbors = max_nn;
+                std::vector<Scalar> query_buffer;
+                flann::Matrix<int> indices_flann(
+                        indices.data() + begin * max_nn, end - begin, max_nn);
+                flann::Matrix<Scalar> dists_flann(
+                        distance2.data() + begin * max_nn, end - begin,
+                        max_nn);
+                index.radiusSearch(
+                        QueryChunk(queries, begin, end, query_buffer),
+                        indices_flann, dists_flann, float(radius * radius),
+                        param);
+                for (int64_t i = begin; i < end; i++) {
+                    const int *row = indices.data() + i * max_nn;
+                    result.offsets_[i + 1] =
+                            std::find(row, row + max_nn, -1) - row;
+                }
+            });
+    PackSearchRows(indices, distance2, max_nn, result);
+}
+
+}  // unnamed namespace
+
 KDTreeFlann::KDTreeFlann() {}
 
 KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
@@ -186,6 +369,73 @@ int KDTreeFlann::SearchHybrid(const T &query,
     return k;
 }
 
+bool KDTreeFlann::SearchBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                              const KDTreeSearchParam &param,
+                              KDTreeSearchResult &result) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNNBatch(
+                    queries, ((const KDTreeSearchParamKNN &)param).knn_,
+                    result);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadiusBatch(
+                    queries, ((const KDTreeSearchParamRadius &)param).radius_,
+                    result);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybridBatch(
+                    queries, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, result);
+        default:
+            ClearSearchResult(queries.cols(), result);
+            return false;
+    }
+}
+
+bool KDTreeFlann::SearchKNNBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        int knn,
+        KDTreeSearchResult &result) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || knn < 0) {
+        ClearSearchResult(queries.cols(), result);
+        return false;
+    }
+    SearchKNNBatchImpl(*flann_index_, queries,
+                       std::min(int64_t(knn), int64_t(dataset_size_)), result);
+    return true;
+}
+
+bool KDTreeFlann::SearchRadiusBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        KDTreeSearchResult &result) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_) {
+        ClearSearchResult(queries.cols(), result);
+        return false;
+    }
+    SearchRadiusBatchImpl(*flann_index_, queries, radius, result);
+    return true;
+}
+
+bool KDTreeFlann::SearchHybridBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        KDTreeSearchResult &result) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || max_nn < 0) {
+        ClearSearchResult(queries.cols(), result);
+        return false;
+    }
+    if (max_nn == 0) {
+        ClearSearchResult(queries.cols(), result);
+        return true;
+    }
+    SearchHybridBatchImpl(*flann_index_, queries, radius, max_nn, result);
+    return true;
+}
+
 bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     dimension_ = data.rows();
     dataset_size_ = data.cols();
@@ -204,6 +454,253 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     return true;
 }
 
+KDTreeFlannFloat::KDTreeFlannFloat() {}
+
+KDTreeFlannFloat::KDTreeFlannFloat(const Eigen::MatrixXd &data) {
+    SetMatrixData(data);
+}
+
+KDTreeFlannFloat::KDTreeFlannFloat(const Geometry &geometry) {
+    SetGeometry(geometry);
+}
+
+KDTreeFlannFloat::KDTreeFlannFloat(
+        const Eigen::Map<const Eigen::MatrixXf> &data) {
+    SetExternalData(data);
+}
+
+KDTreeFlannFloat::~KDTreeFlannFloat() {}
+
+bool KDTreeFlannFloat::SetMatrixData(const Eigen::MatrixXd &data) {
+    dimension_ = data.rows();
+    dataset_size_ = data.cols();
+    data_.resize(dataset_size_ * dimension_);
+    Eigen::Map<Eigen::MatrixXf>(data_.data(), dimension_, dataset_size_) =
+            data.cast<float>();
+    return BuildIndex(data_.data(), true);
+}
+
+bool KDTreeFlannFloat::SetGeometry(const Geometry &geometry) {
+    const std::vector<Eigen::Vector3d> *points = nullptr;
+    switch (geometry.GetGeometryType()) {
+        case Geometry::GeometryType::PointCloud:
+            points = &((const PointCloud &)geometry).points_;
+            break;
+        case Geometry::GeometryType::TriangleMesh:
+        case Geometry::GeometryType::HalfEdgeTriangleMesh:
+            points = &((const TriangleMesh &)geometry).vertices_;
+            break;
+        case Geometry::GeometryType::Image:
+        case Geometry::GeometryType::Unspecified:
+        default:
+            utility::LogWarning(
+                    "[KDTreeFlannFloat::SetGeometry] Unsupported Geometry "
+                    "type.");
+            return false;
+    }
+    dimension_ = 3;
+    dataset_size_ = points->size();
+    data_.resize(dataset_size_ * dimension_);
+    utility::ParallelForEach(
+            0, int64_t(dataset_size_),
+            [&](int64_t i) {
+                for (int j = 0; j < 3; j++) {
+                    data_[i * 3 + j] = float((*points)[i](j));
+                }
+            },
+            4096);
+    return BuildIndex(data_.data(), true);
+}
+
+bool KDTreeFlannFloat::SetExternalData(
+        const Eigen::Map<const Eigen::MatrixXf> &data) {
+    dimension_ = data.rows();
+    dataset_size_ = data.cols();
+    bool success = BuildIndex(data.data(), false);
+    data_.clear();
+    data_.shrink_to_fit();
+    return success;
+}
+
+template <typename T>
+int KDTreeFlannFloat::Search(const T &query,
+                             const KDTreeSearchParam &param,
+                             std::vector<int> &indices,
+                             std::vector<double> &distance2) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNN(query, ((const KDTreeSearchParamKNN &)param).knn_,
+                             indices, distance2);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadius(
+                    query, ((const KDTreeSearchParamRadius &)param).radius_,
+                    indices, distance2);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybrid(
+                    query, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
+                    distance2);
+        default:
+            return -1;
+    }
+    return -1;
+}
+
+template <typename T>
+int KDTreeFlannFloat::SearchKNN(const T &query,
+                                int knn,
+                                std::vector<int> &indices,
+                                std::vector<double> &distance2) const {
+    if (!IsValidQuery(query.rows()) || knn < 0) {
+        return -1;
+    }
+    Eigen::Matrix<float, T::RowsAtCompileTime, 1> query_float =
+            query.template cast<float>();
+    flann::Matrix<float> query_flann(query_float.data(), 1, dimension_);
+    std::vector<float> dists(knn);
+    indices.resize(knn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
+    flann::Matrix<float> dists_flann(dists.data(), query_flann.rows, knn);
+    int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
+                                    knn, flann::SearchParams(-1, 0.0));
+    indices.resize(k);
+    distance2.assign(dists.begin(), dists.begin() + k);
+    return k;
+}
+
+template <typename T>
+int KDTreeFlannFloat::SearchRadius(const T &query,
+                                   double radius,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2) const {
+    if (!IsValidQuery(query.rows())) {
+        return -1;
+    }
+    Eigen::Matrix<float, T::RowsAtCompileTime, 1> query_float =
+            query.template cast<float>();
+    flann::Matrix<float> query_flann(query_float.data(), 1, dimension_);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = -1;
+    std::vector<std::vector<int>> indices_vec(1);
+    std::vector<std::vector<float>> dists_vec(1);
+    int k = flann_index_->radiusSearch(query_flann, indices_vec, dists_vec,
+                                       float(radius * radius), param);
+    indices = indices_vec[0];
+    distance2.assign(dists_vec[0].begin(), dists_vec[0].end());
+    return k;
+}
+
+template <typename T>
+int KDTreeFlannFloat::SearchHybrid(const T &query,
+                                   double radius,
+                                   int max_nn,
+                                   std::vector<int> &indices,
+                                   std::vector<double> &distance2) const {
+    if (!IsValidQuery(query.rows()) || max_nn < 0) {
+        return -1;
+    }
+    Eigen::Matrix<float, T::RowsAtCompileTime, 1> query_float =
+            query.template cast<float>();
+    flann::Matrix<float> query_flann(query_float.data(), 1, dimension_);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = max_nn;
+    std::vector<float> dists(max_nn);
+    indices.resize(max_nn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
+    flann::Matrix<float> dists_flann(dists.data(), query_flann.rows, max_nn);
+    int k = flann_index_->radiusSearch(query_flann, indices_flann, dists_flann,
+                                       float(radius * radius), param);
+    indices.resize(k);
+    distance2.assign(dists.begin(), dists.begin() + k);
+    return k;
+}
+
+bool KDTreeFlannFloat::SearchBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        const KDTreeSearchParam &param,
+        KDTreeSearchResult &result) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNNBatch(
+                    queries, ((const KDTreeSearchParamKNN &)param).knn_,
+                    result);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadiusBatch(
+                    queries, ((const KDTreeSearchParamRadius &)param).radius_,
+                    result);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybridBatch(
+                    queries, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, result);
+        default:
+            ClearSearchResult(queries.cols(), result);
+            return false;
+    }
+}
+
+bool KDTreeFlannFloat::SearchKNNBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        int knn,
+        KDTreeSearchResult &result) const {
+    if (!IsValidQuery(queries.rows()) || knn < 0) {
+        ClearSearchResult(queries.cols(), result);
+        return false;
+    }
+    SearchKNNBatchImpl(*flann_index_, queries,
+                       std::min(int64_t(knn), int64_t(dataset_size_)), result);
+    return true;
+}
+
+bool KDTreeFlannFloat::SearchRadiusBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        KDTreeSearchResult &result) const {
+    if (!IsValidQuery(queries.rows())) {
+        ClearSearchResult(queries.cols(), result);
+        return false;
+    }
+    SearchRadiusBatchImpl(*flann_index_, queries, radius, result);
+    return true;
+}
+
+bool KDTreeFlannFloat::SearchHybridBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        KDTreeSearchResult &result) const {
+    if (!IsValidQuery(queries.rows()) || max_nn < 0) {
+        ClearSearchResult(queries.cols(), result);
+        return false;
+    }
+    if (max_nn == 0) {
+        ClearSearchResult(queries.cols(), result);
+        return true;
+    }
+    SearchHybridBatchImpl(*flann_index_, queries, radius, max_nn, result);
+    return true;
+}
+
+bool KDTreeFlannFloat::BuildIndex(const float *data, bool reorder) {
+    if (dimension_ == 0 || dataset_size_ == 0) {
+        utility::LogWarning(
+                "[KDTreeFlannFloat::BuildIndex] Failed due to no data.");
+        flann_index_.reset();
+        flann_dataset_.reset();
+        return false;
+    }
+    flann_dataset_.reset(new flann::Matrix<float>((float *)data, dataset_size_,
+                                                  dimension_));
+    flann_index_.reset(new flann::Index<flann::L2<float>>(
+            *flann_dataset_, flann::KDTreeSingleIndexParams(15, reorder)));
+    flann_index_->buildIndex();
+    return true;
+}
+
+bool KDTreeFlannFloat::IsValidQuery(int64_t query_dimension) const {
+    return flann_index_ && dataset_size_ > 0 &&
+           size_t(query_dimension) == dimension_;
+}
+
 template int KDTreeFlann::Search<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         const KDTreeSearchParam &param,
@@ -248,6 +745,50 @@ template int KDTreeFlann::SearchHybrid<Eigen::VectorXd>(
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
 
+template int KDTreeFlannFloat::Search<Eigen::Vector3d>(
+        const Eigen::Vector3d &query,
+        const KDTreeSearchParam &param,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlannFloat::SearchKNN<Eigen::Vector3d>(
+        const Eigen::Vector3d &query,
+        int knn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlannFloat::SearchRadius<Eigen::Vector3d>(
+        const Eigen::Vector3d &query,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlannFloat::SearchHybrid<Eigen::Vector3d>(
+        const Eigen::Vector3d &query,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+
+template int KDTreeFlannFloat::Search<Eigen::VectorXd>(
+        const Eigen::VectorXd &query,
+        const KDTreeSearchParam &param,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlannFloat::SearchKNN<Eigen::VectorXd>(
+        const Eigen::VectorXd &query,
+        int knn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlannFloat::SearchRadius<Eigen::VectorXd>(
+        const Eigen::VectorXd &query,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlannFloat::SearchHybrid<Eigen::VectorXd>(
+        const Eigen::VectorXd &query,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+
 }  // namespace geometry
 }  // namespace open3d
 
@@ -27,6 +27,8 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -46,6 +48,42 @@ class Index;
 namespace open3d {
 namespace geometry {
 
+/// \class KDTreeSearchResult
+///
+/// \brief Neighbors of a batch of queries in compressed sparse row layout.
+///
+/// The neighbors of query i are indices_[offsets_[i]] to
+/// indices_[offsets_[i + 1] - 1], with the matching squared distances in
+/// distance2_. Neighbors of a query are sorted by increasing distance.
+class KDTreeSearchResult {
+public:
+    /// Number of queries in the batch.
+    int64_t NumQueries() const {
+        return offsets_.empty() ? 0 : int64_t(offsets_.size()) - 1;
+    }
+    /// Number of neighbors found for query \p i.
+    int NumNeighbors(int64_t i) const {
+        return int(offsets_[i + 1] - offsets_[i]);
+    }
+    /// Pointer to the first neighbor index of query \p i.
+    const int *Indices(int64_t i) const {
+        return indices_.data() + offsets_[i];
+    }
+    /// Pointer to the first squared distance of query \p i.
+    const double *Distance2(int64_t i) const {
+        return distance2_.data() + offsets_[i];
+    }
+
+public:
+    /// Start of the neighbors of each query, with one trailing entry holding
+    /// the total number of neighbors.
+    std::vector<int64_t> offsets_;
+    /// Neighbor indices of all queries, concatenated.
+    std::vector<int> indices_;
+    /// Squared distances of all queries, concatenated.
+    std::vector<double> distance2_;
+};
+
 /// \class KDTreeFlann
 ///
 /// \brief KDTree with FLANN for nearest neighbor search.
@@ -109,6 +147,47 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Searches the neighbors of every column of \p queries.
+    ///
+    /// Queries are split into chunks that are searched in parallel, and the
+    /// neighbors are returned in \p result. Returns false, with no neighbors
+    /// for any query, if the tree is empty or the parameters are invalid.
+    bool SearchBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                     const KDTreeSearchParam &param,
+                     KDTreeSearchResult &result) const;
+
+    bool SearchKNNBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                        int knn,
+                        KDTreeSearchResult &result) const;
+
+    bool SearchRadiusBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           KDTreeSearchResult &result) const;
+
+    bool SearchHybridBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           int max_nn,
+                           KDTreeSearchResult &result) const;
+
+    /// \brief Runs SearchBatch() on consecutive blocks of \p queries.
+    ///
+    /// Calls \p func(begin, end, result) for each block of columns [begin,
+    /// end), where query i of \p result is column begin + i of \p queries.
+    /// This bounds the size of the result buffers for large query sets.
+    template <typename func_t>
+    void SearchBatchInBlocks(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                             const KDTreeSearchParam &param,
+                             func_t func,
+                             int64_t block_size = 65536) const {
+        KDTreeSearchResult result;
+        const int64_t num_queries = queries.cols();
+        for (int64_t begin = 0; begin < num_queries; begin += block_size) {
+            int64_t end = std::min(begin + block_size, num_queries);
+            SearchBatch(queries.middleCols(begin, end - begin), param, result);
+            func(begin, end, result);
+        }
+    }
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
@@ -124,5 +203,134 @@ protected:
     size_t dataset_size_ = 0;
 };
 
+/// \class KDTreeFlannFloat
+///
+/// \brief Single precision KDTree with FLANN for nearest neighbor search.
+///
+/// Points are stored as floats, which halves the memory and the bandwidth of
+/// the search compared to KDTreeFlann. A float point buffer can also be
+/// indexed in place with SetExternalData(), without any copy. Queries and squared
+/// distances stay in double precision, so the search methods are drop-in
+/// replacements for those of KDTreeFlann.
+class KDTreeFlannFloat {
+public:
+    /// \brief Default Constructor.
+    KDTreeFlannFloat();
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param data Provides set of data points for KDTree construction.
+    KDTreeFlannFloat(const Eigen::MatrixXd &data);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param geometry Provides geometry from which KDTree is constructed.
+    KDTreeFlannFloat(const Geometry &geometry);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param data Points to index in place, see SetExternalData().
+    KDTreeFlannFloat(const Eigen::Map<const Eigen::MatrixXf> &data);
+    ~KDTreeFlannFloat();
+    KDTreeFlannFloat(const KDTreeFlannFloat &) = delete;
+    KDTreeFlannFloat &operator=(const KDTreeFlannFloat &) = delete;
+
+public:
+    /// Sets the data for the KDTree from a matrix, converted to float.
+    ///
+    /// \param data Data points for KDTree Construction.
+    bool SetMatrixData(const Eigen::MatrixXd &data);
+    /// Sets the data for the KDTree from geometry, converted to float.
+    ///
+    /// \param geometry Geometry for KDTree Construction.
+    bool SetGeometry(const Geometry &geometry);
+    /// \brief Indexes the columns of \p data in place.
+    ///
+    /// The buffer is not copied, so it must stay alive and unchanged until
+    /// the tree is destroyed or its data is set again. Leaves read the points
+    /// in buffer order, so queries are fastest when nearby points are stored
+    /// close together, as in scan order; for randomly ordered points, the
+    /// copying setters give faster queries.
+    ///
+    /// \param data Data points for KDTree Construction.
+    bool SetExternalData(const Eigen::Map<const Eigen::MatrixXf> &data);
+
+    template <typename T>
+    int Search(const T &query,
+               const KDTreeSearchParam &param,
+               std::vector<int> &indices,
+               std::vector<double> &distance2) const;
+
+    template <typename T>
+    int SearchKNN(const T &query,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) const;
+
+    template <typename T>
+    int SearchRadius(const T &query,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    template <typename T>
+    int SearchHybrid(const T &query,
+                     double radius,
+                     int max_nn,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    /// See KDTreeFlann::SearchBatch().
+    bool SearchBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                     const KDTreeSearchParam &param,
+                     KDTreeSearchResult &result) const;
+
+    bool SearchKNNBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                        int knn,
+                        KDTreeSearchResult &result) const;
+
+    bool SearchRadiusBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           KDTreeSearchResult &result) const;
+
+    bool SearchHybridBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           double radius,
+                           int max_nn,
+                           KDTreeSearchResult &result) const;
+
+    /// See KDTreeFlann::SearchBatchInBlocks().
+    template <typename func_t>
+    void SearchBatchInBlocks(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                             const KDTreeSearchParam &param,
+                             func_t func,
+                             int64_t block_size = 65536) const {
+        KDTreeSearchResult result;
+        const int64_t num_queries = queries.cols();
+        for (int64_t begin = 0; begin < num_queries; begin += block_size) {
+            int64_t end = std::min(begin + block_size, num_queries);
+            SearchBatch(queries.middleCols(begin, end - begin), param, result);
+            func(begin, end, result);
+        }
+    }
+
+private:
+    /// \brief Builds the index over the \p dimension_ x \p dataset_size_
+    /// floats at \p data, which must outlive the index.
+    ///
+    /// With \p reorder, FLANN keeps a second copy of the points in leaf
+    /// order, which makes queries several times faster on unordered data.
+    /// Without it, FLANN reads the points in place.
+    bool BuildIndex(const float *data, bool reorder);
+
+    /// Returns false if the tree is empty or \p query_dimension does not
+    /// match the dimension of the data.
+    bool IsValidQuery(int64_t query_dimension) const;
+
+protected:
+    /// Float copy of the data, empty when the data is external.
+    std::vector<float> data_;
+    std::unique_ptr<flann::Matrix<float>> flann_dataset_;
+    std::unique_ptr<flann::Index<flann::L2<float>>> flann_index_;
+    size_t dimension_ = 0;
+    size_t dataset_size_ = 0;
+};
+
 }  // namespace geometry
 }  // namespace open3d
@@ -0,0 +1,401 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#endif
+
+#include "Open3D/Geometry/KDTreeFlannDynamic.h"
+
+#include <flann/flann.hpp>
+#include <utility>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Number of added points that are searched exhaustively before they are put
+/// into a tree. The smallest tree holds up to this many points.
+constexpr size_t kBufferSize = 256;
+
+}  // unnamed namespace
+
+struct KDTreeFlannDynamic::Tree {
+    /// Ids of the points, by index in the tree.
+    std::vector<int> ids_;
+    std::vector<double> data_;
+    std::unique_ptr<flann::Matrix<double>> flann_dataset_;
+    std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
+    /// Number of points masked out of the index.
+    size_t num_removed_ = 0;
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+};
+
+KDTreeFlannDynamic::KDTreeFlannDynamic() {}
+
+KDTreeFlannDynamic::KDTreeFlannDynamic(
+        const std::vector<Eigen::Vector3d> &points) {
+    AddPoints(points);
+}
+
+KDTreeFlannDynamic::~KDTreeFlannDynamic() {}
+
+int KDTreeFlannDynamic::AddPoints(const std::vector<Eigen::Vector3d> &points) {
+    const int first_id = int(points_.size());
+    points_.insert(points_.end(), points.begin(), points.end());
+    removed_.resize(points_.size(), 0);
+    level_.resize(points_.size(), -1);
+    local_index_.resize(points_.size(), 0);
+    for (int id = first_id; id < int(points_.size()); id++) {
+        buffer_.push_back(id);
+    }
+    num_points_ += points.size();
+    if (buffer_.size() >= kBufferSize) {
+        std::vector<int> ids;
+        ids.swap(buffer_);
+        InsertIntoTrees(std::move(ids));
+    }
+    return first_id;
+}
+
+void KDTreeFlannDynamic::RemovePoints(const std::vector<int> &ids) {
+    for (int id : ids) {
+        RemovePoint(id);
+    }
+    for (size_t level = 0; level < trees_.size(); level++) {
+        if (trees_[level] &&
+            trees_[level]->num_removed_ * 2 > trees_[level]->ids_.size()) {
+            CompactTree(level);
+        }
+    }
+}
+
+size_t KDTreeFlannDynamic::RemoveBox(const AxisAlignedBoundingBox &box) {
+    const Eigen::Vector3d &min_bound = box.min_bound_;
+    const Eigen::Vector3d &max_bound = box.max_bound_;
+    auto is_inside = [&](int id) {
+        return !removed_[id] &&
+               (points_[id].array() >= min_bound.array()).all() &&
+               (points_[id].array() <= max_bound.array()).all();
+    };
+    std::vector<int> ids;
+    for (int id : buffer_) {
+        if (is_inside(id)) {
+            ids.push_back(id);
+        }
+    }
+    for (const auto &tree : trees_) {
+        if (!tree || (tree->min_bound_.array() > max_bound.array()).any() ||
+            (tree->max_bound_.array() < min_bound.array()).any()) {
+            continue;
+        }
+        std::vector<char> inside(tree->ids_.size());
+        utility::ParallelForEach(
+                0, int64_t(tree->ids_.size()),
+                [&](int64_t i) { inside[i] = is_inside(tree->ids_[i]); },
+                4096);
+        for (size_t i = 0; i < inside.size(); i++) {
+            if (inside[i]) {
+                ids.push_back(tree->ids_[i]);
+            }
+        }
+    }
+    RemovePoints(ids);
+    return ids.size();
+}
+
+void KDTreeFlannDynamic::Clear() {
+    points_.clear();
+    removed_.clear();
+    level_.clear();
+    local_index_.clear();
+    buffer_.clear();
+    trees_.clear();
+    num_points_ = 0;
+}
+
+int KDTreeFlannDynamic::Search(const Eigen::Vector3d &query,
+                               const KDTreeSearchParam &param,
+                               std::vector<int> &indices,
+                               std::vector<double> &distance2) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNN(query, ((const KDTreeSearchParamKNN &)param).knn_,
+                             indices, distance2);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadius(
+                    query, ((const KDTreeSearchParamRadius &)param).radius_,
+                    indices, distance2);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybrid(
+                    query, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
+                    distance2);
+        default:
+            return -1;
+    }
+    return -1;
+}
+
+int KDTreeFlannDynamic::SearchKNN(const Eigen::Vector3d &query,
+                                  int knn,
+                                  std::vector<int> &indices,
+                                  std::vector<double> &distance2) const {
+    if (num_points_ == 0 || knn < 0) {
+        return -1;
+    }
+    return SearchNeighbors(query, -1.0, knn, indices, distance2);
+}
+
+int KDTreeFlannDynamic::SearchRadius(const Eigen::Vector3d &query,
+                                     double radius,
+                                     std::vector<int> &indices,
+                                     std::vector<double> &distance2) const {
+    if (num_points_ == 0 || radius < 0.0) {
+        return -1;
+    }
+    return SearchNeighbors(query, radius, -1, indices, distance2);
+}
+
+int KDTreeFlannDynamic::SearchHybrid(const Eigen::Vector3d &query,
+                                     double radius,
+                                     int max_nn,
+                                     std::vector<int> &indices,
+                                     std::vector<double> &distance2) const {
+    if (num_points_ == 0 || radius < 0.0 || max_nn < 0) {
+        return -1;
+    }
+    return SearchNeighbors(query, radius, max_nn, indices, distance2);
+}
+
+bool KDTreeFlannDynamic::SearchBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        const KDTreeSearchParam &param,
+        KDTreeSearchResult &result) const {
+    const int64_t num_queries = queries.cols();
+    std::vector<std::vector<int>> indices(num_queries);
+    std::vector<std::vector<double>> distance2(num_queries);
+    bool valid = queries.rows() == 3;
+    if (valid) {
+        std::vector<char> failed(num_queries, 0);
+        utility::ParallelForEach(
+                0, num_queries,
+                [&](int64_t i) {
+                    Eigen::Vector3d query = queries.col(i);
+                    failed[i] = Search(query, param, indices[i],
+                                       distance2[i]) < 0;
+                },
+                64);
+        valid = std::find(failed.begin(), failed.end(), 1) == failed.end();
+    }
+    if (!valid) {
+        result.offsets_.assign(num_queries + 1, 0);
+        result.indices_.clear();
+        result.distance2_.clear();
+        return false;
+    }
+    result.offsets_.resize(num_queries + 1);
+    result.offsets_[0] = 0;
+    for (int64_t i = 0; i < num_queries; i++) {
+        result.offsets_[i + 1] = result.offsets_[i] + indices[i].size();
+    }
+    result.indices_.resize(result.offsets_[num_queries]);
+    result.distance2_.resize(result.offsets_[num_queries]);
+    utility::ParallelForEach(
+            0, num_queries,
+            [&](int64_t i) {
+                std::copy(indices[i].begin(), indices[i].end(),
+                          result.indices_.begin() + result.offsets_[i]);
+                std::copy(distance2[i].begin(), distance2[i].end(),
+                          result.distance2_.begin() + result.offsets_[i]);
+            },
+            1024);
+    return true;
+}
+
+int KDTreeFlannDynamic::SearchNeighbors(const Eigen::Vector3d &query,
+                                        double radius,
+                                        int max_nn,
+                                        std::vector<int> &indices,
+                                        std::vector<double> &distance2) const {
+    // Each tree returns its own best candidates, which are then merged. The
+    // squared radius is rounded to float and compared strictly, as FLANN
+    // does, so that buffered and indexed points are treated alike.
+    const double radius2 = float(radius * radius);
+    std::vector<std::pair<double, int>> neighbors;
+    flann::Matrix<double> query_flann((double *)query.data(), 1, 3);
+    flann::SearchParams param(-1, 0.0);
+    std::vector<int> tree_indices;
+    std::vector<double> tree_dists;
+    for (const auto &tree : trees_) {
+        if (!tree) {
+            continue;
+        }
+        const int num_live = int(tree->ids_.size() - tree->num_removed_);
+        int k = 0;
+        if (radius >= 0.0 && max_nn < 0) {
+            std::vector<std::vector<int>> indices_vec(1);
+            std::vector<std::vector<double>> dists_vec(1);
+            param.max_neighbors = -1;
+            k = tree->flann_index_->radiusSearch(
+                    query_flann, indices_vec, dists_vec, float(radius2),
+                    param);
+            tree_indices.swap(indices_vec[0]);
+            tree_dists.swap(dists_vec[0]);
+        } else {
+            const int width = std::min(max_nn, num_live);
+            if (width == 0) {
+                continue;
+            }
+            tree_indices.resize(width);
+            tree_dists.resize(width);
+            flann::Matrix<int> indices_flann(tree_indices.data(), 1, width);
+            flann::Matrix<double> dists_flann(tree_dists.data(), 1, width);
+            if (radius >= 0.0) {
+                param.max_neighbors = width;
+                k = tree->flann_index_->radiusSearch(query_flann,
+                                                     indices_flann,
+                                                     dists_flann,
+                                                     float(radius2), param);
+            } else {
+                k = tree->flann_index_->knnSearch(query_flann, indices_flann,
+                                                  dists_flann, width, param);
+            }
+            k = std::min(k, width);
+        }
+        for (int i = 0; i < k; i++) {
+            neighbors.emplace_back(tree_dists[i], tree->ids_[tree_indices[i]]);
+        }
+    }
+    for (int id : buffer_) {
+        if (removed_[id]) {
+            continue;
+        }
+        double d2 = (points_[id] - query).squaredNorm();
+        if (radius < 0.0 || d2 < radius2) {
+            neighbors.emplace_back(d2, id);
+        }
+    }
+    if (max_nn >= 0 && neighbors.size() > size_t(max_nn)) {
+        std::partial_sort(neighbors.begin(), neighbors.begin() + max_nn,
+                          neighbors.end());
+        neighbors.resize(max_nn);
+    } else {
+        std::sort(neighbors.begin(), neighbors.end());
+    }
+    indices.resize(neighbors.size());
+    distance2.resize(neighbors.size());
+    for (size_t i = 0; i < neighbors.size(); i++) {
+        distance2[i] = neighbors[i].first;
+        indices[i] = neighbors[i].second;
+    }
+    return int(neighbors.size());
+}
+
+void KDTreeFlannDynamic::InsertIntoTrees(std::vector<int> ids) {
+    ids.erase(std::remove_if(ids.begin(), ids.end(),
+                             [this](int id) { return removed_[id] != 0; }),
+              ids.end());
+    // Like a binary counter: the points go to the first level that can hold
+    // them, absorbing the tree already there until a free level is found.
+    size_t level = 0;
+    while (true) {
+        while ((kBufferSize << level) < ids.size()) {
+            level++;
+        }
+        if (level >= trees_.size() || !trees_[level]) {
+            break;
+        }
+        for (int id : trees_[level]->ids_) {
+            if (!removed_[id]) {
+                ids.push_back(id);
+            }
+        }
+        trees_[level].reset();
+    }
+    if (ids.empty()) {
+        return;
+    }
+    if (level >= trees_.size()) {
+        trees_.resize(level + 1);
+    }
+
+    std::unique_ptr<Tree> tree(new Tree);
+    const size_t num_ids = ids.size();
+    tree->data_.resize(3 * num_ids);
+    tree->min_bound_ = points_[ids[0]];
+    tree->max_bound_ = points_[ids[0]];
+    for (size_t i = 0; i < num_ids; i++) {
+        const Eigen::Vector3d &point = points_[ids[i]];
+        Eigen::Map<Eigen::Vector3d>(tree->data_.data() + 3 * i) = point;
+        tree->min_bound_ = tree->min_bound_.cwiseMin(point);
+        tree->max_bound_ = tree->max_bound_.cwiseMax(point);
+        level_[ids[i]] = int(level);
+        local_index_[ids[i]] = int(i);
+    }
+    tree->ids_ = std::move(ids);
+    tree->flann_dataset_.reset(
+            new flann::Matrix<double>(tree->data_.data(), num_ids, 3));
+    tree->flann_index_.reset(new flann::Index<flann::L2<double>>(
+            *tree->flann_dataset_, flann::KDTreeSingleIndexParams(15)));
+    tree->flann_index_->buildIndex();
+    trees_[level] = std::move(tree);
+}
+
+void KDTreeFlannDynamic::CompactTree(size_t level) {
+    std::vector<int> ids = std::move(trees_[level]->ids_);
+    trees_[level].reset();
+    InsertIntoTrees(std::move(ids));
+}
+
+void KDTreeFlannDynamic::RemovePoint(int id) {
+    if (!HasPoint(id)) {
+        return;
+    }
+    removed_[id] = 1;
+    num_points_--;
+    // Buffered points are skipped by the searches and dropped when the buffer
+    // is put into a tree.
+    if (level_[id] < 0) {
+        return;
+    }
+    Tree &tree = *trees_[level_[id]];
+    tree.flann_index_->removePoint(local_index_[id]);
+    tree.num_removed_++;
+}
+
+}  // namespace geometry
+}  // namespace open3d
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
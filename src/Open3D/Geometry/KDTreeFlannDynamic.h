@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class AxisAlignedBoundingBox;
+
+/// \class KDTreeFlannDynamic
+///
+/// \brief KDTree for nearest neighbor search over a point set that changes
+/// over time.
+///
+/// Points are kept in a forest of static FLANN trees whose sizes grow
+/// geometrically, plus a small buffer of recently added points that is
+/// searched exhaustively. Adding points only rebuilds small trees, so the
+/// amortized cost of an insertion is O(log^2 N) instead of the O(N log N)
+/// rebuild of KDTreeFlann. Removed points are masked in their tree, and a
+/// tree is rebuilt once half of its points are removed.
+///
+/// Every point keeps the id returned by AddPoints() until it is removed, and
+/// the search methods return those ids. The search methods mirror those of
+/// KDTreeFlann. They may run concurrently with each other, but not with
+/// AddPoints() or the removal methods.
+class KDTreeFlannDynamic {
+public:
+    /// \brief Default Constructor.
+    KDTreeFlannDynamic();
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param points Initial points, with ids 0 to points.size() - 1.
+    KDTreeFlannDynamic(const std::vector<Eigen::Vector3d> &points);
+    ~KDTreeFlannDynamic();
+    KDTreeFlannDynamic(const KDTreeFlannDynamic &) = delete;
+    KDTreeFlannDynamic &operator=(const KDTreeFlannDynamic &) = delete;
+
+public:
+    /// \brief Adds \p points and returns the id of the first one.
+    ///
+    /// The points get consecutive ids starting from the returned one.
+    int AddPoints(const std::vector<Eigen::Vector3d> &points);
+    /// Removes the points with the given ids. Ids of removed or unknown
+    /// points are ignored.
+    void RemovePoints(const std::vector<int> &ids);
+    /// Removes all points inside \p box and returns how many were removed.
+    size_t RemoveBox(const AxisAlignedBoundingBox &box);
+    /// Removes all points.
+    void Clear();
+
+    /// Number of points that have not been removed.
+    size_t NumPoints() const { return num_points_; }
+    /// Returns true if \p id is the id of a point that has not been removed.
+    bool HasPoint(int id) const {
+        return id >= 0 && size_t(id) < removed_.size() && !removed_[id];
+    }
+    /// Position of the point with the given id.
+    const Eigen::Vector3d &GetPoint(int id) const { return points_[id]; }
+
+    int Search(const Eigen::Vector3d &query,
+               const KDTreeSearchParam &param,
+               std::vector<int> &indices,
+               std::vector<double> &distance2) const;
+
+    int SearchKNN(const Eigen::Vector3d &query,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) const;
+
+    int SearchRadius(const Eigen::Vector3d &query,
+                     double radius,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    int SearchHybrid(const Eigen::Vector3d &query,
+                     double radius,
+                     int max_nn,
+                     std::vector<int> &indices,
+                     std::vector<double> &distance2) const;
+
+    /// See KDTreeFlann::SearchBatch().
+    bool SearchBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                     const KDTreeSearchParam &param,
+                     KDTreeSearchResult &result) const;
+
+    /// See KDTreeFlann::SearchBatchInBlocks().
+    template <typename func_t>
+    void SearchBatchInBlocks(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                             const KDTreeSearchParam &param,
+                             func_t func,
+                             int64_t block_size = 65536) const {
+        KDTreeSearchResult result;
+        const int64_t num_queries = queries.cols();
+        for (int64_t begin = 0; begin < num_queries; begin += block_size) {
+            int64_t end = std::min(begin + block_size, num_queries);
+            SearchBatch(queries.middleCols(begin, end - begin), param, result);
+            func(begin, end, result);
+        }
+    }
+
+private:
+    struct Tree;
+
+    /// Collects up to \p max_nn neighbors within \p radius, or all of them
+    /// if \p max_nn is negative, sorted by distance and then by id. A
+    /// negative \p radius means no radius limit.
+    int SearchNeighbors(const Eigen::Vector3d &query,
+                        double radius,
+                        int max_nn,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2) const;
+
+    /// Puts the points \p ids into a tree, merging in the existing trees
+    /// that are not larger than the result.
+    void InsertIntoTrees(std::vector<int> ids);
+    /// Rebuilds tree \p level without its removed points.
+    void CompactTree(size_t level);
+    /// Marks the point \p id as removed.
+    void RemovePoint(int id);
+
+protected:
+    /// Positions of all points ever added, indexed by id.
+    std::vector<Eigen::Vector3d> points_;
+    /// Whether each id has been removed.
+    std::vector<char> removed_;
+    /// Tree level holding each id, or -1 while the id is in buffer_.
+    std::vector<int> level_;
+    /// Index of each id inside its tree.
+    std::vector<int> local_index_;
+    /// Ids of recently added points that are not in any tree yet.
+    std::vector<int> buffer_;
+    /// trees_[l] holds at most (kBufferSize << l) points, or is null.
+    std::vector<std::unique_ptr<Tree>> trees_;
+    size_t num_points_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
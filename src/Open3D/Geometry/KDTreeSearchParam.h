@@ -111,5 +111,17 @@ public:
     int max_nn_;
 };
 
+/// \enum NeighborSearchBackend
+///
+/// \brief Spatial index used by point cloud functions with fixed radius
+/// neighborhoods.
+enum class NeighborSearchBackend {
+    /// KDTreeFlann, which suits any point distribution.
+    KDTree = 0,
+    /// HashGridSearch with the search radius as cell size, which is faster
+    /// for clouds of roughly uniform density.
+    HashGrid = 1,
+};
+
 }  // namespace geometry
 }  // namespace open3d
@@ -0,0 +1,377 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/LinearOctree.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+#include <queue>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+
+namespace {
+using namespace geometry;
+
+/// Spreads the lowest 21 bits of \p x to every third bit.
+uint64_t SplitBy3(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+/// Inverse of SplitBy3().
+uint64_t CompactBy3(uint64_t x) {
+    x &= 0x1249249249249249;
+    x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3;
+    x = (x ^ (x >> 4)) & 0x100f00f00f00f00f;
+    x = (x ^ (x >> 8)) & 0x1f0000ff0000ff;
+    x = (x ^ (x >> 16)) & 0x1f00000000ffff;
+    x = (x ^ (x >> 32)) & 0x1fffff;
+    return x;
+}
+
+/// Depth of the first cells containing a but not b, or INT_MAX if a == b.
+int GetSplitDepth(uint64_t a, uint64_t b, int max_depth) {
+    uint64_t diff = a ^ b;
+    if (diff == 0) {
+        return std::numeric_limits<int>::max();
+    }
+    int num_groups = 0;
+    for (; diff != 0; diff >>= 3) {
+        num_groups++;
+    }
+    return max_depth - num_groups + 1;
+}
+
+}  // unnamed namespace
+
+namespace geometry {
+
+std::shared_ptr<LinearOctree> LinearOctree::CreateFromPointCloud(
+        const PointCloud &cloud,
+        int max_depth /* = 12 */,
+        size_t max_leaf_points /* = 256 */,
+        int sample_depth /* = 5 */) {
+    if (max_depth < 0 || max_depth > 21) {
+        utility::LogError(
+                "[LinearOctree] max_depth must be between 0 and 21.");
+    }
+    if (sample_depth < 0) {
+        utility::LogError("[LinearOctree] sample_depth must not be negative.");
+    }
+    auto octree = std::make_shared<LinearOctree>();
+    octree->max_depth_ = max_depth;
+    octree->sample_depth_ = sample_depth;
+    if (!cloud.HasPoints()) {
+        return octree;
+    }
+
+    // Cubic root cell, as in Octree::ConvertFromPointCloud().
+    const double size_expand = 0.01;
+    Eigen::Array3d min_bound = cloud.GetMinBound();
+    Eigen::Array3d max_bound = cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    double max_half_size = (center - min_bound).maxCoeff();
+    octree->origin_ = min_bound.min(center - max_half_size);
+    octree->size_ = max_half_size == 0 ? size_expand
+                                       : max_half_size * 2 * (1 + size_expand);
+
+    const int64_t num_points = int64_t(cloud.points_.size());
+    const int64_t num_cells = int64_t(1) << max_depth;
+    const Eigen::Array3d scale =
+            Eigen::Array3d::Constant(double(num_cells) / octree->size_);
+    std::vector<uint64_t> codes(num_points);
+    std::vector<int64_t> order(num_points);
+    utility::ParallelFor(
+            0, num_points, 4096, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    Eigen::Array3d coord = (cloud.points_[i].array() -
+                                            octree->origin_.array()) *
+                                           scale;
+                    uint64_t cell[3];
+                    for (int k = 0; k < 3; k++) {
+                        cell[k] = uint64_t(std::min(
+                                std::max(int64_t(coord(k)), int64_t(0)),
+                                num_cells - 1));
+                    }
+                    codes[i] = SplitBy3(cell[0]) | SplitBy3(cell[1]) << 1 |
+                               SplitBy3(cell[2]) << 2;
+                    order[i] = i;
+                }
+            });
+    utility::ParallelRadixSort(codes, order, 3 * max_depth);
+
+    // Depth of the node owning each point if that node is not a leaf. A point
+    // is sampled by the nodes sample_depth levels above the first cells in
+    // which it comes first.
+    std::vector<int> owner_depths(num_points);
+    utility::ParallelFor(
+            0, num_points, 4096, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    int split_depth =
+                            i == 0 ? 0
+                                   : GetSplitDepth(codes[i], codes[i - 1],
+                                                   max_depth);
+                    owner_depths[i] =
+                            split_depth == std::numeric_limits<int>::max()
+                                    ? split_depth
+                                    : std::max(split_depth - sample_depth, 0);
+                }
+            });
+
+    // Builds the nodes one depth at a time. ranges[n] is the range of codes
+    // in the subtree of node n.
+    std::vector<Node> &nodes = octree->nodes_;
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    std::vector<int64_t> num_owned;
+    nodes.push_back(Node{0, 0, 0, 0, 0, 0});
+    ranges.emplace_back(0, num_points);
+    for (int64_t depth_begin = 0; depth_begin < int64_t(nodes.size());) {
+        const int64_t depth_end = int64_t(nodes.size());
+        const int depth = nodes[depth_begin].depth_;
+        std::vector<std::vector<std::pair<int64_t, int64_t>>> child_ranges(
+                depth_end - depth_begin);
+        num_owned.resize(depth_end);
+        utility::ParallelForEach(depth_begin, depth_end, [&](int64_t n) {
+            const int64_t begin = ranges[n].first;
+            const int64_t end = ranges[n].second;
+            const bool is_leaf = depth == max_depth ||
+                                 size_t(end - begin) <= max_leaf_points;
+            int64_t count = 0;
+            for (int64_t i = begin; i < end; i++) {
+                count += is_leaf ? owner_depths[i] >= depth
+                                 : owner_depths[i] == depth;
+            }
+            num_owned[n] = count;
+            if (is_leaf) {
+                return;
+            }
+            const int shift = 3 * (max_depth - depth - 1);
+            auto &children = child_ranges[n - depth_begin];
+            for (int64_t child_begin = begin; child_begin < end;) {
+                const uint64_t child_code = codes[child_begin] >> shift;
+                int64_t child_end =
+                        std::partition_point(
+                                codes.begin() + child_begin,
+                                codes.begin() + end,
+                                [&](uint64_t code) {
+                                    return code >> shift == child_code;
+                                }) -
+                        codes.begin();
+                children.emplace_back(child_begin, child_end);
+                child_begin = child_end;
+            }
+        });
+        for (int64_t n = depth_begin; n < depth_end; n++) {
+            auto &children = child_ranges[n - depth_begin];
+            nodes[n].first_child_ = int64_t(nodes.size());
+            nodes[n].num_children_ = int(children.size());
+            for (const auto &child : children) {
+                const uint64_t child_code =
+                        codes[child.first] >> (3 * (max_depth - depth - 1));
+                nodes.push_back(Node{child_code, depth + 1, 0, 0, 0, 0});
+                ranges.push_back(child);
+            }
+        }
+        depth_begin = depth_end;
+    }
+
+    // Points are laid out by owning node, in Morton order within a node.
+    const int64_t num_nodes = int64_t(nodes.size());
+    octree->depth_offsets_.assign(max_depth + 2, num_points);
+    int64_t offset = 0;
+    for (int64_t n = 0; n < num_nodes; n++) {
+        if (offset < octree->depth_offsets_[nodes[n].depth_]) {
+            octree->depth_offsets_[nodes[n].depth_] = offset;
+        }
+        nodes[n].point_begin_ = offset;
+        offset += num_owned[n];
+        nodes[n].point_end_ = offset;
+    }
+    octree->points_.resize(num_points);
+    octree->normals_.resize(cloud.HasNormals() ? num_points : 0);
+    octree->colors_.resize(cloud.HasColors() ? num_points : 0);
+    octree->point_indices_.resize(num_points);
+    utility::ParallelForEach(0, num_nodes, [&](int64_t n) {
+        const Node &node = nodes[n];
+        const bool is_leaf = node.num_children_ == 0;
+        int64_t dst = node.point_begin_;
+        for (int64_t i = ranges[n].first; i < ranges[n].second; i++) {
+            if (is_leaf ? owner_depths[i] < node.depth_
+                        : owner_depths[i] != node.depth_) {
+                continue;
+            }
+            const int64_t src = order[i];
+            octree->points_[dst] = cloud.points_[src];
+            if (cloud.HasNormals()) {
+                octree->normals_[dst] = cloud.normals_[src];
+            }
+            if (cloud.HasColors()) {
+                octree->colors_[dst] = cloud.colors_[src];
+            }
+            octree->point_indices_[dst] = src;
+            dst++;
+        }
+    });
+    return octree;
+}
+
+std::pair<Eigen::Vector3d, double> LinearOctree::GetNodeBounds(
+        size_t node) const {
+    const Node &n = nodes_[node];
+    const double size = size_ / double(int64_t(1) << n.depth_);
+    Eigen::Vector3d cell(double(CompactBy3(n.code_)),
+                         double(CompactBy3(n.code_ >> 1)),
+                         double(CompactBy3(n.code_ >> 2)));
+    return std::make_pair(origin_ + cell * size, size);
+}
+
+std::shared_ptr<PointCloud> LinearOctree::ExtractPointsUpToDepth(
+        int depth) const {
+    auto cloud = std::make_shared<PointCloud>();
+    if (IsEmpty()) {
+        return cloud;
+    }
+    const int64_t end =
+            depth_offsets_[std::min(std::max(depth + 1, 0), max_depth_ + 1)];
+    cloud->points_.assign(points_.begin(), points_.begin() + end);
+    if (!normals_.empty()) {
+        cloud->normals_.assign(normals_.begin(), normals_.begin() + end);
+    }
+    if (!colors_.empty()) {
+        cloud->colors_.assign(colors_.begin(), colors_.begin() + end);
+    }
+    return cloud;
+}
+
+std::shared_ptr<PointCloud> LinearOctree::ExtractPoints(
+        const std::vector<size_t> &nodes) const {
+    auto cloud = std::make_shared<PointCloud>();
+    for (size_t n : nodes) {
+        if (n >= nodes_.size()) {
+            utility::LogError("[LinearOctree] Node {:d} does not exist.", n);
+        }
+        const int64_t begin = nodes_[n].point_begin_;
+        const int64_t end = nodes_[n].point_end_;
+        cloud->points_.insert(cloud->points_.end(), points_.begin() + begin,
+                              points_.begin() + end);
+        if (!normals_.empty()) {
+            cloud->normals_.insert(cloud->normals_.end(),
+                                   normals_.begin() + begin,
+                                   normals_.begin() + end);
+        }
+        if (!colors_.empty()) {
+            cloud->colors_.insert(cloud->colors_.end(), colors_.begin() + begin,
+                                  colors_.begin() + end);
+        }
+    }
+    return cloud;
+}
+
+std::vector<size_t> LinearOctree::SelectNodes(
+        const Eigen::Vector3d &camera_position,
+        const Eigen::Matrix4d &view_projection,
+        double min_angular_spacing,
+        size_t max_points) const {
+    std::vector<size_t> selected;
+    if (IsEmpty()) {
+        return selected;
+    }
+    // Frustum planes in world space, with normals pointing inside.
+    Eigen::Matrix<double, 6, 4> planes;
+    for (int i = 0; i < 3; i++) {
+        planes.row(2 * i) = view_projection.row(3) + view_projection.row(i);
+        planes.row(2 * i + 1) = view_projection.row(3) - view_projection.row(i);
+    }
+    auto is_visible = [&](const Eigen::Vector3d &min_bound, double size) {
+        for (int p = 0; p < 6; p++) {
+            // Corner of the cell furthest along the plane normal.
+            double dist = planes(p, 3);
+            for (int k = 0; k < 3; k++) {
+                dist += planes(p, k) *
+                        (min_bound(k) + (planes(p, k) > 0 ? size : 0.0));
+            }
+            if (dist < 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    // Size of a cell seen from the camera, in radians for distant cells.
+    auto get_angular_size = [&](const Eigen::Vector3d &min_bound,
+                                double size) {
+        const Eigen::Vector3d center =
+                min_bound + Eigen::Vector3d::Constant(size / 2);
+        const double distance = (center - camera_position).norm() -
+                                size * std::sqrt(3.0) / 2;
+        return distance <= 0 ? std::numeric_limits<double>::infinity()
+                             : size / distance;
+    };
+
+    const double sample_scale = 1.0 / double(int64_t(1) << sample_depth_);
+    std::priority_queue<std::pair<double, size_t>> queue;
+    auto root = GetNodeBounds(0);
+    if (is_visible(root.first, root.second)) {
+        queue.emplace(get_angular_size(root.first, root.second), 0);
+    }
+    size_t num_points = 0;
+    while (!queue.empty()) {
+        const double angular_size = queue.top().first;
+        const size_t n = queue.top().second;
+        queue.pop();
+        const Node &node = nodes_[n];
+        const size_t num_owned = size_t(node.point_end_ - node.point_begin_);
+        if (num_points + num_owned > max_points) {
+            break;
+        }
+        selected.push_back(n);
+        num_points += num_owned;
+        if (angular_size * sample_scale <= min_angular_spacing) {
+            continue;
+        }
+        for (int c = 0; c < node.num_children_; c++) {
+            const size_t child = size_t(node.first_child_ + c);
+            auto bounds = GetNodeBounds(child);
+            if (is_visible(bounds.first, bounds.second)) {
+                queue.emplace(get_angular_size(bounds.first, bounds.second),
+                              child);
+            }
+        }
+    }
+    return selected;
+}
+
+}  // namespace geometry
+}  // namespace open3d
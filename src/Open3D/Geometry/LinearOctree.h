@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree over a point cloud with level-of-detail samples
+/// in every node.
+///
+/// Points are sorted by the Morton codes of their cells at the maximum depth,
+/// so every node spans a contiguous range of them, and the nodes are stored
+/// breadth-first in a flat array with the children of each node next to each
+/// other. Each point is owned by exactly one node: a node of depth d owns a
+/// spatially uniform sample of its points, one per occupied cell of depth
+/// d + sample_depth, that is not owned by an ancestor, and leaves own all
+/// their remaining points. The points of all nodes up to some depth thus form
+/// a progressively refined subsampling of the cloud, and the points owned by
+/// the nodes of depth at most d are a prefix of GetPoints().
+class LinearOctree {
+public:
+    struct Node {
+        /// Morton code of the cell of the node among the 8^depth_ cells of
+        /// its depth. Bits 3i, 3i + 1 and 3i + 2 interleave x, y and z.
+        uint64_t code_;
+        int depth_;
+        /// Children are nodes [first_child_, first_child_ + num_children_),
+        /// in Morton order. Leaves have no children.
+        int num_children_;
+        int64_t first_child_;
+        /// Points owned by the node are [point_begin_, point_end_).
+        int64_t point_begin_;
+        int64_t point_end_;
+    };
+
+    LinearOctree() {}
+
+    /// \brief Builds the octree of \p cloud in parallel.
+    ///
+    /// \param max_depth Maximum depth of the nodes, at most 21.
+    /// \param max_leaf_points Nodes with at most this many points are not
+    /// subdivided.
+    /// \param sample_depth Each node owns at most one point per cell of
+    /// 2^-sample_depth times its size.
+    static std::shared_ptr<LinearOctree> CreateFromPointCloud(
+            const PointCloud &cloud,
+            int max_depth = 12,
+            size_t max_leaf_points = 256,
+            int sample_depth = 5);
+
+public:
+    bool IsEmpty() const { return nodes_.empty(); }
+    int GetMaxDepth() const { return max_depth_; }
+    int GetSampleDepth() const { return sample_depth_; }
+    /// Minimum corner of the cubic root cell.
+    const Eigen::Vector3d &GetOrigin() const { return origin_; }
+    /// Edge length of the root cell.
+    double GetSize() const { return size_; }
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+    /// Points ordered by their owning node.
+    const std::vector<Eigen::Vector3d> &GetPoints() const { return points_; }
+    /// Minimum corner and edge length of the cell of \p node.
+    std::pair<Eigen::Vector3d, double> GetNodeBounds(size_t node) const;
+    /// Indices in the input cloud of the points of GetPoints().
+    const std::vector<int64_t> &GetPointIndices() const {
+        return point_indices_;
+    }
+
+    /// Returns the points owned by the nodes of depth at most \p depth, a
+    /// subsampling whose spacing halves with each depth.
+    std::shared_ptr<PointCloud> ExtractPointsUpToDepth(int depth) const;
+
+    /// Returns the points owned by \p nodes.
+    std::shared_ptr<PointCloud> ExtractPoints(
+            const std::vector<size_t> &nodes) const;
+
+    /// \brief Selects the nodes to display for a view.
+    ///
+    /// Nodes are refined from the root in order of decreasing size seen from
+    /// \p camera_position, skipping nodes outside of the view frustum of
+    /// \p view_projection (OpenGL clip space conventions). A node is refined
+    /// while the spacing of its samples seen from the camera exceeds
+    /// \p min_angular_spacing radians, and selection stops before the
+    /// selected nodes own more than \p max_points points. The selection is
+    /// closed under ancestors, so the parents of every node come first.
+    std::vector<size_t> SelectNodes(const Eigen::Vector3d &camera_position,
+                                    const Eigen::Matrix4d &view_projection,
+                                    double min_angular_spacing,
+                                    size_t max_points) const;
+
+private:
+    int max_depth_ = 0;
+    int sample_depth_ = 0;
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    double size_ = 0.0;
+    std::vector<Node> nodes_;
+    std::vector<Eigen::Vector3d> points_;
+    std::vector<Eigen::Vector3d> normals_;
+    std::vector<Eigen::Vector3d> colors_;
+    std::vector<int64_t> point_indices_;
+    /// Index in points_ of the first point owned by a node of each depth,
+    /// followed by the number of points.
+    std::vector<int64_t> depth_offsets_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -29,11 +29,18 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <numeric>
 
+#include "Open3D/Geometry/HashGridSearch.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -124,21 +131,23 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
     std::vector<double> distances(points_.size());
     KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices(1);
-        std::vector<double> dists(1);
-        if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
-            utility::LogDebug(
-                    "[ComputePointCloudToPointCloudDistance] Found a point "
-                    "without neighbors.");
-            distances[i] = 0.0;
-        } else {
-            distances[i] = std::sqrt(dists[0]);
-        }
-    }
+    kdtree.SearchBatchInBlocks(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)points_.data(),
+                                              3, points_.size()),
+            KDTreeSearchParamKNN(1),
+            [&](int64_t begin, int64_t end, const KDTreeSearchResult &result) {
+                utility::ParallelForEach(begin, end, [&](int64_t i) {
+                    if (result.NumNeighbors(i - begin) == 0) {
+                        utility::LogDebug(
+                                "[ComputePointCloudToPointCloudDistance] "
+                                "Found a point without neighbors.");
+                        distances[i] = 0.0;
+                    } else {
+                        distances[i] =
+                                std::sqrt(result.Distance2(i - begin)[0]);
+                    }
+                });
+            });
     return distances;
 }
 
@@ -293,12 +302,98 @@ public:
 private:
     // original point cloud id in higher resolution + its cubic id
     std::vector<point_cubic_id> original_id;
-    std::unordered_map<int, int> classes;
+    std::map<int, int> classes;
 };
+
+/// Groups \p points by the voxel of size \p voxel_size containing them, with
+/// voxel_min_bound a voxel corner. On return, the points of voxel v are
+/// order[voxel_offsets[v]] to order[voxel_offsets[v + 1] - 1] in increasing
+/// index order, and the voxels are sorted by their integer coordinates.
+void GroupPointsByVoxel(const std::vector<Eigen::Vector3d> &points,
+                        const Eigen::Vector3d &voxel_min_bound,
+                        double voxel_size,
+                        std::vector<int64_t> &order,
+                        std::vector<int64_t> &voxel_offsets) {
+    const int64_t num_points = int64_t(points.size());
+    std::vector<Eigen::Vector3i> voxel_indices(num_points);
+    Eigen::Vector3i min_index = Eigen::Vector3i::Constant(
+            std::numeric_limits<int>::max());
+    Eigen::Vector3i max_index = Eigen::Vector3i::Constant(
+            std::numeric_limits<int>::min());
+    std::mutex bounds_mutex;
+    utility::ParallelFor(0, num_points, 65536, [&](int64_t begin,
+                                                   int64_t end) {
+        Eigen::Vector3i local_min =
+                Eigen::Vector3i::Constant(std::numeric_limits<int>::max());
+        Eigen::Vector3i local_max =
+                Eigen::Vector3i::Constant(std::numeric_limits<int>::min());
+        for (int64_t i = begin; i < end; i++) {
+            Eigen::Vector3d ref_coord =
+                    (points[i] - voxel_min_bound) / voxel_size;
+            voxel_indices[i] << int(floor(ref_coord(0))),
+                    int(floor(ref_coord(1))), int(floor(ref_coord(2)));
+            local_min = local_min.cwiseMin(voxel_indices[i]);
+            local_max = local_max.cwiseMax(voxel_indices[i]);
+        }
+        std::lock_guard<std::mutex> lock(bounds_mutex);
+        min_index = min_index.cwiseMin(local_min);
+        max_index = max_index.cwiseMax(local_max);
+    });
+
+    // Pack the voxel coordinates into 64 bit keys when they fit, which they
+    // do unless the voxels are tiny compared to the cloud.
+    int num_bits[3];
+    for (int c = 0; c < 3; c++) {
+        num_bits[c] = 0;
+        while (num_bits[c] < 32 &&
+               (int64_t(max_index(c)) - min_index(c)) >> num_bits[c] > 0) {
+            num_bits[c]++;
+        }
+    }
+    const int num_key_bits = num_bits[0] + num_bits[1] + num_bits[2];
+    order.resize(num_points);
+    std::iota(order.begin(), order.end(), int64_t(0));
+    std::vector<uint64_t> keys;
+    if (num_key_bits <= 64) {
+        keys.resize(num_points);
+        utility::ParallelForEach(
+                0, num_points,
+                [&](int64_t i) {
+                    const Eigen::Vector3i &v = voxel_indices[i];
+                    keys[i] = (uint64_t(int64_t(v(0)) - min_index(0))
+                               << (num_bits[1] + num_bits[2])) |
+                              (uint64_t(int64_t(v(1)) - min_index(1))
+                               << num_bits[2]) |
+                              uint64_t(int64_t(v(2)) - min_index(2));
+                },
+                4096);
+        utility::ParallelRadixSort(keys, order, num_key_bits);
+    } else {
+        std::sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+            const Eigen::Vector3i &va = voxel_indices[a];
+            const Eigen::Vector3i &vb = voxel_indices[b];
+            return std::make_tuple(va(0), va(1), va(2), a) <
+                   std::make_tuple(vb(0), vb(1), vb(2), b);
+        });
+    }
+
+    voxel_offsets.clear();
+    for (int64_t k = 0; k < num_points; k++) {
+        bool new_voxel =
+                k == 0 ||
+                (keys.empty() ? voxel_indices[order[k]] !=
+                                        voxel_indices[order[k - 1]]
+                              : keys[k] != keys[k - 1]);
+        if (new_voxel) {
+            voxel_offsets.push_back(k);
+        }
+    }
+    voxel_offsets.push_back(num_points);
+}
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
-        double voxel_size) const {
+        double voxel_size, VoxelAggregation aggregation) const {
     auto output = std::make_shared<PointCloud>();
     if (voxel_size <= 0.0) {
         utility::LogError("[VoxelDownSample] voxel_size <= 0.");
@@ -311,29 +406,76 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    std::vector<int64_t> order;
+    std::vector<int64_t> voxel_offsets;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, order,
+                       voxel_offsets);
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
-        }
-        if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
-        }
-    }
+    const int64_t num_voxels = int64_t(voxel_offsets.size()) - 1;
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    utility::ParallelForEach(
+            0, num_voxels,
+            [&](int64_t v) {
+                const int64_t begin = voxel_offsets[v];
+                const int64_t end = voxel_offsets[v + 1];
+                if (aggregation == VoxelAggregation::Centroid) {
+                    AccumulatedPoint accpoint;
+                    for (int64_t k = begin; k < end; k++) {
+                        accpoint.AddPoint(*this, int(order[k]));
+                    }
+                    output->points_[v] = accpoint.GetAveragePoint();
+                    if (has_normals) {
+                        output->normals_[v] = accpoint.GetAverageNormal();
+                    }
+                    if (has_colors) {
+                        output->colors_[v] = accpoint.GetAverageColor();
+                    }
+                    return;
+                }
+                int64_t selected = order[begin];
+                if (aggregation == VoxelAggregation::NearestToCenter) {
+                    Eigen::Vector3d ref_coord =
+                            (points_[selected] - voxel_min_bound) / voxel_size;
+                    Eigen::Vector3d center =
+                            voxel_min_bound +
+                            ((ref_coord.array().floor() + 0.5) * voxel_size)
+                                    .matrix();
+                    double min_distance2 =
+                            (points_[selected] - center).squaredNorm();
+                    for (int64_t k = begin + 1; k < end; k++) {
+                        double distance2 =
+                                (points_[order[k]] - center).squaredNorm();
+                        if (distance2 < min_distance2) {
+                            min_distance2 = distance2;
+                            selected = order[k];
+                        }
+                    }
+                } else {
+                    // SplitMix64 of the first point index, so that the choice
+                    // does not depend on the thread schedule.
+                    uint64_t hash = uint64_t(selected) + 0x9E3779B97F4A7C15ull;
+                    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+                    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+                    hash ^= hash >> 31;
+                    selected = order[begin + int64_t(hash % (end - begin))];
+                }
+                output->points_[v] = points_[selected];
+                if (has_normals) {
+                    output->normals_[v] = normals_[selected];
+                }
+                if (has_colors) {
+                    output->colors_[v] = colors_[selected];
+                }
+            },
+            256);
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
@@ -360,52 +502,62 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    std::vector<int64_t> order;
+    std::vector<int64_t> voxel_offsets;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, order,
+                       voxel_offsets);
+
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
-    cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
-        }
-        if (has_colors) {
-            if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
-            } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
-            }
-        }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
-        }
-        cnt++;
+    const int64_t num_voxels = int64_t(voxel_offsets.size()) - 1;
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
     }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    cubic_id.resize(num_voxels, 8);
+    cubic_id.setConstant(-1);
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    int cid_temp[3] = {1, 2, 4};
+    utility::ParallelForEach(
+            0, num_voxels,
+            [&](int64_t v) {
+                AccumulatedPointForTrace accpoint;
+                for (int64_t k = voxel_offsets[v]; k < voxel_offsets[v + 1];
+                     k++) {
+                    size_t i = size_t(order[k]);
+                    Eigen::Vector3d ref_coord =
+                            (points_[i] - voxel_min_bound) / voxel_size;
+                    int cid = 0;
+                    for (int c = 0; c < 3; c++) {
+                        if ((ref_coord(c) - floor(ref_coord(c))) >= 0.5) {
+                            cid += cid_temp[c];
+                        }
+                    }
+                    accpoint.AddPoint(*this, i, cid, approximate_class);
+                }
+                output->points_[v] = accpoint.GetAveragePoint();
+                if (has_normals) {
+                    output->normals_[v] = accpoint.GetAverageNormal();
+                }
+                if (has_colors) {
+                    if (approximate_class) {
+                        output->colors_[v] = accpoint.GetMaxClass();
+                    } else {
+                        output->colors_[v] = accpoint.GetAverageColor();
+                    }
+                }
+                auto original_id = accpoint.GetOriginalID();
+                for (int i = 0; i < (int)original_id.size(); i++) {
+                    size_t pid = original_id[i].point_id;
+                    int cid = original_id[i].cubic_id;
+                    cubic_id(v, cid) = int(pid);
+                    original_indices[v].push_back(int(pid));
+                }
+            },
+            256);
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
@@ -444,24 +596,31 @@ std::shared_ptr<PointCloud> PointCloud::Crop(
 }
 
 std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
-PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
+PointCloud::RemoveRadiusOutliers(size_t nb_points,
+                                 double search_radius,
+                                 NeighborSearchBackend backend) const {
     if (nb_points < 1 || search_radius <= 0) {
         utility::LogError(
                 "[RemoveRadiusOutliers] Illegal input parameters,"
                 "number of points and radius must be positive");
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
+    std::vector<char> mask(points_.size());
+    auto count_neighbors = [&](int64_t begin, int64_t end,
+                               const KDTreeSearchResult &result) {
+        for (int64_t i = begin; i < end; i++) {
+            mask[i] = (size_t(result.NumNeighbors(i - begin)) > nb_points);
+        }
+    };
+    Eigen::Map<const Eigen::MatrixXd> queries((const double *)points_.data(),
+                                              3, points_.size());
+    KDTreeSearchParamRadius param(search_radius);
+    if (backend == NeighborSearchBackend::HashGrid) {
+        HashGridSearch grid(points_, search_radius);
+        grid.SearchBatchInBlocks(queries, param, count_neighbors);
+    } else {
+        KDTreeFlann kdtree;
+        kdtree.SetGeometry(*this);
+        kdtree.SearchBatchInBlocks(queries, param, count_neighbors);
     }
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
@@ -488,23 +647,27 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
     kdtree.SetGeometry(*this);
     std::vector<double> avg_distances = std::vector<double>(points_.size());
     std::vector<size_t> indices;
-    size_t valid_distances = 0;
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
-        double mean = -1.0;
-        if (dist.size() > 0u) {
-            valid_distances++;
-            std::for_each(dist.begin(), dist.end(),
-                          [](double &d) { d = std::sqrt(d); });
-            mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
-        }
-        avg_distances[i] = mean;
-    }
+    std::atomic<size_t> valid_distances(0);
+    kdtree.SearchBatchInBlocks(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)points_.data(),
+                                              3, points_.size()),
+            KDTreeSearchParamKNN(int(nb_neighbors)),
+            [&](int64_t begin, int64_t end, const KDTreeSearchResult &result) {
+                utility::ParallelForEach(begin, end, [&](int64_t i) {
+                    const int num_neighbors = result.NumNeighbors(i - begin);
+                    const double *dist = result.Distance2(i - begin);
+                    double mean = -1.0;
+                    if (num_neighbors > 0) {
+                        valid_distances++;
+                        double sum = 0.0;
+                        for (int k = 0; k < num_neighbors; k++) {
+                            sum += std::sqrt(dist[k]);
+                        }
+                        mean = sum / num_neighbors;
+                    }
+                    avg_distances[i] = mean;
+                });
+            });
     if (valid_distances == 0) {
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
@@ -573,23 +736,17 @@ std::vector<double> PointCloud::ComputeMahalanobisDistance() const {
     Eigen::Matrix3d covariance;
     std::tie(mean, covariance) = ComputeMeanAndCovariance();
     Eigen::Matrix3d cov_inv = covariance.inverse();
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelForEach(0, int64_t(points_.size()), [&](int64_t i) {
         Eigen::Vector3d p = points_[i] - mean;
         mahalanobis[i] = std::sqrt(p.transpose() * cov_inv * p);
-    }
+    });
     return mahalanobis;
 }
 
 std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
     std::vector<double> nn_dis(points_.size());
     KDTreeFlann kdtree(*this);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelForEach(0, int64_t(points_.size()), [&](int64_t i) {
         std::vector<int> indices(2);
         std::vector<double> dists(2);
         if (kdtree.SearchKNN(points_[i], 2, indices, dists) <= 1) {
@@ -600,7 +757,7 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
         } else {
             nn_dis[i] = std::sqrt(dists[1]);
         }
-    }
+    });
     return nn_dis;
 }
 
@@ -62,6 +62,16 @@ public:
         : Geometry3D(Geometry::GeometryType::PointCloud), points_(points) {}
     ~PointCloud() override {}
 
+    /// \brief Indicates how VoxelDownSample() reduces the points of a voxel.
+    ///
+    /// \param Centroid indicates that points and colors are averaged and
+    /// normals are averaged and normalized.
+    /// \param NearestToCenter indicates that the point closest to the voxel
+    /// center is kept, with its normal and color.
+    /// \param Random indicates that a pseudo-random point of the voxel is
+    /// kept, with its normal and color. The choice is reproducible.
+    enum class VoxelAggregation { Centroid, NearestToCenter, Random };
+
 public:
     PointCloud &Clear() override;
     bool IsEmpty() const override;
@@ -131,11 +141,16 @@ public:
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
-    /// Normals and colors are averaged if they exist.
+    /// Normals and colors are reduced with the points if they exist. The
+    /// points are grouped by a parallel radix sort on their voxel, and the
+    /// output points are ordered by voxel.
     ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
-    std::shared_ptr<PointCloud> VoxelDownSample(double voxel_size) const;
+    /// \param aggregation How the points of a voxel are reduced.
+    std::shared_ptr<PointCloud> VoxelDownSample(
+            double voxel_size,
+            VoxelAggregation aggregation = VoxelAggregation::Centroid) const;
 
     /// \brief Function to downsample using geometry.PointCloud.VoxelDownSample
     ///
@@ -184,8 +199,12 @@ public:
     ///
     /// \param nb_points Number of points within the radius.
     /// \param search_radius Radius of the sphere.
+    /// \param backend Spatial index used for the neighbor search.
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
-    RemoveRadiusOutliers(size_t nb_points, double search_radius) const;
+    RemoveRadiusOutliers(size_t nb_points,
+                         double search_radius,
+                         NeighborSearchBackend backend =
+                                 NeighborSearchBackend::KDTree) const;
 
     /// \brief Function to remove points that are further away from their
     /// \p nb_neighbor neighbors in average.
@@ -208,6 +227,33 @@ public:
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
             bool fast_normal_computation = true);
 
+    /// \brief Function to compute the normals of an organized point cloud.
+    ///
+    /// The points must hold one point per pixel of a \p width x \p height
+    /// image in row-major order, with NaN points for pixels without depth, as
+    /// returned by CreateFromDepthImage() with project_valid_depth_only set to
+    /// false. The neighbors of a point are the valid points in the image
+    /// window around its pixel, so no KDTree is built. Normals are oriented
+    /// with respect to the input point cloud if normals exist.
+    ///
+    /// \param width Width of the image grid.
+    /// \param height Height of the image grid.
+    /// \param window_radius The window spans 2 * \p window_radius + 1 pixels
+    /// in each direction.
+    /// \param max_neighbor_distance Window points farther than this from the
+    /// center are not neighbors, which keeps normals from blending across
+    /// depth discontinuities. A non-positive value disables the check.
+    /// \param fast_normal_computation If true, the normal estimation uses a
+    /// non-iterative method to extract the eigenvector from the covariance
+    /// matrix.
+    ///
+    /// \return false if the points do not form a \p width x \p height grid.
+    bool EstimateNormalsOrganized(int width,
+                                  int height,
+                                  int window_radius = 2,
+                                  double max_neighbor_distance = 0.0,
+                                  bool fast_normal_computation = true);
+
     /// \brief Function to orient the normals of a point cloud.
     ///
     /// \param orientation_reference Normals are oriented with respect to
@@ -275,23 +321,64 @@ public:
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
     /// console.
+    /// \param backend Spatial index used for the neighbor search.
     std::vector<int> ClusterDBSCAN(double eps,
                                    size_t min_points,
-                                   bool print_progress = false) const;
+                                   bool print_progress = false,
+                                   NeighborSearchBackend backend =
+                                           NeighborSearchBackend::KDTree) const;
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// Hypotheses are scored in parallel, first on a random subset of the
+    /// points to skip those unlikely to beat the best one. The iterations
+    /// stop early once a plane with the best inlier ratio so far would have
+    /// been sampled with the requested probability.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Confidence of having sampled the best plane at
+    /// which the iterations stop. 1 runs all \p num_iterations.
+    /// \param seed Seed of the random samples. The result only depends on
+    /// the seed, not on the number of threads. A negative seed draws one from
+    /// std::random_device.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            const int seed = -1) const;
+
+    /// \brief Segment up to \p max_planes planes using the RANSAC algorithm.
+    ///
+    /// Planes are segmented one after the other as in SegmentPlane(), each
+    /// from the points that are not inliers of the previous ones.
+    ///
+    /// \param distance_threshold Max distance a point can be from a plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param max_planes Maximum number of planes.
+    /// \param min_num_inliers The extraction stops at the first plane with
+    /// fewer inliers.
+    /// \param probability See SegmentPlane().
+    /// \param seed See SegmentPlane().
+    /// \return Returns the plane models and the indices of their inliers, in
+    /// extraction order.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const double distance_threshold,
+                  const int ransac_n,
+                  const int num_iterations,
+                  const int max_planes,
+                  const size_t min_num_inliers = 3,
+                  const double probability = 0.99999999,
+                  const int seed = -1) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -27,94 +27,192 @@
 #include "Open3D/Geometry/PointCloud.h"
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
 
+#include "Open3D/Geometry/HashGridSearch.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Utility/Console.h"
-
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
-
-    // precompute all neighbours
-    utility::LogDebug("Precompute Neighbours");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
-
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        { ++progress_bar; }
-    }
-    utility::LogDebug("Done Precompute Neighbours");
+namespace {
+
+/// Runs \p func(i, neighbors, num_neighbors) in parallel for the
+/// neighborhood \p param of every point i in \p ids. Every thread searches
+/// one point at a time, so no neighbor list outlives its callback.
+template <typename NeighborSearch, typename func_t>
+void ForEachNeighborhood(const std::vector<Eigen::Vector3d> &points,
+                         const NeighborSearch &search,
+                         const KDTreeSearchParam &param,
+                         const std::vector<int> &ids,
+                         utility::ConsoleProgressBar &progress_bar,
+                         func_t func) {
+    std::mutex progress_mutex;
+    utility::ParallelFor(
+            0, int64_t(ids.size()), 256, [&](int64_t begin, int64_t end) {
+                std::vector<int> indices;
+                std::vector<double> distance2;
+                for (int64_t k = begin; k < end; k++) {
+                    int num_neighbors = search.Search(points[ids[k]], param,
+                                                      indices, distance2);
+                    func(ids[k], indices.data(), std::max(num_neighbors, 0));
+                }
+                std::lock_guard<std::mutex> lock(progress_mutex);
+                for (int64_t k = begin; k < end; k++) {
+                    ++progress_bar;
+                }
+            });
+}
 
-    // set all labels to undefined (-2)
-    utility::LogDebug("Compute Clusters");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        if (labels[idx] != -2) {  // label is not undefined
-            continue;
+/// Concurrent union-find over point indices. A union links the root with the
+/// larger index to the other one, so the root of a set is its smallest
+/// element.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(size_t size) : parents_(size) {
+        for (size_t i = 0; i < size; i++) {
+            parents_[i].store(int(i), std::memory_order_relaxed);
         }
+    }
 
-        // check density
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+    int Find(int x) {
+        while (true) {
+            int parent = parents_[x].load(std::memory_order_acquire);
+            if (parent == x) {
+                return x;
+            }
+            // Path halving. A failed exchange only means that another
+            // thread already moved x closer to the root.
+            int grandparent = parents_[parent].load(std::memory_order_acquire);
+            if (grandparent != parent) {
+                parents_[x].compare_exchange_weak(parent, grandparent,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed);
+            }
+            x = grandparent;
         }
+    }
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            if (labels[nb] == -1) {  // noise label
-                labels[nb] = cluster_label;
-                ++progress_bar;
+    void Union(int x, int y) {
+        while (true) {
+            x = Find(x);
+            y = Find(y);
+            if (x == y) {
+                return;
             }
-            if (labels[nb] != -2) {  // not undefined label
-                continue;
+            if (x < y) {
+                std::swap(x, y);
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
-
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
-                    }
-                }
+            // Only roots are linked. If x stopped being a root in between,
+            // start over from the new roots.
+            int expected = x;
+            if (parents_[x].compare_exchange_strong(
+                        expected, y, std::memory_order_acq_rel)) {
+                return;
             }
         }
+    }
 
-        cluster_label++;
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+/// Labels the points of \p points with DBSCAN, searching neighborhoods with
+/// \p search. See PointCloud::ClusterDBSCAN().
+template <typename NeighborSearch>
+std::vector<int> ClusterDBSCANImpl(const std::vector<Eigen::Vector3d> &points,
+                                   const NeighborSearch &search,
+                                   double eps,
+                                   size_t min_points,
+                                   bool print_progress) {
+    const int num_points = int(points.size());
+    std::vector<int> all_ids(num_points);
+    std::iota(all_ids.begin(), all_ids.end(), 0);
+
+    // A point is a core point if its neighborhood, which contains the point
+    // itself, holds at least min_points points. Searching no further than
+    // min_points neighbors is enough to tell.
+    utility::LogDebug("Count Neighbours");
+    utility::ConsoleProgressBar progress_bar(num_points, "Count Neighbours",
+                                             print_progress);
+    std::vector<char> is_core(num_points, min_points == 0);
+    KDTreeSearchParamRadius param(eps);
+    if (min_points > 0) {
+        KDTreeSearchParamHybrid count_param(
+                eps, int(std::min(min_points, size_t(num_points))));
+        ForEachNeighborhood(
+                points, search, count_param, all_ids, progress_bar,
+                [&](int i, const int *, int num_neighbors) {
+                    is_core[i] = size_t(num_neighbors) >= min_points;
+                });
+    }
+    std::vector<int> core_ids;
+    std::vector<int> other_ids;
+    for (int i = 0; i < num_points; i++) {
+        (is_core[i] ? core_ids : other_ids).push_back(i);
     }
+    utility::LogDebug("Done Count Neighbours: {:d} core points",
+                      core_ids.size());
+
+    // Clusters are the connected components of the core points. They are
+    // numbered in the order of their smallest core point, which is the
+    // order in which a serial expansion over the points discovers them.
+    utility::LogDebug("Compute Clusters");
+    progress_bar.reset(num_points, "Clustering", print_progress);
+    ConcurrentUnionFind components(num_points);
+    ForEachNeighborhood(points, search, param, core_ids, progress_bar,
+                        [&](int i, const int *neighbors, int num_neighbors) {
+                            // Both ends see an edge, only one unites it.
+                            for (int k = 0; k < num_neighbors; k++) {
+                                if (neighbors[k] > i && is_core[neighbors[k]]) {
+                                    components.Union(i, neighbors[k]);
+                                }
+                            }
+                        });
+    std::vector<int> labels(num_points, -1);
+    int cluster_label = 0;
+    for (int i : core_ids) {
+        int root = components.Find(i);
+        labels[i] = root == i ? cluster_label++ : labels[root];
+    }
+
+    // A border point joins the first discovered cluster among those of its
+    // core neighbors. Points without core neighbors are noise.
+    ForEachNeighborhood(points, search, param, other_ids, progress_bar,
+                        [&](int i, const int *neighbors, int num_neighbors) {
+                            for (int k = 0; k < num_neighbors; k++) {
+                                int nb = neighbors[k];
+                                if (is_core[nb] &&
+                                    (labels[i] < 0 || labels[nb] < labels[i])) {
+                                    labels[i] = labels[nb];
+                                }
+                            }
+                        });
 
     utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
     return labels;
 }
 
+}  // unnamed namespace
+
+std::vector<int> PointCloud::ClusterDBSCAN(
+        double eps,
+        size_t min_points,
+        bool print_progress,
+        NeighborSearchBackend backend) const {
+    if (backend == NeighborSearchBackend::HashGrid) {
+        HashGridSearch grid(points_, eps);
+        return ClusterDBSCANImpl(points_, grid, eps, min_points,
+                                 print_progress);
+    }
+    KDTreeFlann kdtree(*this);
+    return ClusterDBSCANImpl(points_, kdtree, eps, min_points, print_progress);
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -35,6 +35,7 @@
 
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -52,34 +53,34 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
+// Calculates the number of inliers among points[candidates[k]] given a plane
+// model, and the total distance between the inliers and the plane. These
+// numbers are then used to evaluate how well the plane model fits the given
+// points.
 RANSACResult EvaluateRANSACBasedOnDistance(
         const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &candidates,
         const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
+        double distance_threshold) {
     RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
+    double error = 0;
+    size_t inlier_num = 0;
+    for (size_t idx : candidates) {
         Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
         double distance = std::abs(plane_model.dot(point));
 
         if (distance < distance_threshold) {
             error += distance;
-            inliers.emplace_back(idx);
+            inlier_num++;
         }
     }
 
-    size_t inlier_num = inliers.size();
     if (inlier_num == 0) {
         result.fitness_ = 0;
         result.inlier_rmse_ = 0;
     } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
+        result.fitness_ = (double)inlier_num / (double)candidates.size();
         result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
     }
     return result;
@@ -133,72 +134,112 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
-
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
-
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
-
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
+namespace {
 
-    std::random_device rd;
-    std::mt19937 rng(rd());
+// Segments the plane with the most inliers among points[candidates[k]]. The
+// returned inliers index points.
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &candidates,
+        double distance_threshold,
+        int num_iterations,
+        double probability,
+        uint32_t seed) {
+    // Hypotheses are scored in parallel batches of fixed size and compared in
+    // iteration order. Iteration itr draws its sample from its own generator,
+    // so the result only depends on the seed.
+    const int batch_size = 32;
+    auto make_rng = [seed](uint32_t stream, uint32_t itr) {
+        std::seed_seq seq{seed, stream, itr};
+        return std::mt19937(seq);
+    };
 
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
+    // Hypotheses whose inlier ratio on a random subset is well below the best
+    // full inlier ratio are not scored on all candidates.
+    const size_t num_candidates = candidates.size();
+    const size_t subset_size = 1024;
+    std::vector<size_t> subset;
+    if (num_candidates > 4 * subset_size) {
+        std::mt19937 rng = make_rng(1, 0);
+        std::uniform_int_distribution<size_t> dist(0, num_candidates - 1);
+        subset.resize(subset_size);
+        for (size_t &idx : subset) {
+            idx = candidates[dist(rng)];
+        }
     }
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
+    RANSACResult result;
+    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+    int max_iterations = num_iterations;
+    for (int begin = 0; begin < max_iterations; begin += batch_size) {
+        const int end = std::min(begin + batch_size, max_iterations);
+        std::vector<RANSACResult> results(end - begin);
+        std::vector<Eigen::Vector4d> plane_models(end - begin,
+                                                  Eigen::Vector4d(0, 0, 0, 0));
+        const double subset_fitness_threshold =
+                result.fitness_ -
+                3.0 * std::sqrt(result.fitness_ * (1.0 - result.fitness_) /
+                                double(subset_size));
+        utility::ParallelForEach(begin, end, [&](int64_t itr) {
+            std::mt19937 rng = make_rng(0, uint32_t(itr));
+            std::uniform_int_distribution<size_t> dist(0, num_candidates - 1);
+            size_t sample[3];
+            for (int i = 0; i < 3; ++i) {
+                bool duplicate = true;
+                while (duplicate) {
+                    sample[i] = dist(rng);
+                    duplicate = std::find(sample, sample + i, sample[i]) !=
+                                sample + i;
+                }
+            }
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
+            // Fit model to num_model_parameters randomly selected points among
+            // the inliers.
+            Eigen::Vector4d plane_model = TriangleMesh::ComputeTrianglePlane(
+                    points[candidates[sample[0]]],
+                    points[candidates[sample[1]]],
+                    points[candidates[sample[2]]]);
+            if (plane_model.isZero(0)) {
+                return;
+            }
+            if (!subset.empty() &&
+                EvaluateRANSACBasedOnDistance(points, subset, plane_model,
+                                              distance_threshold)
+                                .fitness_ < subset_fitness_threshold) {
+                return;
+            }
+            results[itr - begin] = EvaluateRANSACBasedOnDistance(
+                    points, candidates, plane_model, distance_threshold);
+            plane_models[itr - begin] = plane_model;
+        });
+        for (int k = 0; k < end - begin; k++) {
+            const RANSACResult &this_result = results[k];
+            if (this_result.fitness_ > result.fitness_ ||
+                (this_result.fitness_ == result.fitness_ &&
+                 this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                result = this_result;
+                best_plane_model = plane_models[k];
+            }
         }
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+        // Number of iterations after which a sample of 3 inliers of the best
+        // plane was drawn with the given probability.
+        const double p_sample = std::pow(result.fitness_, 3);
+        if (probability < 1.0 && p_sample > 0.0) {
+            double needed = p_sample >= 1.0
+                                    ? 0.0
+                                    : std::log(1.0 - probability) /
+                                              std::log(1.0 - p_sample);
+            if (needed < double(max_iterations)) {
+                max_iterations = std::max(end, int(std::ceil(needed)));
+            }
         }
     }
 
     // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
+    std::vector<size_t> inliers;
+    for (size_t idx : candidates) {
+        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
         double distance = std::abs(best_plane_model.dot(point));
 
@@ -208,12 +249,87 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     }
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    best_plane_model = GetPlaneFromPoints(points, inliers);
 
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
+    utility::LogDebug(
+            "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iterations: "
+            "{:d}",
+            inliers.size(), result.fitness_, result.inlier_rmse_,
+            max_iterations);
     return std::make_tuple(best_plane_model, inliers);
 }
 
+// Checks the parameters shared by SegmentPlane() and SegmentPlanes(), and
+// resolves a negative seed.
+uint32_t CheckRANSACParameters(int ransac_n,
+                               size_t num_points,
+                               double probability,
+                               int seed) {
+    // Return if ransac_n is less than the required plane model parameters.
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (num_points < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    if (probability <= 0.0 || probability > 1.0) {
+        utility::LogError("probability must be in (0, 1].");
+    }
+    return seed < 0 ? std::random_device()() : uint32_t(seed);
+}
+
+}  // unnamed namespace
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */,
+        const int seed /* = -1 */) const {
+    uint32_t rng_seed = CheckRANSACParameters(ransac_n, points_.size(),
+                                              probability, seed);
+    std::vector<size_t> candidates(points_.size());
+    std::iota(std::begin(candidates), std::end(candidates), 0);
+    return SegmentPlaneRANSAC(points_, candidates, distance_threshold,
+                              num_iterations, probability, rng_seed);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const double distance_threshold,
+                          const int ransac_n,
+                          const int num_iterations,
+                          const int max_planes,
+                          const size_t min_num_inliers /* = 3 */,
+                          const double probability /* = 0.99999999 */,
+                          const int seed /* = -1 */) const {
+    uint32_t rng_seed = CheckRANSACParameters(ransac_n, points_.size(),
+                                              probability, seed);
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    std::vector<size_t> candidates(points_.size());
+    std::iota(std::begin(candidates), std::end(candidates), 0);
+    std::vector<char> is_inlier(points_.size(), 0);
+    for (int k = 0; k < max_planes && candidates.size() >= size_t(ransac_n);
+         k++) {
+        auto plane = SegmentPlaneRANSAC(points_, candidates, distance_threshold,
+                                        num_iterations, probability,
+                                        rng_seed + uint32_t(k));
+        const std::vector<size_t> &inliers = std::get<1>(plane);
+        if (inliers.size() < std::max(min_num_inliers, size_t(1))) {
+            break;
+        }
+        for (size_t idx : inliers) {
+            is_inlier[idx] = 1;
+        }
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        [&](size_t idx) {
+                                            return is_inlier[idx] != 0;
+                                        }),
+                         candidates.end());
+        planes.push_back(std::move(plane));
+    }
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -0,0 +1,644 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TiledPointCloud.h"
+
+#include <json/json.h>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/MappedFile.h"
+
+namespace open3d {
+
+namespace {
+using namespace geometry;
+
+const char *const kIndexFileName = "index.json";
+
+/// Number of doubles per point in the tile files.
+int GetRecordSize(bool has_normals, bool has_colors) {
+    return 3 * (1 + int(has_normals) + int(has_colors));
+}
+
+Eigen::Vector3i GetTileIndex(const Eigen::Vector3d &point, double tile_size) {
+    return (point / tile_size).array().floor().cast<int>();
+}
+
+/// Orders tile and voxel indices by x, then y, then z.
+bool IndexLess(const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+}
+
+std::string GetTileFileName(const std::string &directory,
+                            const Eigen::Vector3i &index) {
+    return directory + "/tile_" + std::to_string(index(0)) + "_" +
+           std::to_string(index(1)) + "_" + std::to_string(index(2)) + ".bin";
+}
+
+Json::Value Vector3dToJson(const Eigen::Vector3d &vec) {
+    Json::Value value(Json::arrayValue);
+    for (int i = 0; i < 3; i++) {
+        value.append(vec(i));
+    }
+    return value;
+}
+
+bool IsSameDirectory(const std::string &a, const std::string &b) {
+    return utility::filesystem::GetRegularizedDirectoryName(a) ==
+           utility::filesystem::GetRegularizedDirectoryName(b);
+}
+
+bool EndsWith(const std::string &str, const std::string &suffix) {
+    return str.size() > suffix.size() &&
+           str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+}  // unnamed namespace
+
+namespace geometry {
+
+TiledPointCloudWriter::TiledPointCloudWriter(
+        const std::string &directory,
+        double tile_size,
+        bool has_normals,
+        bool has_colors,
+        int64_t memory_budget /* = int64_t(256) << 20 */)
+    : directory_(directory),
+      tile_size_(tile_size),
+      has_normals_(has_normals),
+      has_colors_(has_colors),
+      memory_budget_(memory_budget),
+      min_bound_(Eigen::Vector3d::Constant(
+              std::numeric_limits<double>::infinity())),
+      max_bound_(Eigen::Vector3d::Constant(
+              -std::numeric_limits<double>::infinity())) {
+    if (tile_size <= 0.0) {
+        utility::LogError(
+                "[TiledPointCloudWriter] tile_size must be positive.");
+    }
+    if (!utility::filesystem::DirectoryExists(directory) &&
+        !utility::filesystem::MakeDirectoryHierarchy(directory)) {
+        utility::LogError("[TiledPointCloudWriter] Cannot create {}.",
+                          directory);
+    }
+}
+
+TiledPointCloudWriter::~TiledPointCloudWriter() {}
+
+void TiledPointCloudWriter::AddPoints(const PointCloud &cloud) {
+    if (closed_) {
+        utility::LogError("[TiledPointCloudWriter] The writer is closed.");
+    }
+    if (cloud.IsEmpty()) {
+        return;
+    }
+    if (cloud.HasNormals() != has_normals_ ||
+        cloud.HasColors() != has_colors_) {
+        utility::LogError(
+                "[TiledPointCloudWriter] The normals and colors of the points "
+                "do not match those of the tiled point cloud.");
+    }
+    const int64_t record_bytes =
+            GetRecordSize(has_normals_, has_colors_) * sizeof(double);
+    for (size_t i = 0; i < cloud.points_.size(); i++) {
+        const Eigen::Vector3d &point = cloud.points_[i];
+        std::vector<double> &buffer =
+                buffers_[GetTileIndex(point, tile_size_)];
+        buffer.insert(buffer.end(), point.data(), point.data() + 3);
+        if (has_normals_) {
+            const double *normal = cloud.normals_[i].data();
+            buffer.insert(buffer.end(), normal, normal + 3);
+        }
+        if (has_colors_) {
+            const double *color = cloud.colors_[i].data();
+            buffer.insert(buffer.end(), color, color + 3);
+        }
+        min_bound_ = min_bound_.cwiseMin(point);
+        max_bound_ = max_bound_.cwiseMax(point);
+        num_buffered_++;
+        if (num_buffered_ * record_bytes >= memory_budget_) {
+            Flush();
+        }
+    }
+}
+
+void TiledPointCloudWriter::Flush() {
+    const int record_size = GetRecordSize(has_normals_, has_colors_);
+    for (const auto &tile : buffers_) {
+        int64_t &num_written = num_written_[tile.first];
+        const std::string file_name = GetTileFileName(directory_, tile.first);
+        // The first write of a tile truncates files left by an older cloud.
+        FILE *file = utility::filesystem::FOpen(file_name,
+                                                num_written == 0 ? "wb" : "ab");
+        if (file == nullptr) {
+            utility::LogError("[TiledPointCloudWriter] Cannot write {}.",
+                              file_name);
+        }
+        size_t count = fwrite(tile.second.data(), sizeof(double),
+                              tile.second.size(), file);
+        fclose(file);
+        if (count != tile.second.size()) {
+            utility::LogError("[TiledPointCloudWriter] Cannot write {}.",
+                              file_name);
+        }
+        num_written += int64_t(tile.second.size()) / record_size;
+    }
+    // Clearing the map also releases the buffers.
+    buffers_.clear();
+    num_buffered_ = 0;
+}
+
+std::shared_ptr<TiledPointCloud> TiledPointCloudWriter::Close() {
+    if (closed_) {
+        utility::LogError("[TiledPointCloudWriter] The writer is closed.");
+    }
+    Flush();
+    closed_ = true;
+
+    std::vector<Eigen::Vector3i> indices;
+    for (const auto &tile : num_written_) {
+        indices.push_back(tile.first);
+    }
+    std::sort(indices.begin(), indices.end(), IndexLess);
+    Json::Value root;
+    root["version"] = 1;
+    root["tile_size"] = tile_size_;
+    root["has_normals"] = has_normals_;
+    root["has_colors"] = has_colors_;
+    const bool empty = indices.empty();
+    root["min_bound"] =
+            Vector3dToJson(empty ? Eigen::Vector3d::Zero() : min_bound_);
+    root["max_bound"] =
+            Vector3dToJson(empty ? Eigen::Vector3d::Zero() : max_bound_);
+    Json::Value &tiles = root["tiles"];
+    tiles = Json::Value(Json::arrayValue);
+    for (const Eigen::Vector3i &index : indices) {
+        Json::Value tile;
+        for (int i = 0; i < 3; i++) {
+            tile["index"].append(index(i));
+        }
+        tile["num_points"] = Json::Int64(num_written_[index]);
+        tiles.append(tile);
+    }
+    const std::string file_name = directory_ + "/" + kIndexFileName;
+    std::ofstream file_out(file_name);
+    if (!file_out.is_open()) {
+        utility::LogError("[TiledPointCloudWriter] Cannot write {}.",
+                          file_name);
+    }
+    Json::StreamWriterBuilder builder;
+    builder["commentStyle"] = "None";
+    builder["indentation"] = "\t";
+    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+    writer->write(root, &file_out);
+    file_out.close();
+    return std::make_shared<TiledPointCloud>(directory_, memory_budget_);
+}
+
+TiledPointCloud::TiledPointCloud(
+        const std::string &directory,
+        int64_t memory_budget /* = int64_t(256) << 20 */)
+    : directory_(directory), memory_budget_(memory_budget) {
+    const std::string file_name = directory + "/" + kIndexFileName;
+    std::ifstream file_in(file_name);
+    if (!file_in.is_open()) {
+        utility::LogError("[TiledPointCloud] Cannot open {}.", file_name);
+    }
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    builder["collectComments"] = false;
+    JSONCPP_STRING errs;
+    if (!Json::parseFromStream(builder, file_in, &root, &errs)) {
+        utility::LogError("[TiledPointCloud] Cannot parse {}: {}", file_name,
+                          errs);
+    }
+    if (root.get("version", 0).asInt() != 1) {
+        utility::LogError("[TiledPointCloud] Unsupported version of {}.",
+                          file_name);
+    }
+    tile_size_ = root["tile_size"].asDouble();
+    has_normals_ = root["has_normals"].asBool();
+    has_colors_ = root["has_colors"].asBool();
+    for (int i = 0; i < 3; i++) {
+        min_bound_(i) = root["min_bound"][i].asDouble();
+        max_bound_(i) = root["max_bound"][i].asDouble();
+    }
+    for (const Json::Value &tile : root["tiles"]) {
+        Tile t;
+        for (int i = 0; i < 3; i++) {
+            t.index_(i) = tile["index"][i].asInt();
+        }
+        t.num_points_ = tile["num_points"].asInt64();
+        tile_positions_[t.index_] = tiles_.size();
+        tiles_.push_back(t);
+    }
+}
+
+int64_t TiledPointCloud::GetNumPoints() const {
+    int64_t num_points = 0;
+    for (const Tile &tile : tiles_) {
+        num_points += tile.num_points_;
+    }
+    return num_points;
+}
+
+std::string TiledPointCloud::GetTileFileName(
+        const Eigen::Vector3i &index) const {
+    return open3d::GetTileFileName(directory_, index);
+}
+
+void TiledPointCloud::ReadTileInBox(size_t tile,
+                                    const Eigen::Vector3d &min_bound,
+                                    const Eigen::Vector3d &max_bound,
+                                    PointCloud &cloud) const {
+    const int record_size = GetRecordSize(has_normals_, has_colors_);
+    const int64_t num_points = tiles_[tile].num_points_;
+    utility::MappedFile file(GetTileFileName(tiles_[tile].index_));
+    if (file.GetSize() != num_points * record_size * int64_t(sizeof(double))) {
+        utility::LogError("[TiledPointCloud] {} does not hold {:d} points.",
+                          file.GetFileName(), num_points);
+    }
+    const double *record = reinterpret_cast<const double *>(file.GetData());
+    for (int64_t i = 0; i < num_points; i++, record += record_size) {
+        Eigen::Map<const Eigen::Vector3d> point(record);
+        if ((point.array() < min_bound.array()).any() ||
+            (point.array() > max_bound.array()).any()) {
+            continue;
+        }
+        cloud.points_.push_back(point);
+        if (has_normals_) {
+            cloud.normals_.emplace_back(record[3], record[4], record[5]);
+        }
+        if (has_colors_) {
+            const double *color = record + (has_normals_ ? 6 : 3);
+            cloud.colors_.emplace_back(color[0], color[1], color[2]);
+        }
+    }
+}
+
+std::shared_ptr<PointCloud> TiledPointCloud::ReadTile(size_t tile) const {
+    if (tile >= tiles_.size()) {
+        utility::LogError("[TiledPointCloud] Tile {:d} does not exist.", tile);
+    }
+    auto cloud = std::make_shared<PointCloud>();
+    const size_t num_points = size_t(tiles_[tile].num_points_);
+    cloud->points_.reserve(num_points);
+    cloud->normals_.reserve(has_normals_ ? num_points : 0);
+    cloud->colors_.reserve(has_colors_ ? num_points : 0);
+    const double inf = std::numeric_limits<double>::infinity();
+    ReadTileInBox(tile, Eigen::Vector3d::Constant(-inf),
+                  Eigen::Vector3d::Constant(inf), *cloud);
+    return cloud;
+}
+
+std::shared_ptr<PointCloud> TiledPointCloud::ReadTileWithHalo(
+        size_t tile, double halo) const {
+    if (halo < 0.0) {
+        utility::LogError("[TiledPointCloud] halo must not be negative.");
+    }
+    auto cloud = ReadTile(tile);
+    const Eigen::Vector3i &index = tiles_[tile].index_;
+    const Eigen::Vector3d min_bound =
+            index.cast<double>() * tile_size_ - Eigen::Vector3d::Constant(halo);
+    const Eigen::Vector3d max_bound =
+            (index.cast<double>() + Eigen::Vector3d::Ones()) * tile_size_ +
+            Eigen::Vector3d::Constant(halo);
+    const int rings = int(std::ceil(halo / tile_size_));
+    for (int dz = -rings; dz <= rings; dz++) {
+        for (int dy = -rings; dy <= rings; dy++) {
+            for (int dx = -rings; dx <= rings; dx++) {
+                if (dx == 0 && dy == 0 && dz == 0) {
+                    continue;
+                }
+                auto neighbor = tile_positions_.find(
+                        index + Eigen::Vector3i(dx, dy, dz));
+                if (neighbor != tile_positions_.end()) {
+                    ReadTileInBox(neighbor->second, min_bound, max_bound,
+                                  *cloud);
+                }
+            }
+        }
+    }
+    return cloud;
+}
+
+std::shared_ptr<PointCloud> TiledPointCloud::ReadPointCloud() const {
+    auto cloud = std::make_shared<PointCloud>();
+    const double inf = std::numeric_limits<double>::infinity();
+    for (size_t tile = 0; tile < tiles_.size(); tile++) {
+        ReadTileInBox(tile, Eigen::Vector3d::Constant(-inf),
+                      Eigen::Vector3d::Constant(inf), *cloud);
+    }
+    return cloud;
+}
+
+std::shared_ptr<TiledPointCloud> TiledPointCloud::VoxelDownSample(
+        double voxel_size, const std::string &output_directory) const {
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VoxelDownSample] voxel_size <= 0.");
+    }
+    if (IsSameDirectory(output_directory, directory_)) {
+        utility::LogError(
+                "[VoxelDownSample] The output must go to another directory.");
+    }
+    // The grid of PointCloud::VoxelDownSample() on the whole cloud.
+    const Eigen::Vector3d voxel_min_bound =
+            min_bound_ - Eigen::Vector3d::Constant(voxel_size * 0.5);
+    const Eigen::Vector3d voxel_max_bound =
+            max_bound_ + Eigen::Vector3d::Constant(voxel_size * 0.5);
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::LogError("[VoxelDownSample] voxel_size is too small.");
+    }
+    TiledPointCloudWriter writer(output_directory, tile_size_, has_normals_,
+                                 has_colors_, memory_budget_);
+    for (size_t tile = 0; tile < tiles_.size(); tile++) {
+        // The halo holds every point of the voxels having a point in the
+        // tile.
+        auto cloud = ReadTileWithHalo(tile, voxel_size);
+        const int64_t num_points = int64_t(cloud->points_.size());
+        std::vector<Eigen::Vector3i> voxels(num_points);
+        for (int64_t i = 0; i < num_points; i++) {
+            Eigen::Vector3d ref_coord =
+                    (cloud->points_[i] - voxel_min_bound) / voxel_size;
+            voxels[i] = ref_coord.array().floor().cast<int>();
+        }
+        std::vector<int64_t> order(num_points);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&](int64_t a, int64_t b) {
+                             return IndexLess(voxels[a], voxels[b]);
+                         });
+        PointCloud output;
+        for (int64_t begin = 0, end = 0; begin < num_points; begin = end) {
+            end = begin + 1;
+            while (end < num_points &&
+                   voxels[order[end]] == voxels[order[begin]]) {
+                end++;
+            }
+            // The voxel goes to the first tile holding one of its points.
+            Eigen::Vector3i owner =
+                    GetTileIndex(cloud->points_[order[begin]], tile_size_);
+            for (int64_t k = begin + 1; k < end; k++) {
+                Eigen::Vector3i index =
+                        GetTileIndex(cloud->points_[order[k]], tile_size_);
+                if (IndexLess(index, owner)) {
+                    owner = index;
+                }
+            }
+            if (owner != tiles_[tile].index_) {
+                continue;
+            }
+            Eigen::Vector3d point = Eigen::Vector3d::Zero();
+            Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+            Eigen::Vector3d color = Eigen::Vector3d::Zero();
+            for (int64_t k = begin; k < end; k++) {
+                point += cloud->points_[order[k]];
+                if (has_normals_ && !cloud->normals_[order[k]].hasNaN()) {
+                    normal += cloud->normals_[order[k]];
+                }
+                if (has_colors_) {
+                    color += cloud->colors_[order[k]];
+                }
+            }
+            output.points_.push_back(point / double(end - begin));
+            if (has_normals_) {
+                output.normals_.push_back(normal.normalized());
+            }
+            if (has_colors_) {
+                output.colors_.push_back(color / double(end - begin));
+            }
+        }
+        writer.AddPoints(output);
+    }
+    return writer.Close();
+}
+
+template <typename BoundingBox>
+std::shared_ptr<TiledPointCloud> TiledPointCloud::CropImpl(
+        const BoundingBox &bbox, const std::string &output_directory) const {
+    if (IsSameDirectory(output_directory, directory_)) {
+        utility::LogError("[Crop] The output must go to another directory.");
+    }
+    const AxisAlignedBoundingBox box = bbox.GetAxisAlignedBoundingBox();
+    TiledPointCloudWriter writer(output_directory, tile_size_, has_normals_,
+                                 has_colors_, memory_budget_);
+    for (size_t tile = 0; tile < tiles_.size(); tile++) {
+        const Eigen::Vector3d min_bound =
+                tiles_[tile].index_.cast<double>() * tile_size_;
+        const Eigen::Vector3d max_bound =
+                min_bound + Eigen::Vector3d::Constant(tile_size_);
+        if ((max_bound.array() < box.min_bound_.array()).any() ||
+            (min_bound.array() > box.max_bound_.array()).any()) {
+            continue;
+        }
+        writer.AddPoints(*ReadTile(tile)->Crop(bbox));
+    }
+    return writer.Close();
+}
+
+std::shared_ptr<TiledPointCloud> TiledPointCloud::Crop(
+        const AxisAlignedBoundingBox &bbox,
+        const std::string &output_directory) const {
+    return CropImpl(bbox, output_directory);
+}
+
+std::shared_ptr<TiledPointCloud> TiledPointCloud::Crop(
+        const OrientedBoundingBox &bbox,
+        const std::string &output_directory) const {
+    return CropImpl(bbox, output_directory);
+}
+
+std::shared_ptr<TiledPointCloud> TiledPointCloud::RemoveStatisticalOutliers(
+        size_t nb_neighbors,
+        double std_ratio,
+        double halo,
+        const std::string &output_directory) const {
+    if (nb_neighbors < 1 || std_ratio <= 0) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] Illegal input parameters, number "
+                "of neighbors and standard deviation ratio must be positive");
+    }
+    if (IsSameDirectory(output_directory, directory_)) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] The output must go to another "
+                "directory.");
+    }
+    TiledPointCloudWriter writer(output_directory, tile_size_, has_normals_,
+                                 has_colors_, memory_budget_);
+    // The average distances of each tile are spilled next to the output, as
+    // the statistics of the whole cloud are needed before filtering.
+    auto distance_file_name = [&](size_t tile) {
+        return open3d::GetTileFileName(output_directory, tiles_[tile].index_) +
+               ".dist";
+    };
+    // Sums follow PointCloud::RemoveStatisticalOutliers(), which leaves
+    // points at a zero average distance out of the sums but not the count.
+    int64_t valid_distances = 0;
+    double sum = 0.0;
+    for (size_t tile = 0; tile < tiles_.size(); tile++) {
+        auto cloud = ReadTileWithHalo(tile, halo);
+        const int64_t num_points = tiles_[tile].num_points_;
+        KDTreeFlann kdtree;
+        kdtree.SetGeometry(*cloud);
+        std::vector<double> avg_distances(num_points);
+        kdtree.SearchBatchInBlocks(
+                Eigen::Map<const Eigen::MatrixXd>(
+                        (const double *)cloud->points_.data(), 3, num_points),
+                KDTreeSearchParamKNN(int(nb_neighbors)),
+                [&](int64_t begin, int64_t end,
+                    const KDTreeSearchResult &result) {
+                    for (int64_t i = begin; i < end; i++) {
+                        const int num_neighbors =
+                                result.NumNeighbors(i - begin);
+                        const double *dist = result.Distance2(i - begin);
+                        double mean = -1.0;
+                        if (num_neighbors > 0) {
+                            valid_distances++;
+                            double distance_sum = 0.0;
+                            for (int k = 0; k < num_neighbors; k++) {
+                                distance_sum += std::sqrt(dist[k]);
+                            }
+                            mean = distance_sum / num_neighbors;
+                        }
+                        avg_distances[i] = mean;
+                    }
+                });
+        for (double d : avg_distances) {
+            sum += d > 0 ? d : 0.0;
+        }
+        const std::string file_name = distance_file_name(tile);
+        FILE *file = utility::filesystem::FOpen(file_name, "wb");
+        if (file == nullptr ||
+            fwrite(avg_distances.data(), sizeof(double), avg_distances.size(),
+                   file) != avg_distances.size()) {
+            utility::LogError("[RemoveStatisticalOutliers] Cannot write {}.",
+                              file_name);
+        }
+        fclose(file);
+    }
+    double distance_threshold = 0.0;
+    if (valid_distances > 0) {
+        const double cloud_mean = sum / valid_distances;
+        double sq_sum = 0.0;
+        for (size_t tile = 0; tile < tiles_.size(); tile++) {
+            utility::MappedFile file(distance_file_name(tile));
+            const double *avg_distances =
+                    reinterpret_cast<const double *>(file.GetData());
+            for (int64_t i = 0; i < tiles_[tile].num_points_; i++) {
+                const double d = avg_distances[i];
+                sq_sum += d > 0 ? (d - cloud_mean) * (d - cloud_mean) : 0;
+            }
+        }
+        // Bessel's correction
+        double std_dev = std::sqrt(sq_sum / (valid_distances - 1));
+        distance_threshold = cloud_mean + std_ratio * std_dev;
+    }
+    for (size_t tile = 0; tile < tiles_.size(); tile++) {
+        const std::string file_name = distance_file_name(tile);
+        if (valid_distances > 0) {
+            utility::MappedFile file(file_name);
+            const double *avg_distances =
+                    reinterpret_cast<const double *>(file.GetData());
+            std::vector<size_t> indices;
+            for (int64_t i = 0; i < tiles_[tile].num_points_; i++) {
+                if (avg_distances[i] > 0 &&
+                    avg_distances[i] < distance_threshold) {
+                    indices.push_back(size_t(i));
+                }
+            }
+            writer.AddPoints(*ReadTile(tile)->SelectByIndex(indices));
+        }
+        utility::filesystem::RemoveFile(file_name);
+    }
+    return writer.Close();
+}
+
+std::shared_ptr<TiledPointCloud> TiledPointCloud::EstimateNormals(
+        const KDTreeSearchParam &search_param,
+        double halo,
+        const std::string &output_directory,
+        bool fast_normal_computation /* = true */) const {
+    if (IsSameDirectory(output_directory, directory_)) {
+        utility::LogError(
+                "[EstimateNormals] The output must go to another directory.");
+    }
+    TiledPointCloudWriter writer(output_directory, tile_size_, true,
+                                 has_colors_, memory_budget_);
+    for (size_t tile = 0; tile < tiles_.size(); tile++) {
+        auto cloud = ReadTileWithHalo(tile, halo);
+        cloud->EstimateNormals(search_param, fast_normal_computation);
+        // Only the points of the tile are kept; the halo provides their
+        // neighbors.
+        const size_t num_points = size_t(tiles_[tile].num_points_);
+        cloud->points_.resize(num_points);
+        cloud->normals_.resize(num_points);
+        if (has_colors_) {
+            cloud->colors_.resize(num_points);
+        }
+        writer.AddPoints(*cloud);
+    }
+    return writer.Close();
+}
+
+bool TiledPointCloud::Remove(const std::string &directory) {
+    std::vector<std::string> file_names;
+    if (!utility::filesystem::ListFilesInDirectory(directory, file_names)) {
+        return false;
+    }
+    bool success = true;
+    for (const std::string &file_name : file_names) {
+        const std::string name =
+                utility::filesystem::GetFileNameWithoutDirectory(file_name);
+        const bool is_tile =
+                name.compare(0, 5, "tile_") == 0 &&
+                (EndsWith(name, ".bin") || EndsWith(name, ".dist"));
+        if (is_tile || name == kIndexFileName) {
+            success &= utility::filesystem::RemoveFile(file_name);
+        }
+    }
+    file_names.clear();
+    utility::filesystem::ListFilesInDirectory(directory, file_names);
+    if (file_names.empty()) {
+        success &= utility::filesystem::DeleteDirectory(directory);
+    }
+    return success;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,242 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+class AxisAlignedBoundingBox;
+class OrientedBoundingBox;
+class PointCloud;
+class TiledPointCloud;
+
+/// \class TiledPointCloudWriter
+///
+/// \brief Writes a TiledPointCloud from point chunks of any size.
+///
+/// Points are binned into cubic tiles of a fixed grid and buffered in memory.
+/// Whenever the buffers exceed the memory budget, they are appended to the
+/// tile files, so clouds larger than RAM can be written chunk by chunk.
+class TiledPointCloudWriter {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param directory Directory of the tiled point cloud. It is created if
+    /// needed. Tile files of a previous cloud in it are overwritten.
+    /// \param tile_size Edge length of the cubic tiles.
+    /// \param has_normals Whether the points carry normals.
+    /// \param has_colors Whether the points carry colors.
+    /// \param memory_budget Maximum size in bytes of the buffered points.
+    TiledPointCloudWriter(const std::string &directory,
+                          double tile_size,
+                          bool has_normals,
+                          bool has_colors,
+                          int64_t memory_budget = int64_t(256) << 20);
+    ~TiledPointCloudWriter();
+    TiledPointCloudWriter(const TiledPointCloudWriter &) = delete;
+    TiledPointCloudWriter &operator=(const TiledPointCloudWriter &) = delete;
+
+public:
+    /// Adds the points of \p cloud, which must have normals and colors as
+    /// declared in the constructor unless it is empty.
+    void AddPoints(const PointCloud &cloud);
+
+    /// Flushes the buffers, writes the index and returns the finished cloud.
+    /// No points can be added afterwards.
+    std::shared_ptr<TiledPointCloud> Close();
+
+private:
+    void Flush();
+
+    std::string directory_;
+    double tile_size_;
+    bool has_normals_;
+    bool has_colors_;
+    int64_t memory_budget_;
+    bool closed_ = false;
+    /// Records buffered per tile, and number of points in each tile file.
+    std::unordered_map<Eigen::Vector3i,
+                       std::vector<double>,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            buffers_;
+    std::unordered_map<Eigen::Vector3i,
+                       int64_t,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            num_written_;
+    int64_t num_buffered_ = 0;
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+};
+
+/// \class TiledPointCloud
+///
+/// \brief Point cloud stored on disk as a grid of cubic tiles, for clouds
+/// that do not fit in memory.
+///
+/// A directory holds an index.json and one file per non-empty tile, with the
+/// points, normals and colors of the tile as interleaved doubles. Tiles are
+/// read through memory mappings. The processing functions stream the cloud
+/// one tile at a time and write their result as a new tiled cloud, so peak
+/// memory is bounded by the largest tile with its halo plus the memory
+/// budget of the output writer. The halo holds the points of the
+/// neighboring tiles within a margin of the tile, so that neighborhoods of
+/// points near tile borders are complete.
+class TiledPointCloud {
+public:
+    /// A non-empty tile of the grid. Tile (i, j, k) spans
+    /// [i, i + 1) x [j, j + 1) x [k, k + 1) times the tile size.
+    struct Tile {
+        Eigen::Vector3i index_;
+        int64_t num_points_;
+    };
+
+    /// \brief Opens the tiled point cloud in \p directory. Calls LogError if
+    /// its index cannot be read.
+    ///
+    /// \param memory_budget Memory budget in bytes of the writers of the
+    /// processing results.
+    explicit TiledPointCloud(const std::string &directory,
+                             int64_t memory_budget = int64_t(256) << 20);
+
+public:
+    const std::string &GetDirectory() const { return directory_; }
+    double GetTileSize() const { return tile_size_; }
+    bool HasNormals() const { return has_normals_; }
+    bool HasColors() const { return has_colors_; }
+    /// Non-empty tiles, sorted by index.
+    const std::vector<Tile> &GetTiles() const { return tiles_; }
+    int64_t GetNumPoints() const;
+    Eigen::Vector3d GetMinBound() const { return min_bound_; }
+    Eigen::Vector3d GetMaxBound() const { return max_bound_; }
+
+    /// Reads the points of tile \p tile.
+    std::shared_ptr<PointCloud> ReadTile(size_t tile) const;
+
+    /// \brief Reads tile \p tile followed by its halo.
+    ///
+    /// The first GetTiles()[tile].num_points_ points are the points of the
+    /// tile, the others are the points of the neighboring tiles that lie
+    /// within \p halo of the tile along every axis.
+    std::shared_ptr<PointCloud> ReadTileWithHalo(size_t tile,
+                                                 double halo) const;
+
+    /// Reads all tiles into one point cloud, which must fit in memory.
+    std::shared_ptr<PointCloud> ReadPointCloud() const;
+
+    /// \brief Downsamples the cloud into \p output_directory with a voxel
+    /// grid.
+    ///
+    /// Each voxel is replaced by the centroid of its points, as
+    /// PointCloud::VoxelDownSample() with VoxelAggregation::Centroid. The
+    /// voxel grid is anchored at the bounds of the whole cloud, so the result
+    /// is the same as that of the in-memory cloud. A voxel crossing tile
+    /// borders is output once, by the first of the tiles holding its points.
+    std::shared_ptr<TiledPointCloud> VoxelDownSample(
+            double voxel_size, const std::string &output_directory) const;
+
+    /// Writes the points inside \p bbox to \p output_directory. Tiles outside
+    /// of the box are skipped without being read.
+    std::shared_ptr<TiledPointCloud> Crop(
+            const AxisAlignedBoundingBox &bbox,
+            const std::string &output_directory) const;
+
+    /// Writes the points inside \p bbox to \p output_directory. Tiles outside
+    /// of the box are skipped without being read.
+    std::shared_ptr<TiledPointCloud> Crop(
+            const OrientedBoundingBox &bbox,
+            const std::string &output_directory) const;
+
+    /// \brief Writes the points kept by
+    /// PointCloud::RemoveStatisticalOutliers() to \p output_directory.
+    ///
+    /// The average neighbor distances are computed tile by tile and spilled
+    /// to disk, then the points are filtered with the statistics of the whole
+    /// cloud.
+    ///
+    /// \param halo The result equals the in-memory one if the \p nb_neighbors
+    /// nearest neighbors of every point are within \p halo of it.
+    std::shared_ptr<TiledPointCloud> RemoveStatisticalOutliers(
+            size_t nb_neighbors,
+            double std_ratio,
+            double halo,
+            const std::string &output_directory) const;
+
+    /// \brief Writes the cloud with normals estimated by
+    /// PointCloud::EstimateNormals() to \p output_directory.
+    ///
+    /// \param halo The result equals the in-memory one if the neighborhoods
+    /// of \p search_param are within \p halo of their points, e.g. if
+    /// \p halo is the radius of a radius search.
+    std::shared_ptr<TiledPointCloud> EstimateNormals(
+            const KDTreeSearchParam &search_param,
+            double halo,
+            const std::string &output_directory,
+            bool fast_normal_computation = true) const;
+
+    /// Removes the files of the tiled point cloud in \p directory, and the
+    /// directory if it is then empty.
+    static bool Remove(const std::string &directory);
+
+private:
+    std::string GetTileFileName(const Eigen::Vector3i &index) const;
+    /// Appends the points of tile \p tile within [min_bound, max_bound] to
+    /// \p cloud.
+    void ReadTileInBox(size_t tile,
+                       const Eigen::Vector3d &min_bound,
+                       const Eigen::Vector3d &max_bound,
+                       PointCloud &cloud) const;
+    template <typename BoundingBox>
+    std::shared_ptr<TiledPointCloud> CropImpl(
+            const BoundingBox &bbox, const std::string &output_directory) const;
+
+    std::string directory_;
+    int64_t memory_budget_;
+    double tile_size_ = 0.0;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+    Eigen::Vector3d min_bound_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d max_bound_ = Eigen::Vector3d::Zero();
+    std::vector<Tile> tiles_;
+    /// Position of each tile in tiles_.
+    std::unordered_map<Eigen::Vector3i,
+                       size_t,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            tile_positions_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -32,6 +32,7 @@
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/KDTreeSearchParam.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/ICPEngine.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
 
@@ -154,22 +155,21 @@ Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
 
     const auto &target_c = (const PointCloudForColoredICP &)target;
 
-    auto compute_jacobian_and_residual =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) = utility::ComputeWeightedJTJandJTr<2>(
+            [&](int64_t i, Eigen::Matrix<double, 6, 2> &J_r,
+                Eigen::Vector2d &r, Eigen::Vector2d &w) {
                 size_t cs = corres[i][0];
                 size_t ct = corres[i][1];
                 const Eigen::Vector3d &vs = source.points_[cs];
                 const Eigen::Vector3d &vt = target.points_[ct];
                 const Eigen::Vector3d &nt = target.normals_[ct];
 
-                J_r.resize(2);
-                r.resize(2);
-
-                J_r[0].block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
-                J_r[0].block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
-                r[0] = sqrt_lambda_geometric * (vs - vt).dot(nt);
+                J_r.block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
+                J_r.block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
+                r(0) = sqrt_lambda_geometric * (vs - vt).dot(nt);
 
                 // project vs into vt's tangential plane
                 Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
@@ -190,18 +190,13 @@ Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
                                 .finished();
 
                 const Eigen::Vector3d &ditM = -dit.transpose() * M;
-                J_r[1].block<3, 1>(0, 0) =
+                J_r.block<3, 1>(0, 1) =
                         sqrt_lambda_photometric * vs.cross(ditM);
-                J_r[1].block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
-                r[1] = sqrt_lambda_photometric * (is - is0_proj);
-            };
-
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
+                J_r.block<3, 1>(3, 1) = sqrt_lambda_photometric * ditM;
+                r(1) = sqrt_lambda_photometric * (is - is0_proj);
+                w.setOnes();
+            },
+            int64_t(corres.size()));
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
@@ -255,10 +250,37 @@ RegistrationResult RegistrationColoredICP(
         const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
         const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
         double lambda_geometric /* = 0.968*/) {
-    auto target_c = InitializePointCloudForColoredICP(
+    ICPEngine engine(CreateTargetForColoredICP(target, max_distance));
+    return RegistrationColoredICP(source, engine, max_distance, init, criteria,
+                                  lambda_geometric);
+}
+
+std::shared_ptr<geometry::PointCloud> CreateTargetForColoredICP(
+        const geometry::PointCloud &target, double max_distance) {
+    if (!target.HasNormals() || !target.HasColors()) {
+        utility::LogError(
+                "[CreateTargetForColoredICP] Target point cloud requires "
+                "normals and colors.");
+    }
+    return InitializePointCloudForColoredICP(
             target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
-    return RegistrationICP(
-            source, *target_c, max_distance, init,
+}
+
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        ICPEngine &engine,
+        double max_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
+        double lambda_geometric /* = 0.968*/) {
+    if (dynamic_cast<const PointCloudForColoredICP *>(&engine.GetTarget()) ==
+        nullptr) {
+        utility::LogError(
+                "[RegistrationColoredICP] The engine target must be created "
+                "by CreateTargetForColoredICP().");
+    }
+    return engine.Register(
+            source, max_distance, init,
             TransformationEstimationForColoredICP(lambda_geometric), criteria);
 }
 
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 
 #include "Open3D/Registration/Registration.h"
 
@@ -38,6 +39,7 @@ class PointCloud;
 
 namespace registration {
 class RegistrationResult;
+class ICPEngine;
 
 /// \brief Function for Colored ICP registration.
 ///
@@ -60,5 +62,34 @@ RegistrationResult RegistrationColoredICP(
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
         double lambda_geometric = 0.968);
 
+/// \brief Prepares a target for colored ICP.
+///
+/// Returns a copy of \p target that also holds the color gradient of every
+/// point, estimated within 2 * \p max_distance. Build an ICPEngine on it to
+/// run colored ICP against the same target many times.
+///
+/// \param target The target point cloud, with normals and colors.
+/// \param max_distance Maximum correspondence points-pair distance of the
+/// registrations that will use the target.
+std::shared_ptr<geometry::PointCloud> CreateTargetForColoredICP(
+        const geometry::PointCloud &target, double max_distance);
+
+/// \brief Function for Colored ICP registration against the target of
+/// \p engine, which must come from CreateTargetForColoredICP().
+///
+/// \param source The source point cloud.
+/// \param engine ICP engine of the prepared target.
+/// \param max_distance Maximum correspondence points-pair distance.
+/// \param init Initial transformation estimation.
+/// \param criteria Convergence criteria.
+/// \param lambda_geometric lambda_geometric value.
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        ICPEngine &engine,
+        double max_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        double lambda_geometric = 0.968);
+
 }  // namespace registration
 }  // namespace open3d
@@ -28,9 +28,11 @@
 
 #include <Eigen/Dense>
 
+#include "Open3D/Geometry/HashGridSearch.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 
@@ -71,43 +73,97 @@ Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
+/// Views the points of \p input as the columns of a 3 x N matrix.
+Eigen::Map<const Eigen::MatrixXd> PointsAsMatrix(
+        const geometry::PointCloud &input) {
+    return Eigen::Map<const Eigen::MatrixXd>(
+            (const double *)input.points_.data(), 3, input.points_.size());
+}
+
+template <typename NeighborSearch>
 std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
+        const NeighborSearch &search,
         const geometry::KDTreeSearchParam &search_param) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself, compute histogram
-                auto pf = ComputePairFeatures(point, normal,
-                                              input.points_[indices[k]],
-                                              input.normals_[indices[k]]);
-                int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 11, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 22, i) += hist_incr;
-            }
-        }
-    }
+    search.SearchBatchInBlocks(
+            PointsAsMatrix(input), search_param,
+            [&](int64_t begin, int64_t end,
+                const geometry::KDTreeSearchResult &result) {
+                utility::ParallelForEach(begin, end, [&](int64_t i) {
+                    const int num_neighbors = result.NumNeighbors(i - begin);
+                    // only compute SPFH feature when a point has neighbors
+                    if (num_neighbors <= 1) return;
+                    const int *indices = result.Indices(i - begin);
+                    const auto &point = input.points_[i];
+                    const auto &normal = input.normals_[i];
+                    double hist_incr = 100.0 / (double)(num_neighbors - 1);
+                    for (int k = 1; k < num_neighbors; k++) {
+                        // skip the point itself, compute histogram
+                        auto pf = ComputePairFeatures(
+                                point, normal, input.points_[indices[k]],
+                                input.normals_[indices[k]]);
+                        int h_index = (int)(floor(11 * (pf(0) + M_PI) /
+                                                  (2.0 * M_PI)));
+                        if (h_index < 0) h_index = 0;
+                        if (h_index >= 11) h_index = 10;
+                        feature->data_(h_index, i) += hist_incr;
+                        h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
+                        if (h_index < 0) h_index = 0;
+                        if (h_index >= 11) h_index = 10;
+                        feature->data_(h_index + 11, i) += hist_incr;
+                        h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
+                        if (h_index < 0) h_index = 0;
+                        if (h_index >= 11) h_index = 10;
+                        feature->data_(h_index + 22, i) += hist_incr;
+                    }
+                });
+            });
+    return feature;
+}
+
+template <typename NeighborSearch>
+std::shared_ptr<Feature> ComputeFPFHFeatureImpl(
+        const geometry::PointCloud &input,
+        const NeighborSearch &search,
+        const geometry::KDTreeSearchParam &search_param) {
+    auto feature = std::make_shared<Feature>();
+    feature->Resize(33, (int)input.points_.size());
+    auto spfh = ComputeSPFHFeature(input, search, search_param);
+    search.SearchBatchInBlocks(
+            PointsAsMatrix(input), search_param,
+            [&](int64_t begin, int64_t end,
+                const geometry::KDTreeSearchResult &result) {
+                utility::ParallelForEach(begin, end, [&](int64_t i) {
+                    const int num_neighbors = result.NumNeighbors(i - begin);
+                    if (num_neighbors <= 1) return;
+                    const int *indices = result.Indices(i - begin);
+                    const double *distance2 = result.Distance2(i - begin);
+                    double sum[3] = {0.0, 0.0, 0.0};
+                    for (int k = 1; k < num_neighbors; k++) {
+                        // skip the point itself
+                        double dist = distance2[k];
+                        if (dist == 0.0) continue;
+                        for (int j = 0; j < 33; j++) {
+                            double val = spfh->data_(j, indices[k]) / dist;
+                            sum[j / 11] += val;
+                            feature->data_(j, i) += val;
+                        }
+                    }
+                    for (int j = 0; j < 3; j++)
+                        if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
+                    for (int j = 0; j < 33; j++) {
+                        feature->data_(j, i) *= sum[j / 11];
+                        // The commented line is the fpfh function in the
+                        // paper. But according to PCL implementation, it is
+                        // skipped. Our initial test shows that the full fpfh
+                        // function in the paper seems to be better than PCL
+                        // implementation. Further test required.
+                        feature->data_(j, i) += spfh->data_(j, i);
+                    }
+                });
+            });
     return feature;
 }
 
@@ -117,49 +173,100 @@ namespace registration {
 std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
-                &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
-    auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
+                &search_param /* = geometry::KDTreeSearchParamKNN()*/,
+        geometry::NeighborSearchBackend
+                backend /* = geometry::NeighborSearchBackend::KDTree*/) {
     if (input.HasNormals() == false) {
         utility::LogError(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
                 "normal.");
     }
-    geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself
-                double dist = distance2[k];
-                if (dist == 0.0) continue;
-                for (int j = 0; j < 33; j++) {
-                    double val = spfh->data_(j, indices[k]) / dist;
-                    sum[j / 11] += val;
-                    feature->data_(j, i) += val;
-                }
-            }
-            for (int j = 0; j < 3; j++)
-                if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
-            for (int j = 0; j < 33; j++) {
-                feature->data_(j, i) *= sum[j / 11];
-                // The commented line is the fpfh function in the paper.
-                // But according to PCL implementation, it is skipped.
-                // Our initial test shows that the full fpfh function in the
-                // paper seems to be better than PCL implementation. Further
-                // test required.
-                feature->data_(j, i) += spfh->data_(j, i);
+    if (backend == geometry::NeighborSearchBackend::HashGrid) {
+        switch (search_param.GetSearchType()) {
+            case geometry::KDTreeSearchParam::SearchType::Radius:
+                return ComputeFPFHFeatureImpl(
+                        input,
+                        geometry::HashGridSearch(
+                                input.points_,
+                                ((const geometry::KDTreeSearchParamRadius &)
+                                         search_param)
+                                        .radius_),
+                        search_param);
+            case geometry::KDTreeSearchParam::SearchType::Hybrid:
+                return ComputeFPFHFeatureImpl(
+                        input,
+                        geometry::HashGridSearch(
+                                input.points_,
+                                ((const geometry::KDTreeSearchParamHybrid &)
+                                         search_param)
+                                        .radius_),
+                        search_param);
+            default:
+                utility::LogWarning(
+                        "[ComputeFPFHFeature] The hash grid does not support "
+                        "KNN search, using a KDTree.");
+        }
+    }
+    return ComputeFPFHFeatureImpl(input, geometry::KDTreeFlann(input),
+                                  search_param);
+}
+
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_features,
+        const Feature &target_features,
+        bool mutual_filter /* = false*/,
+        double ratio_test /* = 1.0*/) {
+    if (source_features.Dimension() != target_features.Dimension()) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Feature dimensions {:d} and "
+                "{:d} do not match.",
+                source_features.Dimension(), target_features.Dimension());
+    }
+    const int64_t num_source = int64_t(source_features.Num());
+    if (num_source == 0 || target_features.Num() == 0) {
+        return CorrespondenceSet();
+    }
+
+    const bool use_ratio_test = ratio_test < 1.0;
+    const double ratio2 = ratio_test * ratio_test;
+    geometry::KDTreeFlann target_kdtree(target_features);
+    geometry::KDTreeSearchResult result;
+    target_kdtree.SearchKNNBatch(source_features.data_, use_ratio_test ? 2 : 1,
+                                 result);
+
+    // -1 marks a rejected source feature.
+    std::vector<int> matches(num_source, -1);
+    utility::ParallelForEach(0, num_source, [&](int64_t i) {
+        const int num_neighbors = result.NumNeighbors(i);
+        if (num_neighbors == 0) return;
+        const double *distance2 = result.Distance2(i);
+        if (use_ratio_test && num_neighbors > 1 &&
+            distance2[0] >= ratio2 * distance2[1]) {
+            return;
+        }
+        matches[i] = result.Indices(i)[0];
+    });
+
+    if (mutual_filter) {
+        geometry::KDTreeFlann source_kdtree(source_features);
+        source_kdtree.SearchKNNBatch(target_features.data_, 1, result);
+        utility::ParallelForEach(0, num_source, [&](int64_t i) {
+            const int j = matches[i];
+            if (j < 0) return;
+            if (result.NumNeighbors(j) == 0 || result.Indices(j)[0] != i) {
+                matches[i] = -1;
             }
+        });
+    }
+
+    CorrespondenceSet corres;
+    corres.reserve(num_source);
+    for (int64_t i = 0; i < num_source; i++) {
+        if (matches[i] >= 0) {
+            corres.push_back(Eigen::Vector2i(int(i), matches[i]));
         }
     }
-    return feature;
+    return corres;
 }
 
 }  // namespace registration
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Registration/TransformationEstimation.h"
 
 namespace open3d {
 
@@ -67,10 +68,33 @@ public:
 ///
 /// \param input The Input point cloud.
 /// \param search_param KDTree KNN search parameter.
+/// \param backend Spatial index used for the neighbor search. The hash grid
+/// only supports radius and hybrid parameters; KNN parameters always use the
+/// KDTree.
 std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam &search_param =
-                geometry::KDTreeSearchParamKNN());
+                geometry::KDTreeSearchParamKNN(),
+        geometry::NeighborSearchBackend backend =
+                geometry::NeighborSearchBackend::KDTree);
+
+/// \brief Matches every source feature to its nearest target feature.
+///
+/// All source features are searched in one batched, parallel pass over a
+/// single KDTree built on \p target_features. Returns (source, target) index
+/// pairs ordered by source index.
+///
+/// \param source_features Features of the source point cloud.
+/// \param target_features Features of the target point cloud.
+/// \param mutual_filter If true, only keeps a match if the source feature is
+/// also the nearest neighbor of the target feature.
+/// \param ratio_test Keeps a match only if its feature distance is below
+/// `ratio_test` times the distance to the second nearest target feature.
+/// Values of 1 or greater disable the test.
+CorrespondenceSet CorrespondencesFromFeatures(const Feature &source_features,
+                                              const Feature &target_features,
+                                              bool mutual_filter = false,
+                                              double ratio_test = 1.0);
 
 }  // namespace registration
 }  // namespace open3d
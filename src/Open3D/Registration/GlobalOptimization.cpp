@@ -28,6 +28,8 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
+#include <limits>
 #include <tuple>
 #include <vector>
 
@@ -36,6 +38,7 @@
 #include "Open3D/Registration/PoseGraph.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
 #include "Open3D/Utility/Timer.h"
 
 namespace open3d {
@@ -203,47 +206,270 @@ Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 /// https ://github.com/RainerKuemmerle/g2o/blob/master/doc/g2o.pdf
 /// Eq (20) and Eq (21). (There is a typo in the equation though. B should be J)
 ///
-/// This function focuses the case that every edge has two nodes (not hyper
+/// This class focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
-    int n_nodes = (int)pose_graph.nodes_.size();
-    int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
-
+///
+/// H is block sparse: it has a 6x6 block per node on the diagonal and per
+/// pair of nodes linked by edges, each a sum of terms of these edges. The
+/// sparsity pattern and its symbolic factorization are computed once per
+/// pose graph. Each linearization then computes the terms of the edges in
+/// parallel and sums them into the blocks in parallel, and the system is
+/// solved with a sparse Cholesky factorization under a fill-reducing
+/// ordering. Only the lower triangle of H is stored.
+class BlockSparseLinearSystem {
+public:
+    explicit BlockSparseLinearSystem(const PoseGraph &pose_graph);
+
+    /// Computes H and b at the poses of \p pose_graph, which must have the
+    /// edges of the pose graph of the constructor.
+    void Compute(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta);
+
+    const Eigen::VectorXd &GetB() const { return b_; }
+    double GetMaxDiagonal() const;
+
+    /// Solves (H + lambda I) delta = b.
+    std::tuple<bool, Eigen::VectorXd> Solve(double lambda);
+
+private:
+    /// Terms of an edge: Js^T Info Js, Js^T Info Jt and Jt^T Info Jt, and
+    /// the contributions to b of its source and target nodes.
+    struct EdgeTerms {
+        Eigen::Matrix6d H_ss_;
+        Eigen::Matrix6d H_st_;
+        Eigen::Matrix6d H_tt_;
+        Eigen::Vector6d b_s_;
+        Eigen::Vector6d b_t_;
+    };
+    enum class TermType {
+        SourceSource,
+        SourceTarget,
+        TargetSource,
+        TargetTarget
+    };
+    struct Block {
+        int row_;
+        int col_;
+        /// Position in the values of H of the top-left entry, and distance
+        /// between the values of consecutive columns.
+        int64_t value_offset_;
+        int64_t column_stride_;
+    };
+
+    std::vector<Block> blocks_;
+    /// Terms of block k are block_terms_[block_term_offsets_[k]] to
+    /// block_terms_[block_term_offsets_[k + 1] - 1], as (edge, type) pairs.
+    std::vector<int64_t> block_term_offsets_;
+    std::vector<std::pair<int, TermType>> block_terms_;
+    /// Position in the values of H of each diagonal entry.
+    std::vector<int64_t> diagonal_offsets_;
+    std::vector<EdgeTerms, Eigen::aligned_allocator<EdgeTerms>> edge_terms_;
+    Eigen::SparseMatrix<double> H_;
+    Eigen::SparseMatrix<double> H_LM_;
+    Eigen::VectorXd b_;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>,
+                          Eigen::Lower,
+                          Eigen::AMDOrdering<int>>
+            solver_;
+};
+
+BlockSparseLinearSystem::BlockSparseLinearSystem(const PoseGraph &pose_graph) {
+    const int n_nodes = (int)pose_graph.nodes_.size();
+    const int n_edges = (int)pose_graph.edges_.size();
+
+    // Lists the terms of the blocks in the lower triangle, in column-major
+    // order, with a possibly empty diagonal block for every node.
+    struct Entry {
+        int row_;
+        int col_;
+        int edge_;
+        TermType type_;
+    };
+    std::vector<Entry> entries;
+    entries.reserve(n_nodes + 3 * n_edges);
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        entries.push_back(
+                Entry{iter_node, iter_node, -1, TermType::SourceSource});
+    }
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+        const int s = t.source_node_id_;
+        const int d = t.target_node_id_;
+        entries.push_back(Entry{s, s, iter_edge, TermType::SourceSource});
+        entries.push_back(Entry{d, d, iter_edge, TermType::TargetTarget});
+        if (s > d) {
+            entries.push_back(Entry{s, d, iter_edge, TermType::SourceTarget});
+        } else {
+            entries.push_back(Entry{d, s, iter_edge, TermType::TargetSource});
+        }
+        if (s == d) {
+            entries.push_back(Entry{s, s, iter_edge, TermType::SourceTarget});
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry &a, const Entry &b) {
+                  return std::tie(a.col_, a.row_, a.edge_) <
+                         std::tie(b.col_, b.row_, b.edge_);
+              });
+    for (const Entry &entry : entries) {
+        if (blocks_.empty() || blocks_.back().row_ != entry.row_ ||
+            blocks_.back().col_ != entry.col_) {
+            blocks_.push_back(Block{entry.row_, entry.col_, 0, 0});
+            block_term_offsets_.push_back(int64_t(block_terms_.size()));
+        }
+        if (entry.edge_ >= 0) {
+            block_terms_.emplace_back(entry.edge_, entry.type_);
+        }
+    }
+    block_term_offsets_.push_back(int64_t(block_terms_.size()));
+
+    // Compressed column storage: the columns of block column c hold 6 rows
+    // per block of the column, in the order of the blocks.
+    const int n_rows = n_nodes * 6;
+    H_.resize(n_rows, n_rows);
+    H_.resizeNonZeros(int64_t(blocks_.size()) * 36);
+    int *outer = H_.outerIndexPtr();
+    int *inner = H_.innerIndexPtr();
+    diagonal_offsets_.resize(n_rows);
+    int64_t offset = 0;
+    for (size_t k_begin = 0, k_end = 0; k_begin < blocks_.size();
+         k_begin = k_end) {
+        const int col = blocks_[k_begin].col_;
+        for (k_end = k_begin; k_end < blocks_.size() &&
+                              blocks_[k_end].col_ == col;
+             k_end++) {
+        }
+        const int64_t column_stride = 6 * int64_t(k_end - k_begin);
+        for (int j = 0; j < 6; j++) {
+            outer[col * 6 + j] = int(offset + j * column_stride);
+        }
+        for (size_t k = k_begin; k < k_end; k++) {
+            Block &block = blocks_[k];
+            block.value_offset_ = offset + 6 * int64_t(k - k_begin);
+            block.column_stride_ = column_stride;
+            for (int j = 0; j < 6; j++) {
+                for (int i = 0; i < 6; i++) {
+                    inner[block.value_offset_ + j * column_stride + i] =
+                            block.row_ * 6 + i;
+                }
+            }
+            if (block.row_ == col) {
+                for (int i = 0; i < 6; i++) {
+                    diagonal_offsets_[col * 6 + i] =
+                            block.value_offset_ + i * column_stride + i;
+                }
+            }
+        }
+        offset += 6 * column_stride;
+    }
+    outer[n_rows] = int(offset);
+    std::fill(H_.valuePtr(), H_.valuePtr() + offset, 0.0);
+    H_LM_ = H_;
+    solver_.analyzePattern(H_);
 
-        Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+    edge_terms_.resize(n_edges);
+    b_ = Eigen::VectorXd::Zero(n_rows);
+}
+
+void BlockSparseLinearSystem::Compute(const PoseGraph &pose_graph,
+                                      const Eigen::VectorXd &zeta) {
+    const int n_edges = (int)pose_graph.edges_.size();
+    utility::ParallelFor(0, n_edges, 64, [&](int64_t begin, int64_t end) {
+        for (int64_t iter_edge = begin; iter_edge < end; iter_edge++) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
 
-        Eigen::Matrix6d Js, Jt;
-        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
-        Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
-        Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
-        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
-        double line_process_iter = t.confidence_;
-
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+            Eigen::Matrix4d X_inv, Ts, Tt_inv;
+            std::tie(X_inv, Ts, Tt_inv) =
+                    GetRelativePoses(pose_graph, int(iter_edge));
+
+            Eigen::Matrix6d Js, Jt;
+            std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
+            Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
+            Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
+            Eigen::Vector6d eT_Info = e.transpose() * t.information_;
+            double line_process_iter = t.confidence_;
+
+            EdgeTerms &terms = edge_terms_[iter_edge];
+            terms.H_ss_.noalias() = line_process_iter * JsT_Info * Js;
+            terms.H_st_.noalias() = line_process_iter * JsT_Info * Jt;
+            terms.H_tt_.noalias() = line_process_iter * JtT_Info * Jt;
+            terms.b_s_.noalias() =
+                    -line_process_iter * (eT_Info.transpose() * Js).transpose();
+            terms.b_t_.noalias() =
+                    -line_process_iter * (eT_Info.transpose() * Jt).transpose();
+        }
+    });
+
+    // Blocks are summed independently; b is summed with the diagonal blocks,
+    // which hold the terms of every edge of their node.
+    double *values = H_.valuePtr();
+    utility::ParallelFor(
+            0, int64_t(blocks_.size()), 64, [&](int64_t begin, int64_t end) {
+                for (int64_t k = begin; k < end; k++) {
+                    const Block &block = blocks_[k];
+                    Eigen::Matrix6d H_block = Eigen::Matrix6d::Zero();
+                    Eigen::Vector6d b_block = Eigen::Vector6d::Zero();
+                    for (int64_t p = block_term_offsets_[k];
+                         p < block_term_offsets_[k + 1]; p++) {
+                        const EdgeTerms &terms =
+                                edge_terms_[block_terms_[p].first];
+                        switch (block_terms_[p].second) {
+                            case TermType::SourceSource:
+                                H_block += terms.H_ss_;
+                                b_block += terms.b_s_;
+                                break;
+                            case TermType::SourceTarget:
+                                H_block += terms.H_st_;
+                                break;
+                            case TermType::TargetSource:
+                                H_block += terms.H_st_.transpose();
+                                break;
+                            case TermType::TargetTarget:
+                                H_block += terms.H_tt_;
+                                b_block += terms.b_t_;
+                                break;
+                        }
+                    }
+                    for (int j = 0; j < 6; j++) {
+                        for (int i = 0; i < 6; i++) {
+                            values[block.value_offset_ +
+                                   j * block.column_stride_ + i] =
+                                    H_block(i, j);
+                        }
+                    }
+                    if (block.row_ == block.col_) {
+                        b_.block<6, 1>(block.row_ * 6, 0) = b_block;
+                    }
+                }
+            });
+}
+
+double BlockSparseLinearSystem::GetMaxDiagonal() const {
+    double max_diagonal = -std::numeric_limits<double>::infinity();
+    for (int64_t offset : diagonal_offsets_) {
+        max_diagonal = std::max(max_diagonal, H_.valuePtr()[offset]);
+    }
+    return max_diagonal;
+}
+
+std::tuple<bool, Eigen::VectorXd> BlockSparseLinearSystem::Solve(
+        double lambda) {
+    std::copy(H_.valuePtr(), H_.valuePtr() + H_.nonZeros(),
+              H_LM_.valuePtr());
+    for (int64_t offset : diagonal_offsets_) {
+        H_LM_.valuePtr()[offset] += lambda;
+    }
+    solver_.factorize(H_LM_);
+    if (solver_.info() == Eigen::Success) {
+        Eigen::VectorXd delta = solver_.solve(b_);
+        if (solver_.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(delta));
+        }
     }
-    return std::make_tuple(std::move(H), std::move(b));
+    utility::LogWarning(
+            "[GlobalOptimization] Cholesky factorization failed, the poses "
+            "are not updated.");
+    return std::make_tuple(false, Eigen::VectorXd::Zero(b_.rows()));
 }
 
 Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
@@ -511,11 +737,11 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
+    BlockSparseLinearSystem linear_system(pose_graph);
+    const Eigen::VectorXd &b = linear_system.GetB();
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    linear_system.Compute(pose_graph, zeta);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
@@ -529,13 +755,11 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
+        Eigen::VectorXd delta;
         bool solver_success = false;
 
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        std::tie(solver_success, delta) = linear_system.Solve(0.0);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -558,7 +782,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             x = UpdatePoseVector(pose_graph);
             valid_edges_num = UpdateConfidence(pose_graph, zeta,
                                                line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            linear_system.Compute(pose_graph, zeta);
 
             stop = stop || CheckRightTerm(b, criteria);
             if (stop) break;
@@ -602,16 +826,14 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
+    BlockSparseLinearSystem linear_system(pose_graph);
+    const Eigen::VectorXd &b = linear_system.GetB();
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    linear_system.Compute(pose_graph, zeta);
 
-    Eigen::VectorXd H_diag = H.diagonal();
     double tau = 1e-5;
-    double current_lambda = tau * H_diag.maxCoeff();
+    double current_lambda = tau * linear_system.GetMaxDiagonal();
     double ni = 2.0;
     double rho = 0.0;
 
@@ -629,14 +851,12 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
+            Eigen::VectorXd delta;
             bool solver_success = false;
 
             // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            std::tie(solver_success, delta) =
+                    linear_system.Solve(current_lambda);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -667,7 +887,7 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     x = UpdatePoseVector(pose_graph);
                     valid_edges_num = UpdateConfidence(
                             pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    linear_system.Compute(pose_graph, zeta);
 
                     stop = stop || CheckRightTerm(b, criteria);
                     if (stop) break;
@@ -0,0 +1,197 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/ICPEngine.h"
+
+#include <cmath>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Timer.h"
+
+namespace open3d {
+namespace registration {
+
+namespace {
+
+/// Source points searched per parallel chunk.
+constexpr int64_t kPointsPerChunk = 1024;
+
+}  // unnamed namespace
+
+ICPEngine::ICPEngine(std::shared_ptr<const geometry::PointCloud> target) {
+    SetTarget(std::move(target));
+}
+
+ICPEngine::ICPEngine(const geometry::PointCloud &target)
+    : ICPEngine(std::make_shared<const geometry::PointCloud>(target)) {}
+
+void ICPEngine::SetTarget(std::shared_ptr<const geometry::PointCloud> target) {
+    if (!target) {
+        utility::LogError("[ICPEngine] Target point cloud is null.");
+    }
+    target_ = std::move(target);
+    kdtree_.SetGeometry(*target_);
+}
+
+RegistrationResult ICPEngine::Evaluate(
+        const geometry::PointCloud &source,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d
+                &transformation /* = Eigen::Matrix4d::Identity()*/) {
+    RegistrationResult result(transformation);
+    InitializeSource(source, transformation);
+    ComputeCorrespondences(max_correspondence_distance, result);
+    return result;
+}
+
+RegistrationResult ICPEngine::Register(
+        const geometry::PointCloud &source,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    if ((estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::PointToPlane ||
+         estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::ColoredICP) &&
+        (!source.HasNormals() || !target_->HasNormals())) {
+        utility::LogError(
+                "TransformationEstimationPointToPlane and "
+                "TransformationEstimationColoredICP "
+                "require pre-computed normal vectors.");
+    }
+
+    iteration_info_.clear();
+    ICPIterationInfo info;
+    double start_time = utility::Timer::GetSystemTimeInMilliseconds();
+    RegistrationResult result(init);
+    InitializeSource(source, init);
+    ComputeCorrespondences(max_correspondence_distance, result);
+    info.fitness_ = result.fitness_;
+    info.inlier_rmse_ = result.inlier_rmse_;
+    info.correspondence_time_ =
+            utility::Timer::GetSystemTimeInMilliseconds() - start_time;
+    iteration_info_.push_back(info);
+
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        start_time = utility::Timer::GetSystemTimeInMilliseconds();
+        Eigen::Matrix4d update = estimation.ComputeTransformation(
+                source_, *target_, result.correspondence_set_);
+        result.transformation_ = update * result.transformation_;
+        source_.Transform(update);
+        const double search_start_time =
+                utility::Timer::GetSystemTimeInMilliseconds();
+        const double previous_fitness = result.fitness_;
+        const double previous_rmse = result.inlier_rmse_;
+        ComputeCorrespondences(max_correspondence_distance, result);
+        info.iteration_ = i + 1;
+        info.fitness_ = result.fitness_;
+        info.inlier_rmse_ = result.inlier_rmse_;
+        info.estimation_time_ = search_start_time - start_time;
+        info.correspondence_time_ =
+                utility::Timer::GetSystemTimeInMilliseconds() -
+                search_start_time;
+        iteration_info_.push_back(info);
+        if (std::abs(previous_fitness - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(previous_rmse - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+    return result;
+}
+
+void ICPEngine::InitializeSource(const geometry::PointCloud &source,
+                                 const Eigen::Matrix4d &transformation) {
+    // Assigning keeps the capacity of the buffers from previous calls.
+    source_.points_ = source.points_;
+    source_.normals_ = source.normals_;
+    source_.colors_ = source.colors_;
+    if (transformation.isIdentity() == false) {
+        source_.Transform(transformation);
+    }
+}
+
+void ICPEngine::ComputeCorrespondences(double max_correspondence_distance,
+                                       RegistrationResult &result) {
+    result.correspondence_set_.clear();
+    if (max_correspondence_distance <= 0.0) {
+        result.fitness_ = 0.0;
+        result.inlier_rmse_ = 0.0;
+        return;
+    }
+
+    // Each chunk writes the matches of its own source points, so no locks
+    // are needed. The matches are compacted in source order afterwards.
+    const int64_t num_points = int64_t(source_.points_.size());
+    nn_indices_.resize(num_points);
+    nn_distance2_.resize(num_points);
+    utility::ParallelFor(
+            0, num_points, kPointsPerChunk, [&](int64_t begin, int64_t end) {
+                std::vector<int> indices(1);
+                std::vector<double> distance2(1);
+                for (int64_t i = begin; i < end; i++) {
+                    if (kdtree_.SearchHybrid(source_.points_[i],
+                                             max_correspondence_distance, 1,
+                                             indices, distance2) > 0) {
+                        nn_indices_[i] = indices[0];
+                        nn_distance2_[i] = distance2[0];
+                    } else {
+                        nn_indices_[i] = -1;
+                    }
+                }
+            });
+
+    double error2 = 0.0;
+    for (int64_t i = 0; i < num_points; i++) {
+        if (nn_indices_[i] >= 0) {
+            result.correspondence_set_.push_back(
+                    Eigen::Vector2i(int(i), nn_indices_[i]));
+            error2 += nn_distance2_[i];
+        }
+    }
+
+    if (result.correspondence_set_.empty()) {
+        result.fitness_ = 0.0;
+        result.inlier_rmse_ = 0.0;
+    } else {
+        size_t corres_number = result.correspondence_set_.size();
+        result.fitness_ = (double)corres_number / (double)num_points;
+        result.inlier_rmse_ = std::sqrt(error2 / (double)corres_number);
+    }
+}
+
+}  // namespace registration
+}  // namespace open3d
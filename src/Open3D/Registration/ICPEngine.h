@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Registration.h"
+
+namespace open3d {
+namespace registration {
+
+/// \class ICPIterationInfo
+///
+/// \brief State and timing of one ICP iteration.
+class ICPIterationInfo {
+public:
+    /// Iteration number. Iteration 0 is the correspondence search at the
+    /// initial transformation.
+    int iteration_ = 0;
+    /// Fitness after the iteration.
+    double fitness_ = 0.0;
+    /// Inlier RMSE after the iteration.
+    double inlier_rmse_ = 0.0;
+    /// Milliseconds spent estimating the transformation update.
+    double estimation_time_ = 0.0;
+    /// Milliseconds spent searching the correspondences.
+    double correspondence_time_ = 0.0;
+};
+
+/// \class ICPEngine
+///
+/// \brief Runs ICP against a fixed target.
+///
+/// The target KDTree, the transformed source and the correspondence buffers
+/// are kept alive across iterations and across calls, so registering many
+/// sources against the same map only builds the index once. Correspondences
+/// are searched in parallel without locks and are ordered by source index.
+///
+/// An engine is not thread safe; use one engine per thread to register
+/// against the same target concurrently.
+class ICPEngine {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target Target point cloud. It is shared, not copied, and must
+    /// not be modified while the engine uses it.
+    explicit ICPEngine(std::shared_ptr<const geometry::PointCloud> target);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target Target point cloud, copied into the engine.
+    explicit ICPEngine(const geometry::PointCloud &target);
+    ICPEngine(const ICPEngine &) = delete;
+    ICPEngine &operator=(const ICPEngine &) = delete;
+
+public:
+    /// Replaces the target and rebuilds its KDTree.
+    void SetTarget(std::shared_ptr<const geometry::PointCloud> target);
+    /// Returns the target point cloud.
+    const geometry::PointCloud &GetTarget() const { return *target_; }
+
+    /// \brief Evaluates \p transformation like EvaluateRegistration().
+    ///
+    /// \param source The source point cloud.
+    /// \param max_correspondence_distance Maximum correspondence points-pair
+    /// distance.
+    /// \param transformation The 4x4 transformation matrix to transform
+    /// `source` to the target.
+    RegistrationResult Evaluate(const geometry::PointCloud &source,
+                                double max_correspondence_distance,
+                                const Eigen::Matrix4d &transformation =
+                                        Eigen::Matrix4d::Identity());
+
+    /// \brief Registers \p source to the target like RegistrationICP().
+    ///
+    /// \param source The source point cloud.
+    /// \param max_correspondence_distance Maximum correspondence points-pair
+    /// distance.
+    /// \param init Initial transformation estimation.
+    /// \param estimation Estimation method.
+    /// \param criteria Convergence criteria.
+    RegistrationResult Register(
+            const geometry::PointCloud &source,
+            double max_correspondence_distance,
+            const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+            const TransformationEstimation &estimation =
+                    TransformationEstimationPointToPoint(false),
+            const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+    /// Returns one entry per iteration of the last Register() call.
+    const std::vector<ICPIterationInfo> &GetIterationInfo() const {
+        return iteration_info_;
+    }
+
+private:
+    /// Copies \p source into source_ and applies \p transformation.
+    void InitializeSource(const geometry::PointCloud &source,
+                          const Eigen::Matrix4d &transformation);
+    /// Fills the correspondences, fitness and RMSE of \p result for the
+    /// current source_.
+    void ComputeCorrespondences(double max_correspondence_distance,
+                                RegistrationResult &result);
+
+private:
+    std::shared_ptr<const geometry::PointCloud> target_;
+    geometry::KDTreeFlann kdtree_;
+    /// Source transformed by the current estimate.
+    geometry::PointCloud source_;
+    /// Nearest target point of each source point, -1 if none is in range.
+    std::vector<int> nn_indices_;
+    std::vector<double> nn_distance2_;
+    std::vector<ICPIterationInfo> iteration_info_;
+};
+
+}  // namespace registration
+}  // namespace open3d
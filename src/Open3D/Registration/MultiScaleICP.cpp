@@ -0,0 +1,200 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/MultiScaleICP.h"
+
+#include <cmath>
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/ColoredICP.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+using namespace registration;
+
+/// Runs \p register_level(level, init, criteria) from the coarsest to the
+/// finest level.
+template <typename register_func_t>
+RegistrationResult RegistrationMultiScale(
+        const PointCloudPyramid &source,
+        PointCloudPyramid &target,
+        const std::vector<double> &max_distances,
+        const Eigen::Matrix4d &init,
+        const std::vector<ICPConvergenceCriteria> &criteria,
+        double early_exit_relative_fitness,
+        register_func_t register_level) {
+    const int num_levels = source.NumLevels();
+    if (target.NumLevels() != num_levels) {
+        utility::LogError(
+                "[RegistrationMultiScale] Source has {:d} levels but target "
+                "has {:d}.",
+                num_levels, target.NumLevels());
+    }
+    if (int(max_distances.size()) != num_levels) {
+        utility::LogError(
+                "[RegistrationMultiScale] {:d} distances for {:d} levels.",
+                max_distances.size(), num_levels);
+    }
+    if (!criteria.empty() && int(criteria.size()) != num_levels) {
+        utility::LogError(
+                "[RegistrationMultiScale] {:d} criteria for {:d} levels.",
+                criteria.size(), num_levels);
+    }
+
+    RegistrationResult result(init);
+    for (int level = 0; level < num_levels; level++) {
+        const double previous_fitness = result.fitness_;
+        result = register_level(level, result.transformation_,
+                                criteria.empty() ? ICPConvergenceCriteria()
+                                                 : criteria[level]);
+        utility::LogDebug(
+                "Multi-scale ICP level #{:d}: Fitness {:.4f}, RMSE {:.4f}",
+                level, result.fitness_, result.inlier_rmse_);
+        if (level > 0 && level + 1 < num_levels &&
+            std::abs(result.fitness_ - previous_fitness) <
+                    early_exit_relative_fitness) {
+            const int finest = num_levels - 1;
+            return target.GetEngine(finest).Evaluate(source.GetLevel(finest),
+                                                     max_distances[finest],
+                                                     result.transformation_);
+        }
+    }
+    return result;
+}
+
+}  // unnamed namespace
+
+namespace registration {
+
+PointCloudPyramid::PointCloudPyramid(const geometry::PointCloud &cloud,
+                                     const std::vector<double> &voxel_sizes,
+                                     bool estimate_normals /* = true*/)
+    : voxel_sizes_(voxel_sizes) {
+    if (voxel_sizes.empty()) {
+        utility::LogError("[PointCloudPyramid] No voxel sizes given.");
+    }
+    for (double voxel_size : voxel_sizes) {
+        if (voxel_size <= 0.0) {
+            utility::LogError("[PointCloudPyramid] Invalid voxel size {}.",
+                              voxel_size);
+        }
+        auto level = cloud.VoxelDownSample(voxel_size);
+        if (estimate_normals) {
+            level->EstimateNormals(
+                    geometry::KDTreeSearchParamHybrid(voxel_size * 2.0, 30));
+        }
+        levels_.push_back(level);
+    }
+    engines_.resize(levels_.size());
+    colored_engines_.resize(levels_.size());
+    colored_max_distances_.resize(levels_.size(), 0.0);
+}
+
+double PointCloudPyramid::GetVoxelSize(int level) const {
+    CheckLevel(level);
+    return voxel_sizes_[level];
+}
+
+const geometry::PointCloud &PointCloudPyramid::GetLevel(int level) const {
+    CheckLevel(level);
+    return *levels_[level];
+}
+
+ICPEngine &PointCloudPyramid::GetEngine(int level) {
+    CheckLevel(level);
+    if (!engines_[level]) {
+        engines_[level].reset(new ICPEngine(levels_[level]));
+    }
+    return *engines_[level];
+}
+
+ICPEngine &PointCloudPyramid::GetColoredICPEngine(int level,
+                                                  double max_distance) {
+    CheckLevel(level);
+    if (!colored_engines_[level] ||
+        colored_max_distances_[level] != max_distance) {
+        colored_engines_[level].reset(new ICPEngine(
+                CreateTargetForColoredICP(*levels_[level], max_distance)));
+        colored_max_distances_[level] = max_distance;
+    }
+    return *colored_engines_[level];
+}
+
+void PointCloudPyramid::CheckLevel(int level) const {
+    if (level < 0 || level >= NumLevels()) {
+        utility::LogError(
+                "[PointCloudPyramid] Level {:d} out of range [0, {:d}).", level,
+                NumLevels());
+    }
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const PointCloudPyramid &source,
+        PointCloudPyramid &target,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const std::vector<ICPConvergenceCriteria> &criteria /* = {}*/,
+        double early_exit_relative_fitness /* = 0.0*/) {
+    return RegistrationMultiScale(
+            source, target, max_correspondence_distances, init, criteria,
+            early_exit_relative_fitness,
+            [&](int level, const Eigen::Matrix4d &level_init,
+                const ICPConvergenceCriteria &level_criteria) {
+                return target.GetEngine(level).Register(
+                        source.GetLevel(level),
+                        max_correspondence_distances[level], level_init,
+                        estimation, level_criteria);
+            });
+}
+
+RegistrationResult RegistrationMultiScaleColoredICP(
+        const PointCloudPyramid &source,
+        PointCloudPyramid &target,
+        const std::vector<double> &max_distances,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const std::vector<ICPConvergenceCriteria> &criteria /* = {}*/,
+        double lambda_geometric /* = 0.968*/,
+        double early_exit_relative_fitness /* = 0.0*/) {
+    return RegistrationMultiScale(
+            source, target, max_distances, init, criteria,
+            early_exit_relative_fitness,
+            [&](int level, const Eigen::Matrix4d &level_init,
+                const ICPConvergenceCriteria &level_criteria) {
+                return RegistrationColoredICP(
+                        source.GetLevel(level),
+                        target.GetColoredICPEngine(level, max_distances[level]),
+                        max_distances[level], level_init, level_criteria,
+                        lambda_geometric);
+            });
+}
+
+}  // namespace registration
+}  // namespace open3d
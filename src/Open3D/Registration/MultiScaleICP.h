@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Registration/ICPEngine.h"
+#include "Open3D/Registration/Registration.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace registration {
+
+/// \class PointCloudPyramid
+///
+/// \brief Voxel downsampled levels of a point cloud, from coarse to fine.
+///
+/// Build a pyramid once per point cloud and pass it to any number of
+/// multi-scale registrations, as source or as target. The ICP engines of the
+/// levels are built the first time the pyramid is used as a target and are
+/// then reused, so a pyramid must not be the target of two registrations
+/// running at the same time.
+class PointCloudPyramid {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param cloud The input point cloud.
+    /// \param voxel_sizes Voxel size of each level, from coarse to fine.
+    /// \param estimate_normals If true, the normals of each level are
+    /// estimated from its 30 nearest points within twice its voxel size.
+    /// Otherwise the normals of the input are averaged per voxel.
+    PointCloudPyramid(const geometry::PointCloud &cloud,
+                      const std::vector<double> &voxel_sizes,
+                      bool estimate_normals = true);
+    PointCloudPyramid(const PointCloudPyramid &) = delete;
+    PointCloudPyramid &operator=(const PointCloudPyramid &) = delete;
+
+public:
+    /// Returns the number of levels.
+    int NumLevels() const { return int(levels_.size()); }
+    /// Returns the voxel size of \p level.
+    double GetVoxelSize(int level) const;
+    /// Returns the point cloud of \p level.
+    const geometry::PointCloud &GetLevel(int level) const;
+    /// Returns the ICP engine that uses \p level as target.
+    ICPEngine &GetEngine(int level);
+    /// \brief Returns the colored ICP engine that uses \p level as target.
+    ///
+    /// The color gradients depend on \p max_distance, so the engine is
+    /// rebuilt when it changes. See CreateTargetForColoredICP().
+    ICPEngine &GetColoredICPEngine(int level, double max_distance);
+
+private:
+    void CheckLevel(int level) const;
+
+private:
+    std::vector<double> voxel_sizes_;
+    std::vector<std::shared_ptr<const geometry::PointCloud>> levels_;
+    std::vector<std::unique_ptr<ICPEngine>> engines_;
+    std::vector<std::unique_ptr<ICPEngine>> colored_engines_;
+    /// max_distance each colored engine was built for.
+    std::vector<double> colored_max_distances_;
+};
+
+/// \brief Function for coarse-to-fine ICP registration.
+///
+/// Runs RegistrationICP() on each level of the pyramids, from coarse to fine,
+/// starting each level from the result of the previous one. The returned
+/// correspondences refer to the points of the finest levels.
+///
+/// \param source Pyramid of the source point cloud.
+/// \param target Pyramid of the target point cloud, with as many levels as
+/// \p source.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of each level.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria of each level. If empty, every level
+/// uses the default criteria.
+/// \param early_exit_relative_fitness Skips the remaining levels once the
+/// fitness of a level differs from the fitness of the previous level by less
+/// than this value. The result is then evaluated on the finest levels.
+RegistrationResult RegistrationMultiScaleICP(
+        const PointCloudPyramid &source,
+        PointCloudPyramid &target,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const std::vector<ICPConvergenceCriteria> &criteria = {},
+        double early_exit_relative_fitness = 0.0);
+
+/// \brief Function for coarse-to-fine Colored ICP registration.
+///
+/// Same as RegistrationMultiScaleICP() with RegistrationColoredICP() on each
+/// level. The point clouds must have colors.
+///
+/// \param source Pyramid of the source point cloud.
+/// \param target Pyramid of the target point cloud, with as many levels as
+/// \p source.
+/// \param max_distances Maximum correspondence points-pair distance of each
+/// level.
+/// \param init Initial transformation estimation.
+/// \param criteria Convergence criteria of each level. If empty, every level
+/// uses the default criteria.
+/// \param lambda_geometric lambda_geometric value.
+/// \param early_exit_relative_fitness Skips the remaining levels once the
+/// fitness of a level differs from the fitness of the previous level by less
+/// than this value.
+RegistrationResult RegistrationMultiScaleColoredICP(
+        const PointCloudPyramid &source,
+        PointCloudPyramid &target,
+        const std::vector<double> &max_distances,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const std::vector<ICPConvergenceCriteria> &criteria = {},
+        double lambda_geometric = 0.968,
+        double early_exit_relative_fitness = 0.0);
+
+}  // namespace registration
+}  // namespace open3d
@@ -26,11 +26,13 @@
 
 #include "Open3D/Registration/Registration.h"
 
+#include <atomic>
 #include <cstdlib>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/ICPEngine.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
 
@@ -126,6 +128,14 @@ RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
+/// Wraps \p pcd without taking ownership, for engines that do not outlive
+/// the call. Keeps the dynamic type, which colored ICP relies on.
+std::shared_ptr<const geometry::PointCloud> BorrowPointCloud(
+        const geometry::PointCloud &pcd) {
+    return std::shared_ptr<const geometry::PointCloud>(
+            std::shared_ptr<const geometry::PointCloud>(), &pcd);
+}
+
 }  // unnamed namespace
 
 namespace registration {
@@ -135,14 +145,9 @@ RegistrationResult EvaluateRegistration(
         double max_correspondence_distance,
         const Eigen::Matrix4d
                 &transformation /* = Eigen::Matrix4d::Identity()*/) {
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
-    geometry::PointCloud pcd = source;
-    if (transformation.isIdentity() == false) {
-        pcd.Transform(transformation);
-    }
-    return GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
+    ICPEngine engine(BorrowPointCloud(target));
+    return engine.Evaluate(source, max_correspondence_distance,
+                           transformation);
 }
 
 RegistrationResult RegistrationICP(
@@ -154,49 +159,9 @@ RegistrationResult RegistrationICP(
         /* = TransformationEstimationPointToPoint(false)*/,
         const ICPConvergenceCriteria
                 &criteria /* = ICPConvergenceCriteria()*/) {
-    if (max_correspondence_distance <= 0.0) {
-        utility::LogError("Invalid max_correspondence_distance.");
-    }
-    if ((estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::PointToPlane ||
-         estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::ColoredICP) &&
-        (!source.HasNormals() || !target.HasNormals())) {
-        utility::LogError(
-                "TransformationEstimationPointToPlane and "
-                "TransformationEstimationColoredICP "
-                "require pre-computed normal vectors.");
-    }
-
-    Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
-    geometry::PointCloud pcd = source;
-    if (init.isIdentity() == false) {
-        pcd.Transform(init);
-    }
-    RegistrationResult result;
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
-    for (int i = 0; i < criteria.max_iteration_; i++) {
-        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
-                          result.fitness_, result.inlier_rmse_);
-        Eigen::Matrix4d update = estimation.ComputeTransformation(
-                pcd, target, result.correspondence_set_);
-        transformation = update * transformation;
-        pcd.Transform(update);
-        RegistrationResult backup = result;
-        result = GetRegistrationResultAndCorrespondences(
-                pcd, target, kdtree, max_correspondence_distance,
-                transformation);
-        if (std::abs(backup.fitness_ - result.fitness_) <
-                    criteria.relative_fitness_ &&
-            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
-                    criteria.relative_rmse_) {
-            break;
-        }
-    }
-    return result;
+    ICPEngine engine(BorrowPointCloud(target));
+    return engine.Register(source, max_correspondence_distance, init,
+                           estimation, criteria);
 }
 
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
@@ -254,99 +219,91 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
+        /* = RANSACConvergenceCriteria()*/,
+        bool mutual_filter /* = false*/,
+        double ratio_test /* = 1.0*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
 
+    // Both indices are built once and only read by the RANSAC threads.
+    const CorrespondenceSet corres = CorrespondencesFromFeatures(
+            source_feature, target_feature, mutual_filter, ratio_test);
+    if ((int)corres.size() < ransac_n) {
+        utility::LogWarning(
+                "[RegistrationRANSACBasedOnFeatureMatching] Only {:d} feature "
+                "correspondences, at least {:d} are required.",
+                corres.size(), ransac_n);
+        return RegistrationResult();
+    }
+    geometry::KDTreeFlann kdtree(target);
+
     RegistrationResult result;
-    int total_validation = 0;
-    bool finished_validation = false;
-    int num_similar_features = 1;
-    std::vector<std::vector<int>> similar_features(source.points_.size());
+    std::atomic<int> total_validation(0);
+    std::atomic<bool> finished_validation(false);
 
 #ifdef _OPENMP
 #pragma omp parallel
     {
 #endif
         CorrespondenceSet ransac_corres(ransac_n);
-        geometry::KDTreeFlann kdtree(target);
-        geometry::KDTreeFlann kdtree_feature(target_feature);
         RegistrationResult result_private;
+        // Reused by every validation of this thread; only the points are
+        // needed to score a hypothesis.
+        geometry::PointCloud pcd;
+        pcd.points_.resize(source.points_.size());
 
 #ifdef _OPENMP
 #pragma omp for nowait
 #endif
         for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (!finished_validation) {
-                std::vector<double> dists(num_similar_features);
-                Eigen::Matrix4d transformation;
-                for (int j = 0; j < ransac_n; j++) {
-                    int source_sample_id = utility::UniformRandInt(
-                            0, static_cast<int>(source.points_.size()) - 1);
-                    if (similar_features[source_sample_id].empty()) {
-                        std::vector<int> indices(num_similar_features);
-                        kdtree_feature.SearchKNN(
-                                Eigen::VectorXd(source_feature.data_.col(
-                                        source_sample_id)),
-                                num_similar_features, indices, dists);
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                        { similar_features[source_sample_id] = indices; }
-                    }
-                    ransac_corres[j](0) = source_sample_id;
-                    if (num_similar_features == 1)
-                        ransac_corres[j](1) =
-                                similar_features[source_sample_id][0];
-                    else {
-                        ransac_corres[j](1) = similar_features
-                                [source_sample_id][utility::UniformRandInt(
-                                        0, num_similar_features - 1)];
-                    }
-                }
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (checker.get().require_pointcloud_alignment_ == false &&
-                        checker.get().Check(source, target, ransac_corres,
-                                            transformation) == false) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (check == false) continue;
-                transformation = estimation.ComputeTransformation(
-                        source, target, ransac_corres);
-                check = true;
-                for (const auto &checker : checkers) {
-                    if (checker.get().require_pointcloud_alignment_ == true &&
-                        checker.get().Check(source, target, ransac_corres,
-                                            transformation) == false) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (check == false) continue;
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto this_result = GetRegistrationResultAndCorrespondences(
-                        pcd, target, kdtree, max_correspondence_distance,
-                        transformation);
-                if (this_result.fitness_ > result_private.fitness_ ||
-                    (this_result.fitness_ == result_private.fitness_ &&
-                     this_result.inlier_rmse_ < result_private.inlier_rmse_)) {
-                    result_private = this_result;
+            if (finished_validation.load(std::memory_order_relaxed)) continue;
+            Eigen::Matrix4d transformation;
+            for (int j = 0; j < ransac_n; j++) {
+                ransac_corres[j] = corres[utility::UniformRandInt(
+                        0, static_cast<int>(corres.size()) - 1)];
+            }
+            bool check = true;
+            for (const auto &checker : checkers) {
+                if (checker.get().require_pointcloud_alignment_ == false &&
+                    checker.get().Check(source, target, ransac_corres,
+                                        transformation) == false) {
+                    check = false;
+                    break;
                 }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                {
-                    total_validation = total_validation + 1;
-                    if (total_validation >= criteria.max_validation_)
-                        finished_validation = true;
+            }
+            if (check == false) continue;
+            transformation = estimation.ComputeTransformation(source, target,
+                                                              ransac_corres);
+            check = true;
+            for (const auto &checker : checkers) {
+                if (checker.get().require_pointcloud_alignment_ == true &&
+                    checker.get().Check(source, target, ransac_corres,
+                                        transformation) == false) {
+                    check = false;
+                    break;
                 }
-            }  // end of if statement
-        }      // end of for-loop
+            }
+            if (check == false) continue;
+            const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+            const Eigen::Vector3d translation =
+                    transformation.block<3, 1>(0, 3);
+            for (size_t i = 0; i < source.points_.size(); i++) {
+                pcd.points_[i] = rotation * source.points_[i] + translation;
+            }
+            auto this_result = GetRegistrationResultAndCorrespondences(
+                    pcd, target, kdtree, max_correspondence_distance,
+                    transformation);
+            if (this_result.fitness_ > result_private.fitness_ ||
+                (this_result.fitness_ == result_private.fitness_ &&
+                 this_result.inlier_rmse_ < result_private.inlier_rmse_)) {
+                result_private = std::move(this_result);
+            }
+            if (total_validation.fetch_add(1, std::memory_order_relaxed) + 1 >=
+                criteria.max_validation_) {
+                finished_validation.store(true, std::memory_order_relaxed);
+            }
+        }  // end of for-loop
 #ifdef _OPENMP
 #pragma omp critical
 #endif
@@ -354,13 +311,13 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
             if (result_private.fitness_ > result.fitness_ ||
                 (result_private.fitness_ == result.fitness_ &&
                  result_private.inlier_rmse_ < result.inlier_rmse_)) {
-                result = result_private;
+                result = std::move(result_private);
             }
         }
 #ifdef _OPENMP
     }
 #endif
-    utility::LogDebug("total_validation : {:d}", total_validation);
+    utility::LogDebug("total_validation : {:d}", total_validation.load());
     utility::LogDebug("RANSAC: Fitness {:e}, RMSE {:e}", result.fitness_,
                       result.inlier_rmse_);
     return result;
@@ -371,15 +328,8 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         const geometry::PointCloud &target,
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
-    geometry::PointCloud pcd = source;
-    if (transformation.isIdentity() == false) {
-        pcd.Transform(transformation);
-    }
-    RegistrationResult result;
-    geometry::KDTreeFlann target_kdtree(target);
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, target_kdtree, max_correspondence_distance,
-            transformation);
+    RegistrationResult result = EvaluateRegistration(
+            source, target, max_correspondence_distance, transformation);
 
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
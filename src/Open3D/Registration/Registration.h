@@ -193,6 +193,9 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param max_correspondence_distance Maximum correspondence points-pair
 /// distance. \param ransac_n Fit ransac with `ransac_n` correspondences. \param
 /// checkers Correspondence checker. \param criteria Convergence criteria.
+/// \param mutual_filter Only samples feature matches that are nearest
+/// neighbors in both directions. \param ratio_test Ratio test threshold for
+/// the feature matches, see CorrespondencesFromFeatures().
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -204,8 +207,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         int ransac_n = 4,
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
-        const RANSACConvergenceCriteria &criteria =
-                RANSACConvergenceCriteria());
+        const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
+        bool mutual_filter = false,
+        double ratio_test = 1.0);
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
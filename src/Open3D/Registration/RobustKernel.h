@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+
+namespace open3d {
+namespace registration {
+
+/// \class RobustKernel
+///
+/// \brief Base class of the robust kernels used to down-weight outlier
+/// correspondences in Gauss-Newton registration.
+///
+/// A kernel with loss rho(r) gives residual r the weight rho'(r) / r in
+/// iteratively reweighted least squares. The virtual function Weight() must
+/// be implemented in subclasses.
+class RobustKernel {
+public:
+    virtual ~RobustKernel() {}
+    /// Returns the weight of \p residual.
+    virtual double Weight(double residual) const = 0;
+};
+
+/// \class L2Loss
+///
+/// \brief Plain least squares, every residual has weight 1.
+class L2Loss : public RobustKernel {
+public:
+    double Weight(double residual) const override { return 1.0; }
+};
+
+/// \class HuberLoss
+///
+/// \brief Quadratic for residuals up to \p k_ and linear beyond.
+class HuberLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Residual at which the loss becomes linear.
+    explicit HuberLoss(double k) : k_(k) {}
+
+    double Weight(double residual) const override {
+        const double e = std::abs(residual);
+        return e <= k_ ? 1.0 : k_ / e;
+    }
+
+public:
+    /// Residual at which the loss becomes linear.
+    double k_;
+};
+
+/// \class CauchyLoss
+///
+/// \brief Logarithmic loss that down-weights residuals larger than \p k_
+/// smoothly.
+class CauchyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale of the residuals.
+    explicit CauchyLoss(double k) : k_(k) {}
+
+    double Weight(double residual) const override {
+        const double e = residual / k_;
+        return 1.0 / (1.0 + e * e);
+    }
+
+public:
+    /// Scale of the residuals.
+    double k_;
+};
+
+/// \class TukeyLoss
+///
+/// \brief Tukey's biweight, which ignores residuals larger than \p k_.
+class TukeyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Residual beyond which the weight is 0.
+    explicit TukeyLoss(double k) : k_(k) {}
+
+    double Weight(double residual) const override {
+        if (std::abs(residual) > k_) return 0.0;
+        const double e = residual / k_;
+        return (1.0 - e * e) * (1.0 - e * e);
+    }
+
+public:
+    /// Residual beyond which the weight is 0.
+    double k_;
+};
+
+}  // namespace registration
+}  // namespace open3d
@@ -81,22 +81,23 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
     if (corres.empty() || target.HasNormals() == false)
         return Eigen::Matrix4d::Identity();
 
-    auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
-                                             double &r) {
-        const Eigen::Vector3d &vs = source.points_[corres[i][0]];
-        const Eigen::Vector3d &vt = target.points_[corres[i][1]];
-        const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
-        r = (vs - vt).dot(nt);
-        J_r.block<3, 1>(0, 0) = vs.cross(nt);
-        J_r.block<3, 1>(3, 0) = nt;
-    };
-
+    L2Loss l2_loss;
+    const RobustKernel &kernel = kernel_ ? *kernel_ : l2_loss;
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
+    std::tie(JTJ, JTr, r2) = utility::ComputeWeightedJTJandJTr(
+            [&](int64_t i, Eigen::Vector6d &J_r, Eigen::Matrix<double, 1, 1> &r,
+                Eigen::Matrix<double, 1, 1> &w) {
+                const Eigen::Vector3d &vs = source.points_[corres[i][0]];
+                const Eigen::Vector3d &vt = target.points_[corres[i][1]];
+                const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
+                r(0) = (vs - vt).dot(nt);
+                w(0) = kernel.Weight(r(0));
+                J_r.block<3, 1>(0, 0) = vs.cross(nt);
+                J_r.block<3, 1>(3, 0) = nt;
+            },
+            int64_t(corres.size()));
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
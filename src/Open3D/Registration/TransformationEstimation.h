@@ -31,6 +31,8 @@
 #include <string>
 #include <vector>
 
+#include "Open3D/Registration/RobustKernel.h"
+
 namespace open3d {
 
 namespace geometry {
@@ -128,8 +130,13 @@ private:
 /// Class to estimate a transformation for point to plane distance.
 class TransformationEstimationPointToPlane : public TransformationEstimation {
 public:
-    /// \brief Default Constructor.
-    TransformationEstimationPointToPlane() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param kernel Robust kernel that weights the correspondences. nullptr
+    /// gives plain least squares.
+    TransformationEstimationPointToPlane(
+            std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>())
+        : kernel_(std::move(kernel)) {}
     ~TransformationEstimationPointToPlane() override {}
 
 public:
@@ -145,6 +152,10 @@ public:
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
 
+public:
+    /// Robust kernel that weights the correspondences.
+    std::shared_ptr<RobustKernel> kernel_;
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
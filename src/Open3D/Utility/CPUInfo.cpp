@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/CPUInfo.h"
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+SIMDLevel DetectCPUSIMDLevel() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // __builtin_cpu_supports also checks that the OS saves the extended
+    // register state (XCR0), so the AVX results are safe to use directly.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SIMDLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SIMDLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SIMDLevel::SSE2;
+    }
+    return SIMDLevel::Scalar;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int regs[4];
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+    __cpuid(regs, 1);
+    const bool has_sse2 = (regs[3] & (1 << 26)) != 0;
+    const bool has_osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool has_avx = (regs[2] & (1 << 28)) != 0;
+    if (!has_sse2) {
+        return SIMDLevel::Scalar;
+    }
+    if (!has_osxsave || !has_avx || max_leaf < 7) {
+        return SIMDLevel::SSE2;
+    }
+    // XCR0 bits 1-2 (XMM, YMM) are required for AVX and bits 5-7 (opmask,
+    // ZMM) additionally for AVX-512.
+    const unsigned long long xcr0 = _xgetbv(0);
+    const bool os_avx = (xcr0 & 0x6) == 0x6;
+    const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+    __cpuidex(regs, 7, 0);
+    const bool has_avx2 = (regs[1] & (1 << 5)) != 0;
+    const bool has_avx512f = (regs[1] & (1 << 16)) != 0;
+    if (os_avx512 && has_avx512f) {
+        return SIMDLevel::AVX512;
+    }
+    if (os_avx && has_avx2) {
+        return SIMDLevel::AVX2;
+    }
+    return SIMDLevel::SSE2;
+#else
+    return SIMDLevel::Scalar;
+#endif
+}
+
+bool DetectCPUF16C() {
+    // F16C is reported by CPUID leaf 1, ECX bit 29. It operates on YMM
+    // registers, so the OS must also save the AVX state.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    __builtin_cpu_init();
+    return (ecx & (1u << 29)) != 0 && __builtin_cpu_supports("avx");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int regs[4];
+    __cpuid(regs, 1);
+    const bool has_osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool has_avx = (regs[2] & (1 << 28)) != 0;
+    const bool has_f16c = (regs[2] & (1 << 29)) != 0;
+    if (!has_osxsave || !has_avx || !has_f16c) {
+        return false;
+    }
+    return (_xgetbv(0) & 0x6) == 0x6;
+#else
+    return false;
+#endif
+}
+
+std::atomic<int> g_max_simd_level(static_cast<int>(SIMDLevel::AVX512));
+
+}  // unnamed namespace
+
+SIMDLevel GetCPUSIMDLevel() {
+    static const SIMDLevel level = DetectCPUSIMDLevel();
+    return level;
+}
+
+bool CPUSupportsF16C() {
+    static const bool has_f16c = DetectCPUF16C();
+    return has_f16c;
+}
+
+SIMDLevel GetSIMDLevel() {
+    return static_cast<SIMDLevel>(
+            std::min(static_cast<int>(GetCPUSIMDLevel()),
+                     g_max_simd_level.load(std::memory_order_relaxed)));
+}
+
+void SetMaxSIMDLevel(SIMDLevel level) {
+    g_max_simd_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+std::string SIMDLevelToString(SIMDLevel level) {
+    switch (level) {
+        case SIMDLevel::Scalar:
+            return "Scalar";
+        case SIMDLevel::SSE2:
+            return "SSE2";
+        case SIMDLevel::AVX2:
+            return "AVX2";
+        case SIMDLevel::AVX512:
+            return "AVX512";
+        default:
+            return "Unknown";
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
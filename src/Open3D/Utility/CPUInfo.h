@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// SIMD instruction set levels used by the vectorized CPU kernels, ordered by
+/// capability.
+enum class SIMDLevel {
+    Scalar = 0,  ///< No vector instructions.
+    SSE2 = 1,    ///< 128-bit SSE2.
+    AVX2 = 2,    ///< 256-bit AVX2.
+    AVX512 = 3,  ///< 512-bit AVX-512F.
+};
+
+/// Returns the highest SIMD level supported by the running CPU and operating
+/// system. The detection runs once and the result is cached.
+SIMDLevel GetCPUSIMDLevel();
+
+/// Returns true if the running CPU and operating system support the F16C
+/// half-precision conversion instructions. The detection runs once and the
+/// result is cached.
+bool CPUSupportsF16C();
+
+/// Returns the SIMD level to be used by vectorized kernels, i.e. the lower of
+/// GetCPUSIMDLevel() and the level set by SetMaxSIMDLevel().
+SIMDLevel GetSIMDLevel();
+
+/// Caps the SIMD level used by vectorized kernels. Mostly useful for
+/// benchmarking and testing the fallback code paths. Setting a level higher
+/// than the CPU supports has no effect beyond GetCPUSIMDLevel().
+void SetMaxSIMDLevel(SIMDLevel level);
+
+/// Returns the name of \p level, e.g. "AVX2".
+std::string SIMDLevelToString(SIMDLevel level);
+
+}  // namespace utility
+}  // namespace open3d
@@ -28,9 +28,14 @@
 
 #include <Eigen/Core>
 #include <Eigen/StdVector>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <tuple>
 #include <vector>
 
+#include "Open3D/Utility/Parallel.h"
+
 namespace Eigen {
 
 /// Extending Eigen namespace by adding frequently used matrix type
@@ -113,6 +118,82 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         int iteration_num,
         bool verbose = true);
 
+/// \brief Computes the weighted 6-DoF normal equations without a callback
+/// per row.
+///
+/// \p func(i, J_r, r, w) fills the \p kRows Jacobian rows (as the columns of
+/// an Eigen::Matrix<double, 6, kRows>), residuals and weights (as
+/// Eigen::Matrix<double, kRows, 1>) of item i in [0, \p num_items). \p func
+/// is inlined into the reduction and must be safe to call concurrently.
+///
+/// The items are reduced in parallel blocks. Each block accumulates in
+/// \p scalar_t, and the block sums are added in double in block order, so
+/// the result does not depend on the number of threads. Float accumulation
+/// is faster but loses precision for large coordinates.
+///
+/// Returns sum(w J J^T), sum(w J r) and the unweighted sum of r^2.
+template <int kRows = 1, typename scalar_t = double, typename func_t>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeWeightedJTJandJTr(
+        func_t func, int64_t num_items) {
+    // Upper triangle of JTJ, then JTr, then r^2.
+    constexpr int kNumSums = 21 + 6 + 1;
+    constexpr int64_t kItemsPerBlock = 512;
+    const int64_t num_blocks =
+            (num_items + kItemsPerBlock - 1) / kItemsPerBlock;
+    std::vector<std::array<double, kNumSums>> block_sums(num_blocks);
+    ParallelFor(0, num_blocks, 1, [&](int64_t block_begin, int64_t block_end) {
+        Eigen::Matrix<double, 6, kRows> J_r;
+        Eigen::Matrix<double, kRows, 1> r;
+        Eigen::Matrix<double, kRows, 1> w;
+        for (int64_t block = block_begin; block < block_end; block++) {
+            scalar_t sums[kNumSums] = {};
+            const int64_t end =
+                    std::min(num_items, (block + 1) * kItemsPerBlock);
+            for (int64_t i = block * kItemsPerBlock; i < end; i++) {
+                func(i, J_r, r, w);
+                for (int k = 0; k < kRows; k++) {
+                    scalar_t J[6], wJ[6];
+                    for (int a = 0; a < 6; a++) {
+                        J[a] = scalar_t(J_r(a, k));
+                        wJ[a] = scalar_t(w(k)) * J[a];
+                    }
+                    const scalar_t r_k = scalar_t(r(k));
+                    int idx = 0;
+                    for (int a = 0; a < 6; a++) {
+                        for (int b = a; b < 6; b++) {
+                            sums[idx++] += wJ[a] * J[b];
+                        }
+                    }
+                    for (int a = 0; a < 6; a++) {
+                        sums[21 + a] += wJ[a] * r_k;
+                    }
+                    sums[27] += r_k * r_k;
+                }
+            }
+            for (int k = 0; k < kNumSums; k++) {
+                block_sums[block][k] = double(sums[k]);
+            }
+        }
+    });
+
+    std::array<double, kNumSums> total{};
+    for (const auto &sums : block_sums) {
+        for (int k = 0; k < kNumSums; k++) {
+            total[k] += sums[k];
+        }
+    }
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    int idx = 0;
+    for (int a = 0; a < 6; a++) {
+        for (int b = a; b < 6; b++) {
+            JTJ(a, b) = JTJ(b, a) = total[idx++];
+        }
+        JTr(a) = total[21 + a];
+    }
+    return std::make_tuple(JTJ, JTr, total[27]);
+}
+
 Eigen::Matrix3d RotationMatrixX(double radians);
 Eigen::Matrix3d RotationMatrixY(double radians);
 Eigen::Matrix3d RotationMatrixZ(double radians);
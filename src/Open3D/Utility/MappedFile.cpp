@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& filename, Mode mode)
+    : filename_(filename), mode_(mode) {
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int new_size = MultiByteToWideChar(
+            CP_UTF8, 0, filename.c_str(), static_cast<int>(filename.length()),
+            const_cast<wchar_t*>(filename_w.c_str()),
+            static_cast<int>(filename.length()));
+    filename_w.resize(new_size);
+
+    DWORD access = mode == Mode::ReadWrite ? GENERIC_READ | GENERIC_WRITE
+                                           : GENERIC_READ;
+    HANDLE file = CreateFileW(filename_w.c_str(), access, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        utility::LogError("Failed to open {} for mapping.", filename);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        utility::LogError("Failed to get the size of {}.", filename);
+    }
+    file_handle_ = file;
+    size_ = static_cast<int64_t>(size.QuadPart);
+    if (size_ == 0) {
+        return;
+    }
+
+    DWORD protect = PAGE_READONLY;
+    DWORD view_access = FILE_MAP_READ;
+    if (mode == Mode::CopyOnWrite) {
+        protect = PAGE_WRITECOPY;
+        view_access = FILE_MAP_COPY;
+    } else if (mode == Mode::ReadWrite) {
+        protect = PAGE_READWRITE;
+        view_access = FILE_MAP_WRITE;
+    }
+    HANDLE mapping = CreateFileMappingW(file, nullptr, protect, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        utility::LogError("Failed to map {}.", filename);
+    }
+    mapping_handle_ = mapping;
+    data_ = static_cast<char*>(MapViewOfFile(mapping, view_access, 0, 0, 0));
+    if (data_ == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        utility::LogError("Failed to map {}.", filename);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_ != nullptr) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    if (file_handle_ != nullptr) {
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename, Mode mode)
+    : filename_(filename), mode_(mode) {
+    int fd = open(filename.c_str(),
+                  mode == Mode::ReadWrite ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+        utility::LogError("Failed to open {} for mapping: {}.", filename,
+                          std::strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        utility::LogError("Failed to get the size of {}: {}.", filename,
+                          std::strerror(errno));
+    }
+    size_ = static_cast<int64_t>(st.st_size);
+    if (size_ == 0) {
+        close(fd);
+        return;
+    }
+
+    int prot = PROT_READ;
+    int flags = MAP_SHARED;
+    if (mode == Mode::CopyOnWrite) {
+        prot = PROT_READ | PROT_WRITE;
+        flags = MAP_PRIVATE;
+    } else if (mode == Mode::ReadWrite) {
+        prot = PROT_READ | PROT_WRITE;
+    }
+    void* data = mmap(nullptr, static_cast<size_t>(size_), prot, flags, fd, 0);
+    // The mapping stays valid after the file descriptor is closed.
+    close(fd);
+    if (data == MAP_FAILED) {
+        utility::LogError("Failed to map {}: {}.", filename,
+                          std::strerror(errno));
+    }
+    data_ = static_cast<char*>(data);
+}
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+        munmap(data_, static_cast<size_t>(size_));
+    }
+}
+
+#endif
+
+}  // namespace utility
+}  // namespace open3d
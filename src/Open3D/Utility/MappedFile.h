@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// RAII memory mapping of a whole file. Pages are read from disk on first
+/// access, so opening a multi-GB file is instant and only the touched parts
+/// occupy RAM.
+class MappedFile {
+public:
+    enum class Mode {
+        /// Read-only mapping. Writing to the mapped memory is undefined.
+        ReadOnly,
+        /// Writable private mapping. Modified pages are copied in memory and
+        /// never written back to the file.
+        CopyOnWrite,
+        /// Writable shared mapping. Modifications are written back to the
+        /// file.
+        ReadWrite
+    };
+
+    /// Maps \p filename into memory. Calls LogError if the file cannot be
+    /// opened or mapped.
+    MappedFile(const std::string& filename, Mode mode = Mode::ReadOnly);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Returns the beginning of the mapped file, or nullptr for empty files.
+    char* GetData() const { return data_; }
+
+    /// Returns the size of the mapped file in bytes.
+    int64_t GetSize() const { return size_; }
+
+    Mode GetMode() const { return mode_; }
+
+    const std::string& GetFileName() const { return filename_; }
+
+private:
+    std::string filename_;
+    Mode mode_;
+    char* data_ = nullptr;
+    int64_t size_ = 0;
+#ifdef _WIN32
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+}  // namespace utility
+}  // namespace open3d
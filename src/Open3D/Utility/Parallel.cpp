@@ -0,0 +1,290 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// Each thread claims chunks dynamically, so a few chunks per thread are
+/// enough to balance uneven iterations.
+constexpr int64_t kChunksPerThread = 8;
+
+int GetDefaultMaxThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+#endif
+}
+
+std::mutex g_scheduler_mutex;
+/// nullptr until first use or after the default pool is invalidated.
+std::shared_ptr<TaskScheduler> g_scheduler;
+bool g_is_default_scheduler = true;
+/// User-defined thread cap, 0 for the default.
+std::atomic<int> g_max_threads(0);
+
+/// Depth of the ParallelFor() bodies the current thread is executing.
+thread_local int tls_parallel_depth = 0;
+
+/// Loops started inside an OpenMP parallel region run serially, since the
+/// OpenMP threads already occupy the cores.
+bool InOpenMPParallel() {
+#ifdef _OPENMP
+    return omp_in_parallel();
+#else
+    return false;
+#endif
+}
+
+int GetThreadCap() {
+    int max_threads = g_max_threads.load(std::memory_order_relaxed);
+    return max_threads > 0 ? max_threads : GetDefaultMaxThreads();
+}
+
+/// State shared by the threads working on one ParallelFor() call. Scheduled
+/// helpers may start after the call has returned, hence the shared
+/// ownership; such helpers find no chunk left and never touch range_func_.
+struct ParallelForState {
+    int64_t begin_;
+    int64_t end_;
+    int64_t chunk_size_;
+    int64_t num_chunks_;
+    const std::function<void(int64_t, int64_t)>* range_func_;
+    std::atomic<int64_t> next_chunk_{0};
+    std::atomic<int64_t> num_done_{0};
+    std::mutex mutex_;
+    std::condition_variable done_cv_;
+    std::exception_ptr exception_;
+
+    /// Claims and runs chunks until none is left.
+    void Work() {
+        ++tls_parallel_depth;
+        while (true) {
+            int64_t chunk = next_chunk_.fetch_add(1);
+            if (chunk >= num_chunks_) {
+                break;
+            }
+            int64_t start = begin_ + chunk * chunk_size_;
+            int64_t stop = std::min(start + chunk_size_, end_);
+            int64_t num_finished = 1;
+            try {
+                (*range_func_)(start, stop);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!exception_) {
+                    exception_ = std::current_exception();
+                }
+                // Cancels the chunks that have not been claimed yet.
+                int64_t claimed = next_chunk_.exchange(num_chunks_);
+                num_finished += std::max(int64_t(0), num_chunks_ - claimed);
+            }
+            if (num_done_.fetch_add(num_finished) + num_finished ==
+                num_chunks_) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_cv_.notify_all();
+            }
+        }
+        --tls_parallel_depth;
+    }
+};
+
+}  // unnamed namespace
+
+int GetMaxThreads() {
+    int scheduler_threads = GetTaskScheduler()->GetNumThreads();
+    return std::max(1, std::min(GetThreadCap(), scheduler_threads + 1));
+}
+
+void SetMaxThreads(int num_threads) {
+    g_max_threads.store(std::max(0, num_threads), std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(g_scheduler_mutex);
+    if (g_is_default_scheduler && g_scheduler != nullptr &&
+        g_scheduler->GetNumThreads() != std::max(1, GetThreadCap() - 1)) {
+        // Recreated with the new size on next use.
+        g_scheduler = nullptr;
+    }
+}
+
+bool InParallel() { return tls_parallel_depth > 0 || InOpenMPParallel(); }
+
+void SetTaskScheduler(std::shared_ptr<TaskScheduler> scheduler) {
+    std::lock_guard<std::mutex> lock(g_scheduler_mutex);
+    g_is_default_scheduler = scheduler == nullptr;
+    g_scheduler = std::move(scheduler);
+}
+
+std::shared_ptr<TaskScheduler> GetTaskScheduler() {
+    std::lock_guard<std::mutex> lock(g_scheduler_mutex);
+    if (g_scheduler == nullptr) {
+        // The calling thread takes part in every loop, hence one worker less.
+        g_scheduler = std::make_shared<ThreadPool>(
+                std::max(1, GetThreadCap() - 1));
+        g_is_default_scheduler = true;
+    }
+    return g_scheduler;
+}
+
+void ParallelFor(int64_t begin,
+                 int64_t end,
+                 int64_t grain_size,
+                 const std::function<void(int64_t, int64_t)>& range_func,
+                 int max_threads) {
+    if (end <= begin) {
+        return;
+    }
+    const int64_t num_iters = end - begin;
+    grain_size = std::max(int64_t(1), grain_size);
+    std::shared_ptr<TaskScheduler> scheduler = GetTaskScheduler();
+    int64_t num_threads = std::min(GetThreadCap(),
+                                   scheduler->GetNumThreads() + 1);
+    if (max_threads > 0) {
+        num_threads = std::min<int64_t>(num_threads, max_threads);
+    }
+    num_threads =
+            std::min(num_threads, (num_iters + grain_size - 1) / grain_size);
+    if (num_threads <= 1 || InOpenMPParallel()) {
+        ++tls_parallel_depth;
+        try {
+            range_func(begin, end);
+        } catch (...) {
+            --tls_parallel_depth;
+            throw;
+        }
+        --tls_parallel_depth;
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->begin_ = begin;
+    state->end_ = end;
+    state->chunk_size_ = std::max(
+            grain_size, (num_iters + num_threads * kChunksPerThread - 1) /
+                                (num_threads * kChunksPerThread));
+    state->num_chunks_ =
+            (num_iters + state->chunk_size_ - 1) / state->chunk_size_;
+    state->range_func_ = &range_func;
+    int64_t num_helpers = std::min(num_threads, state->num_chunks_) - 1;
+    for (int64_t i = 0; i < num_helpers; ++i) {
+        scheduler->Schedule([state]() { state->Work(); });
+    }
+    state->Work();
+
+    std::unique_lock<std::mutex> lock(state->mutex_);
+    state->done_cv_.wait(lock, [&state]() {
+        return state->num_done_.load() == state->num_chunks_;
+    });
+    if (state->exception_) {
+        std::rethrow_exception(state->exception_);
+    }
+}
+
+void ParallelRadixSort(std::vector<uint64_t>& keys,
+                       std::vector<int64_t>& values,
+                       int num_key_bits) {
+    if (keys.size() != values.size()) {
+        LogError("[ParallelRadixSort] {} keys but {} values.", keys.size(),
+                 values.size());
+    }
+    const int kDigitBits = 8;
+    const int64_t kNumDigits = int64_t(1) << kDigitBits;
+    const int64_t num_items = int64_t(keys.size());
+    const int num_passes =
+            (std::min(std::max(num_key_bits, 0), 64) + kDigitBits - 1) /
+            kDigitBits;
+    if (num_items < 2 || num_passes == 0) {
+        return;
+    }
+
+    // Every pass splits the items in the same chunks, so that the scatter of
+    // a chunk can start at offsets computed from the chunk histograms.
+    const int64_t num_chunks = std::max(
+            int64_t(1), std::min(int64_t(GetMaxThreads()) * kChunksPerThread,
+                                 num_items / 4096));
+    const int64_t chunk_size = (num_items + num_chunks - 1) / num_chunks;
+    std::vector<int64_t> offsets(num_chunks * kNumDigits);
+    std::vector<uint64_t> sorted_keys(num_items);
+    std::vector<int64_t> sorted_values(num_items);
+    for (int pass = 0; pass < num_passes; pass++) {
+        const int shift = pass * kDigitBits;
+        ParallelForEach(0, num_chunks, [&](int64_t c) {
+            int64_t* histogram = offsets.data() + c * kNumDigits;
+            std::fill(histogram, histogram + kNumDigits, 0);
+            int64_t end = std::min(num_items, (c + 1) * chunk_size);
+            for (int64_t i = c * chunk_size; i < end; i++) {
+                histogram[(keys[i] >> shift) & (kNumDigits - 1)]++;
+            }
+        });
+        // Digit-major exclusive scan over the chunk histograms. A pass where
+        // all keys share the digit leaves the order unchanged.
+        bool single_digit = false;
+        int64_t offset = 0;
+        for (int64_t d = 0; d < kNumDigits; d++) {
+            int64_t digit_count = 0;
+            for (int64_t c = 0; c < num_chunks; c++) {
+                int64_t count = offsets[c * kNumDigits + d];
+                offsets[c * kNumDigits + d] = offset;
+                offset += count;
+                digit_count += count;
+            }
+            single_digit = single_digit || digit_count == num_items;
+        }
+        if (single_digit) {
+            continue;
+        }
+        ParallelForEach(0, num_chunks, [&](int64_t c) {
+            int64_t* chunk_offsets = offsets.data() + c * kNumDigits;
+            int64_t end = std::min(num_items, (c + 1) * chunk_size);
+            for (int64_t i = c * chunk_size; i < end; i++) {
+                int64_t pos =
+                        chunk_offsets[(keys[i] >> shift) & (kNumDigits - 1)]++;
+                sorted_keys[pos] = keys[i];
+                sorted_values[pos] = values[i];
+            }
+        });
+        keys.swap(sorted_keys);
+        values.swap(sorted_values);
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
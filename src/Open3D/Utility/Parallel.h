@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Utility/ThreadPool.h"
+
+namespace open3d {
+namespace utility {
+
+/// Returns the maximum number of threads a parallel loop uses, including the
+/// calling thread. Defaults to omp_get_max_threads() (or the hardware
+/// concurrency without OpenMP) and is capped by the size of the current
+/// TaskScheduler plus one.
+int GetMaxThreads();
+
+/// Caps the number of threads used by parallel loops. \p num_threads <= 0
+/// restores the default. When the default ThreadPool is in use, it is resized
+/// to \p num_threads - 1 workers.
+void SetMaxThreads(int num_threads);
+
+/// Returns true if the calling thread is executing the body of a
+/// ParallelFor() or an OpenMP parallel region.
+bool InParallel();
+
+/// Binds Open3D's parallel loops to \p scheduler, e.g. an adapter for the
+/// application's own thread pool. Loops already running keep their
+/// scheduler. nullptr restores Open3D's default ThreadPool.
+void SetTaskScheduler(std::shared_ptr<TaskScheduler> scheduler);
+
+/// Returns the scheduler parallel loops currently run on. The default
+/// ThreadPool is created on first use.
+std::shared_ptr<TaskScheduler> GetTaskScheduler();
+
+/// \brief Runs \p range_func(start, end) on disjoint chunks covering
+/// [\p begin, \p end).
+///
+/// Chunks hold at least \p grain_size iterations (except the last one) and
+/// are claimed dynamically by the calling thread and up to \p max_threads - 1
+/// scheduler threads, so uneven iterations are balanced. \p max_threads <= 0
+/// means GetMaxThreads(). Nested calls are allowed and share the same
+/// scheduler threads instead of spawning new ones. Calls from inside an OpenMP
+/// parallel region run on the calling thread. The first exception thrown
+/// by \p range_func is rethrown on the calling thread after the other chunks
+/// have stopped.
+void ParallelFor(int64_t begin,
+                 int64_t end,
+                 int64_t grain_size,
+                 const std::function<void(int64_t, int64_t)>& range_func,
+                 int max_threads = 0);
+
+/// \brief Runs \p func(i) for every i in [\p begin, \p end) in parallel.
+///
+/// Equivalent to `#pragma omp parallel for schedule(dynamic, grain_size)`.
+template <typename func_t>
+void ParallelForEach(int64_t begin,
+                     int64_t end,
+                     func_t func,
+                     int64_t grain_size = 1,
+                     int max_threads = 0) {
+    ParallelFor(
+            begin, end, grain_size,
+            [&func](int64_t start, int64_t stop) {
+                for (int64_t i = start; i < stop; ++i) {
+                    func(i);
+                }
+            },
+            max_threads);
+}
+
+/// \brief Sorts \p keys in ascending order and applies the same permutation
+/// to \p values.
+///
+/// A stable least significant digit radix sort whose histogram and scatter
+/// passes are split among the threads. Only the lowest \p num_key_bits bits
+/// of the keys are sorted on, so narrow keys take fewer passes.
+void ParallelRadixSort(std::vector<uint64_t>& keys,
+                       std::vector<int64_t>& values,
+                       int num_key_bits = 64);
+
+}  // namespace utility
+}  // namespace open3d
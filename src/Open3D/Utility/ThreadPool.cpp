@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/ThreadPool.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// The pool and worker index of the current thread, if it is a pool worker.
+thread_local const ThreadPool* tls_pool = nullptr;
+thread_local int tls_worker_idx = -1;
+
+}  // unnamed namespace
+
+ThreadPool::ThreadPool(int num_threads)
+    : next_queue_(0), num_pending_(0), stop_(false) {
+    if (num_threads < 1) {
+        LogError("ThreadPool requires at least one thread, but {} is given.",
+                 num_threads);
+    }
+    for (int i = 0; i < num_threads; ++i) {
+        queues_.emplace_back(new WorkQueue());
+    }
+    for (int i = 0; i < num_threads; ++i) {
+        threads_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    sleep_cv_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+int ThreadPool::GetNumThreads() const {
+    return static_cast<int>(threads_.size());
+}
+
+void ThreadPool::Schedule(std::function<void()> task) {
+    int queue_idx;
+    if (tls_pool == this) {
+        queue_idx = tls_worker_idx;
+    } else {
+        queue_idx = static_cast<int>(
+                next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                queues_.size());
+    }
+    // Counted before the push, so that a worker never misses a task it could
+    // pop. A worker woken early simply retries.
+    num_pending_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(queues_[queue_idx]->mutex_);
+        queues_[queue_idx]->tasks_.push_back(std::move(task));
+    }
+    {
+        // Taking the lock orders the notification after a sleeping worker's
+        // predicate check.
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    sleep_cv_.notify_one();
+}
+
+bool ThreadPool::TryPop(int worker_idx, std::function<void()>& task) {
+    {
+        WorkQueue& own = *queues_[worker_idx];
+        std::lock_guard<std::mutex> lock(own.mutex_);
+        if (!own.tasks_.empty()) {
+            task = std::move(own.tasks_.back());
+            own.tasks_.pop_back();
+            return true;
+        }
+    }
+    const int num_queues = static_cast<int>(queues_.size());
+    for (int offset = 1; offset < num_queues; ++offset) {
+        WorkQueue& victim = *queues_[(worker_idx + offset) % num_queues];
+        std::lock_guard<std::mutex> lock(victim.mutex_);
+        if (!victim.tasks_.empty()) {
+            task = std::move(victim.tasks_.front());
+            victim.tasks_.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::WorkerLoop(int worker_idx) {
+    tls_pool = this;
+    tls_worker_idx = worker_idx;
+    std::function<void()> task;
+    while (true) {
+        if (TryPop(worker_idx, task)) {
+            num_pending_.fetch_sub(1);
+            try {
+                task();
+            } catch (const std::exception& e) {
+                LogWarning("Exception in ThreadPool task: {}", e.what());
+            }
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        sleep_cv_.wait(lock,
+                       [this]() { return stop_ || num_pending_.load() > 0; });
+        if (stop_ && num_pending_.load() <= 0) {
+            return;
+        }
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// \class TaskScheduler
+///
+/// \brief Executor for the tasks spawned by ParallelFor().
+///
+/// Implement this interface to run Open3D's parallel loops on an
+/// application-provided thread pool, see SetTaskScheduler(). ParallelFor()
+/// never blocks on a scheduled task: the calling thread processes all work
+/// that has not been picked up, so a busy or single-threaded scheduler only
+/// reduces parallelism.
+class TaskScheduler {
+public:
+    virtual ~TaskScheduler() {}
+
+    /// Number of threads executing scheduled tasks.
+    virtual int GetNumThreads() const = 0;
+
+    /// Enqueues \p task to be run asynchronously. Must not wait for the task.
+    virtual void Schedule(std::function<void()> task) = 0;
+};
+
+/// \class ThreadPool
+///
+/// \brief Work-stealing thread pool, the default TaskScheduler.
+///
+/// Each worker owns a task deque. Tasks scheduled from a worker go to the
+/// back of its own deque and are popped LIFO, which keeps nested loops on
+/// warm caches. Tasks scheduled from other threads are distributed round
+/// robin. Idle workers steal from the front of the other deques.
+class ThreadPool : public TaskScheduler {
+public:
+    /// Starts \p num_threads workers.
+    explicit ThreadPool(int num_threads);
+    /// Runs the remaining tasks and joins the workers.
+    ~ThreadPool() override;
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int GetNumThreads() const override;
+    void Schedule(std::function<void()> task) override;
+
+private:
+    struct WorkQueue {
+        std::mutex mutex_;
+        std::deque<std::function<void()>> tasks_;
+    };
+
+    void WorkerLoop(int worker_idx);
+    bool TryPop(int worker_idx, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<uint32_t> next_queue_;
+    /// Number of scheduled tasks not yet popped.
+    std::atomic<int64_t> num_pending_;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    bool stop_;
+};
+
+}  // namespace utility
+}  // namespace open3d
@@ -4,16 +4,22 @@ import numpy as np
 
 
 def _numpy_dtype_to_dtype(numpy_dtype):
-    if numpy_dtype == np.float32:
+    if numpy_dtype == np.float16:
+        return o3d.Dtype.Float16
+    elif numpy_dtype == np.float32:
         return o3d.Dtype.Float32
     elif numpy_dtype == np.float64:
         return o3d.Dtype.Float64
+    elif numpy_dtype == np.int16:
+        return o3d.Dtype.Int16
     elif numpy_dtype == np.int32:
         return o3d.Dtype.Int32
     elif numpy_dtype == np.int64:
         return o3d.Dtype.Int64
     elif numpy_dtype == np.uint8:
         return o3d.Dtype.UInt8
+    elif numpy_dtype == np.uint16:
+        return o3d.Dtype.UInt16
     elif numpy_dtype == np.bool:
         return o3d.Dtype.Bool
     else:
@@ -229,6 +235,31 @@ class Tensor(open3d_pybind.Tensor):
         """
         return super(Tensor, Tensor).from_dlpack(dlpack)
 
+    @staticmethod
+    @cast_to_py_tensor
+    def load(file_name, mmap=False):
+        """
+        Loads a tensor from a NumPy .npy file, or from a .npz file holding a
+        single array. The result is a CPU tensor.
+
+        Args:
+            file_name: Path to the .npy or .npz file.
+            mmap: If True, the tensor is backed by a copy-on-write memory
+                mapping of the file, so that large files open instantly and are
+                read on demand. Modifications are not written back.
+        """
+        return super(Tensor, Tensor).load(file_name, mmap)
+
+    def save(self, file_name):
+        """
+        Saves this tensor to a NumPy .npy or .npz file, chosen by the file
+        extension. The file can be read with numpy.load().
+
+        Args:
+            file_name: Path to the .npy or .npz file.
+        """
+        return super(Tensor, self).save(file_name)
+
     @cast_to_py_tensor
     def add(self, value):
         """
@@ -611,6 +642,74 @@ class Tensor(open3d_pybind.Tensor):
             raise TypeError(f"dim must be int or None, but got {dim}")
         return super(Tensor, self).argmax_(dim)
 
+    @cast_to_py_tensor
+    def mean(self, dim=None, keepdim=False):
+        """
+        Returns the mean along each the specified dimension `dim`. If `dim` is
+        None, the reduction happens for all elements of the tensor. If `dim` is
+        a list or tuple, the reduction happens in all of the specified `dim`.
+
+        Only float16, float32 and float64 tensors are supported. float16
+        tensors are accumulated in float32.
+        """
+        dim = self._reduction_dim_to_size_vector(dim)
+        return super(Tensor, self).mean(dim, keepdim)
+
+    @cast_to_py_tensor
+    def var(self, dim=None, keepdim=False, ddof=0):
+        """
+        Returns the variance along each the specified dimension `dim`, with
+        `N - ddof` degrees of freedom, where N is the number of reduced
+        elements. If `dim` is None, the reduction happens for all elements of
+        the tensor. If `dim` is a list or tuple, the reduction happens in all
+        of the specified `dim`.
+
+        Only float16, float32 and float64 tensors are supported. float16
+        tensors are accumulated in float32.
+        """
+        dim = self._reduction_dim_to_size_vector(dim)
+        return super(Tensor, self).var(dim, keepdim, ddof)
+
+    @cast_to_py_tensor
+    def std(self, dim=None, keepdim=False, ddof=0):
+        """
+        Returns the standard deviation along each the specified dimension
+        `dim`, with `N - ddof` degrees of freedom. See `var`.
+        """
+        dim = self._reduction_dim_to_size_vector(dim)
+        return super(Tensor, self).std(dim, keepdim, ddof)
+
+    @cast_to_py_tensor
+    def any(self, dim=None, keepdim=False):
+        """
+        Returns a boolean tensor, true where any element along the specified
+        dimension `dim` is non-zero. If `dim` is None, the reduction happens
+        for all elements of the tensor.
+        """
+        dim = self._reduction_dim_to_size_vector(dim)
+        return super(Tensor, self).any(dim, keepdim)
+
+    @cast_to_py_tensor
+    def all(self, dim=None, keepdim=False):
+        """
+        Returns a boolean tensor, true where all elements along the specified
+        dimension `dim` are non-zero. If `dim` is None, the reduction happens
+        for all elements of the tensor.
+        """
+        dim = self._reduction_dim_to_size_vector(dim)
+        return super(Tensor, self).all(dim, keepdim)
+
+    @cast_to_py_tensor
+    def matmul(self, other):
+        """
+        Matrix product with the same semantics as numpy.matmul: 1-D operands
+        are promoted to matrices and leading batch dimensions are broadcasted.
+        """
+        return super(Tensor, self).matmul(other)
+
+    def __matmul__(self, other):
+        return self.matmul(other)
+
     def __lt__(self, value):
         return self.lt(value)
 
@@ -30,6 +30,7 @@
 void pybind_core(py::module &m) {
     pybind_cuda_utils(m);
     pybind_core_blob(m);
+    pybind_core_memory_manager(m);
     pybind_core_dtype(m);
     pybind_core_device(m);
     pybind_core_size_vector(m);
@@ -32,6 +32,7 @@ void pybind_core(py::module& m);
 
 void pybind_cuda_utils(py::module& m);
 void pybind_core_blob(py::module& m);
+void pybind_core_memory_manager(py::module& m);
 void pybind_core_dtype(py::module& m);
 void pybind_core_device(py::module& m);
 void pybind_core_size_vector(py::module& m);
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d_pybind/core/container.h"
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/open3d_pybind.h"
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/MemoryManager.h"
+
+using namespace open3d;
+
+void pybind_core_memory_manager(py::module &m) {
+    py::class_<MemoryStatistics> memory_statistics(
+            m, "MemoryStatistics",
+            "Allocation statistics of a device memory manager in bytes. "
+            "Only allocations made while the cache is enabled are counted.");
+    memory_statistics.def(py::init<>())
+            .def_readonly("bytes_in_use", &MemoryStatistics::bytes_in_use_)
+            .def_readonly("peak_bytes_in_use",
+                          &MemoryStatistics::peak_bytes_in_use_)
+            .def_readonly("bytes_cached", &MemoryStatistics::bytes_cached_)
+            .def_readonly("num_mallocs", &MemoryStatistics::num_mallocs_)
+            .def_readonly("num_cache_hits",
+                          &MemoryStatistics::num_cache_hits_)
+            .def_property_readonly("hit_rate", &MemoryStatistics::HitRate)
+            .def("__repr__", [](const MemoryStatistics &stats) {
+                return fmt::format(
+                        "MemoryStatistics(bytes_in_use={}, "
+                        "peak_bytes_in_use={}, bytes_cached={}, "
+                        "num_mallocs={}, num_cache_hits={})",
+                        stats.bytes_in_use_, stats.peak_bytes_in_use_,
+                        stats.bytes_cached_, stats.num_mallocs_,
+                        stats.num_cache_hits_);
+            });
+
+    py::class_<MemoryManager> memory_manager(
+            m, "MemoryManager",
+            "Allocates and frees device memory, optionally through a caching "
+            "allocator.");
+    memory_manager
+            .def_static("set_cache_enabled", &MemoryManager::SetCacheEnabled,
+                        "Enable or disable the caching allocator of a device.",
+                        "device"_a, "enabled"_a)
+            .def_static("is_cache_enabled", &MemoryManager::IsCacheEnabled,
+                        "Returns True if the caching allocator of a device "
+                        "is enabled.",
+                        "device"_a)
+            .def_static("set_cache_high_water_mark",
+                        &MemoryManager::SetCacheHighWaterMark,
+                        "Set the maximum number of bytes the cache of a "
+                        "device may hold.",
+                        "device"_a, "byte_size"_a)
+            .def_static("release_cache", &MemoryManager::ReleaseCache,
+                        "Return all cached memory of a device to the system.",
+                        "device"_a)
+            .def_static("get_statistics", &MemoryManager::GetStatistics,
+                        "Returns the allocation statistics of a device.",
+                        "device"_a);
+}
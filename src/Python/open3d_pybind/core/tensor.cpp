@@ -53,13 +53,27 @@ void bind_templated_constructor(py::class_<Tensor>& tensor) {
 }
 
 template <typename T>
-static std::vector<T> ToFlatVector(
-        py::array_t<T, py::array::c_style | py::array::forcecast> np_array) {
-    py::buffer_info info = np_array.request();
+static std::vector<T> ToFlatVector(py::array np_array) {
+    auto np_array_t =
+            py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(
+                    np_array);
+    if (!np_array_t) {
+        utility::LogError("Cannot convert numpy array to {}.",
+                          DtypeUtil::ToString(DtypeUtil::FromType<T>()));
+    }
+    py::buffer_info info = np_array_t.request();
     T* start = static_cast<T*>(info.ptr);
     return std::vector<T>(start, start + info.size);
 }
 
+/// pybind11 has no buffer format for Half, so Float16 values are read through
+/// float and rounded.
+template <>
+std::vector<Half> ToFlatVector<Half>(py::array np_array) {
+    std::vector<float> values = ToFlatVector<float>(np_array);
+    return std::vector<Half>(values.begin(), values.end());
+}
+
 void pybind_core_tensor(py::module& m) {
     py::class_<Tensor, std::shared_ptr<Tensor>> tensor(
             m, "Tensor",
@@ -232,6 +246,9 @@ void pybind_core_tensor(py::module& m) {
         return t;
     });
 
+    tensor.def_static("load", &Tensor::Load, "file_name"_a, "mmap"_a = false);
+    tensor.def("save", &Tensor::Save, "file_name"_a);
+
     tensor.def("_getitem", [](const Tensor& tensor, const TensorKey& tk) {
         return tensor.GetItem(tk);
     });
@@ -384,6 +401,13 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("max", &Tensor::Max);
     tensor.def("argmin_", &Tensor::ArgMin);
     tensor.def("argmax_", &Tensor::ArgMax);
+    tensor.def("mean", &Tensor::Mean);
+    tensor.def("var", &Tensor::Var);
+    tensor.def("std", &Tensor::Std);
+    tensor.def("any", &Tensor::Any);
+    tensor.def("all", &Tensor::All);
+
+    tensor.def("matmul", &Tensor::Matmul);
 
     tensor.def("__repr__",
                [](const Tensor& tensor) { return tensor.ToString(); });
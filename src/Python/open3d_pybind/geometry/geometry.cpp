@@ -208,4 +208,6 @@ void pybind_geometry(py::module &m) {
     pybind_octree_methods(m_submodule);
     pybind_octree(m_submodule);
     pybind_boundingvolume(m_submodule);
+    pybind_tiledpointcloud(m_submodule);
+    pybind_linearoctree(m_submodule);
 }
@@ -48,3 +48,5 @@ void pybind_image_methods(py::module &m);
 void pybind_octree_methods(py::module &m);
 void pybind_octree(py::module &m);
 void pybind_boundingvolume(py::module &m);
+void pybind_tiledpointcloud(py::module &m);
+void pybind_linearoctree(py::module &m);
@@ -58,6 +58,20 @@ void pybind_kdtreeflann(py::module &m) {
             }),
             py::none(), py::none(), "");
 
+    // open3d.geometry.NeighborSearchBackend
+    py::enum_<geometry::NeighborSearchBackend> neighbor_search_backend(
+            m, "NeighborSearchBackend", py::arithmetic());
+    neighbor_search_backend
+            .value("KDTree", geometry::NeighborSearchBackend::KDTree)
+            .value("HashGrid", geometry::NeighborSearchBackend::HashGrid)
+            .export_values();
+    neighbor_search_backend.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Spatial index used by point cloud functions with "
+                       "fixed radius neighborhoods.";
+            }),
+            py::none(), py::none(), "");
+
     // open3d.geometry.KDTreeSearchParamKNN
     py::class_<geometry::KDTreeSearchParamKNN> kdtreesearchparam_knn(
             m, "KDTreeSearchParamKNN", kdtreesearchparam,
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/LinearOctree.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+using namespace open3d;
+
+void pybind_linearoctree(py::module &m) {
+    static const std::unordered_map<std::string, std::string>
+            map_linear_octree_docs = {
+                    {"cloud", "The input point cloud."},
+                    {"max_depth", "Maximum depth of the nodes, at most 21."},
+                    {"max_leaf_points",
+                     "Nodes with at most this many points are not "
+                     "subdivided."},
+                    {"sample_depth",
+                     "Each node owns at most one point per cell of "
+                     "2^-sample_depth times its size."},
+                    {"node", "Index of the node."},
+                    {"nodes", "Indices of the nodes."},
+                    {"depth", "Maximum depth of the nodes to extract."},
+                    {"camera_position", "Position of the camera."},
+                    {"view_projection",
+                     "Product of the projection and view matrices, with "
+                     "OpenGL clip space conventions."},
+                    {"min_angular_spacing",
+                     "Nodes are refined while the spacing of their points "
+                     "seen from the camera exceeds this angle in radians."},
+                    {"max_points", "Maximum number of points selected."}};
+
+    // open3d.geometry.LinearOctree
+    py::class_<geometry::LinearOctree, std::shared_ptr<geometry::LinearOctree>>
+            linearoctree(m, "LinearOctree",
+                         "Pointer-free octree over a point cloud with "
+                         "level-of-detail samples in every node.");
+    py::class_<geometry::LinearOctree::Node> node(
+            linearoctree, "Node", "A node of the linear octree.");
+    node.def_readonly("code", &geometry::LinearOctree::Node::code_,
+                      "Morton code of the cell of the node.")
+            .def_readonly("depth", &geometry::LinearOctree::Node::depth_,
+                          "Depth of the node.")
+            .def_readonly("num_children",
+                          &geometry::LinearOctree::Node::num_children_,
+                          "Number of children.")
+            .def_readonly("first_child",
+                          &geometry::LinearOctree::Node::first_child_,
+                          "Index of the first child.")
+            .def_readonly("point_begin",
+                          &geometry::LinearOctree::Node::point_begin_,
+                          "Index of the first point owned by the node.")
+            .def_readonly("point_end",
+                          &geometry::LinearOctree::Node::point_end_,
+                          "Index past the last point owned by the node.");
+    linearoctree
+            .def("__repr__",
+                 [](const geometry::LinearOctree &octree) {
+                     return std::string("geometry::LinearOctree with ") +
+                            std::to_string(octree.GetNodes().size()) +
+                            " nodes and " +
+                            std::to_string(octree.GetPoints().size()) +
+                            " points.";
+                 })
+            .def_static("create_from_point_cloud",
+                        &geometry::LinearOctree::CreateFromPointCloud,
+                        "Builds the octree of a point cloud.", "cloud"_a,
+                        "max_depth"_a = 12, "max_leaf_points"_a = 256,
+                        "sample_depth"_a = 5)
+            .def_property_readonly("max_depth",
+                                   &geometry::LinearOctree::GetMaxDepth)
+            .def_property_readonly("sample_depth",
+                                   &geometry::LinearOctree::GetSampleDepth)
+            .def_property_readonly("origin", &geometry::LinearOctree::GetOrigin)
+            .def_property_readonly("size", &geometry::LinearOctree::GetSize)
+            .def_property_readonly("nodes", &geometry::LinearOctree::GetNodes)
+            .def_property_readonly("point_indices",
+                                   &geometry::LinearOctree::GetPointIndices)
+            .def("is_empty", &geometry::LinearOctree::IsEmpty,
+                 "Returns ``True`` if the octree has no nodes.")
+            .def("get_node_bounds", &geometry::LinearOctree::GetNodeBounds,
+                 "Returns the minimum corner and the edge length of the cell "
+                 "of a node.",
+                 "node"_a)
+            .def("extract_points_up_to_depth",
+                 &geometry::LinearOctree::ExtractPointsUpToDepth,
+                 "Returns the points owned by the nodes up to a depth.",
+                 "depth"_a)
+            .def("extract_points", &geometry::LinearOctree::ExtractPoints,
+                 "Returns the points owned by nodes.", "nodes"_a)
+            .def("select_nodes", &geometry::LinearOctree::SelectNodes,
+                 "Selects the nodes to display for a view, coarse nodes "
+                 "first.",
+                 "camera_position"_a, "view_projection"_a,
+                 "min_angular_spacing"_a, "max_points"_a);
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "create_from_point_cloud",
+                                    map_linear_octree_docs);
+    docstring::ClassMethodDocInject(m, "LinearOctree", "is_empty",
+                                    map_linear_octree_docs);
+    docstring::ClassMethodDocInject(m, "LinearOctree", "get_node_bounds",
+                                    map_linear_octree_docs);
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "extract_points_up_to_depth",
+                                    map_linear_octree_docs);
+    docstring::ClassMethodDocInject(m, "LinearOctree", "extract_points",
+                                    map_linear_octree_docs);
+    docstring::ClassMethodDocInject(m, "LinearOctree", "select_nodes",
+                                    map_linear_octree_docs);
+}
@@ -46,6 +46,14 @@ void pybind_pointcloud(py::module &m) {
                        "normals.");
     py::detail::bind_default_constructor<geometry::PointCloud>(pointcloud);
     py::detail::bind_copy_functions<geometry::PointCloud>(pointcloud);
+    py::enum_<geometry::PointCloud::VoxelAggregation>(
+            pointcloud, "VoxelAggregation",
+            "How voxel_down_sample reduces the points of a voxel.")
+            .value("Centroid", geometry::PointCloud::VoxelAggregation::Centroid)
+            .value("NearestToCenter",
+                   geometry::PointCloud::VoxelAggregation::NearestToCenter)
+            .value("Random", geometry::PointCloud::VoxelAggregation::Random)
+            .export_values();
     pointcloud
             .def(py::init<const std::vector<Eigen::Vector3d> &>(),
                  "Create a PointCloud from points", "points"_a)
@@ -74,8 +82,11 @@ void pybind_pointcloud(py::module &m) {
             .def("voxel_down_sample", &geometry::PointCloud::VoxelDownSample,
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
-                 "a voxel. Normals and colors are averaged if they exist.",
-                 "voxel_size"_a)
+                 "a voxel. Normals and colors are reduced with the points if "
+                 "they exist.",
+                 "voxel_size"_a,
+                 "aggregation"_a =
+                         geometry::PointCloud::VoxelAggregation::Centroid)
             .def("voxel_down_sample_and_trace",
                  &geometry::PointCloud::VoxelDownSampleAndTrace,
                  "Function to downsample using "
@@ -113,7 +124,8 @@ void pybind_pointcloud(py::module &m) {
                  &geometry::PointCloud::RemoveRadiusOutliers,
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
-                 "nb_points"_a, "radius"_a)
+                 "nb_points"_a, "radius"_a,
+                 "backend"_a = geometry::NeighborSearchBackend::KDTree)
             .def("remove_statistical_outlier",
                  &geometry::PointCloud::RemoveStatisticalOutliers,
                  "Function to remove points that are further away from their "
@@ -125,6 +137,15 @@ void pybind_pointcloud(py::module &m) {
                  "normals exist",
                  "search_param"_a = geometry::KDTreeSearchParamKNN(),
                  "fast_normal_computation"_a = true)
+            .def("estimate_normals_organized",
+                 &geometry::PointCloud::EstimateNormalsOrganized,
+                 "Function to compute the normals of an organized point cloud "
+                 "from its image-grid neighbors, without a KDTree. Normals "
+                 "are oriented with respect to the input point cloud if "
+                 "normals exist",
+                 "width"_a, "height"_a, "window_radius"_a = 2,
+                 "max_neighbor_distance"_a = 0.0,
+                 "fast_normal_computation"_a = true)
             .def("orient_normals_to_align_with_direction",
                  &geometry::PointCloud::OrientNormalsToAlignWithDirection,
                  "Function to orient the normals of a point cloud",
@@ -171,11 +192,19 @@ void pybind_pointcloud(py::module &m) {
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
-                 "eps"_a, "min_points"_a, "print_progress"_a = false)
+                 "eps"_a, "min_points"_a, "print_progress"_a = false,
+                 "backend"_a = geometry::NeighborSearchBackend::KDTree)
             .def("segment_plane", &geometry::PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999, "seed"_a = -1)
+            .def("segment_planes", &geometry::PointCloud::SegmentPlanes,
+                 "Segments planes one after the other in the point cloud "
+                 "using the RANSAC algorithm.",
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "max_planes"_a, "min_num_inliers"_a = 3,
+                 "probability"_a = 0.99999999, "seed"_a = -1)
             .def_static(
                     "create_from_depth_image",
                     &geometry::PointCloud::CreateFromDepthImage,
@@ -230,7 +259,10 @@ void pybind_pointcloud(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample",
             {{"voxel_size", "Voxel size to downsample into."},
-             {"invert", "set to ``True`` to invert the selection of indices"}});
+             {"aggregation",
+              "Centroid averages the points of a voxel, NearestToCenter keeps "
+              "the point closest to the voxel center and Random keeps a "
+              "pseudo-random point."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample_and_trace",
             {{"voxel_size", "Voxel size to downsample into."},
@@ -251,7 +283,8 @@ void pybind_pointcloud(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "PointCloud", "remove_radius_outlier",
             {{"nb_points", "Number of points within the radius."},
-             {"radius", "Radius of the sphere."}});
+             {"radius", "Radius of the sphere."},
+             {"backend", "Spatial index used for the neighbor search."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "remove_statistical_outlier",
             {{"nb_neighbors", "Number of neighbors around the target point."},
@@ -264,6 +297,22 @@ void pybind_pointcloud(py::module &m) {
               "If true, the normal estiamtion uses a non-iterative method to "
               "extract the eigenvector from the covariance matrix. This is "
               "faster, but is not as numerical stable."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "estimate_normals_organized",
+            {{"width",
+              "Width of the image grid. The points must hold one point per "
+              "pixel in row-major order, with NaN points for pixels without "
+              "depth."},
+             {"height", "Height of the image grid."},
+             {"window_radius",
+              "The neighbors are searched in a window spanning 2 * "
+              "window_radius + 1 pixels in each direction."},
+             {"max_neighbor_distance",
+              "Window points farther than this from the center are not "
+              "neighbors. A non-positive value disables the check."},
+             {"fast_normal_computation",
+              "If true, the normal estimation uses a non-iterative method to "
+              "extract the eigenvector from the covariance matrix."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "orient_normals_to_align_with_direction",
             {{"orientation_reference",
@@ -295,7 +344,8 @@ void pybind_pointcloud(py::module &m) {
               "Density parameter that is used to find neighbouring points."},
              {"min_points", "Minimum number of points to form a cluster."},
              {"print_progress",
-              "If true the progress is visualized in the console."}});
+              "If true the progress is visualized in the console."},
+             {"backend", "Spatial index used for the neighbor search."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "segment_plane",
             {{"distance_threshold",
@@ -304,7 +354,31 @@ void pybind_pointcloud(py::module &m) {
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Confidence of having sampled the best plane at which the "
+              "iterations stop. 1 runs all iterations."},
+             {"seed",
+              "Seed of the random samples. A negative seed draws a random "
+              "one."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"distance_threshold",
+              "Max distance a point can be from a plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations per plane."},
+             {"max_planes", "Maximum number of planes."},
+             {"min_num_inliers",
+              "The extraction stops at the first plane with fewer inliers."},
+             {"probability",
+              "Confidence of having sampled the best plane at which the "
+              "iterations stop. 1 runs all iterations."},
+             {"seed",
+              "Seed of the random samples. A negative seed draws a random "
+              "one."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
@@ -0,0 +1,197 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TiledPointCloud.h"
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+using namespace open3d;
+
+void pybind_tiledpointcloud(py::module &m) {
+    static const std::unordered_map<std::string, std::string>
+            map_tiled_point_cloud_docs = {
+                    {"directory", "Directory of the tiled point cloud."},
+                    {"output_directory",
+                     "Directory of the result, which must differ from the "
+                     "directory of the input."},
+                    {"tile_size", "Edge length of the cubic tiles."},
+                    {"has_normals", "Whether the points carry normals."},
+                    {"has_colors", "Whether the points carry colors."},
+                    {"memory_budget",
+                     "Maximum size in bytes of the points buffered by the "
+                     "writers."},
+                    {"cloud", "Points to add."},
+                    {"tile", "Position of the tile in ``tiles``."},
+                    {"halo",
+                     "Margin around each tile within which the points of "
+                     "the neighboring tiles are read."},
+                    {"voxel_size", "Voxel size to downsample into."},
+                    {"bounding_box", "Bounding box to crop the points to."},
+                    {"nb_neighbors",
+                     "Number of neighbors around the target point."},
+                    {"std_ratio", "Standard deviation ratio."},
+                    {"search_param",
+                     "The KDTree search parameters for neighborhood search."},
+                    {"fast_normal_computation",
+                     "If true, the normal estimation uses a non-iterative "
+                     "method to extract the eigenvector from the covariance "
+                     "matrix. This is faster, but is not as numerical "
+                     "stable."}};
+
+    // open3d.geometry.TiledPointCloudWriter
+    py::class_<geometry::TiledPointCloudWriter> writer(
+            m, "TiledPointCloudWriter",
+            "Writes a TiledPointCloud from point chunks of any size.");
+    writer.def(py::init<const std::string &, double, bool, bool, int64_t>(),
+               "directory"_a, "tile_size"_a, "has_normals"_a = false,
+               "has_colors"_a = false, "memory_budget"_a = int64_t(256) << 20)
+            .def("add_points", &geometry::TiledPointCloudWriter::AddPoints,
+                 "Adds points, which must have normals and colors as "
+                 "declared in the constructor.",
+                 "cloud"_a)
+            .def("close", &geometry::TiledPointCloudWriter::Close,
+                 "Flushes the buffers, writes the index and returns the "
+                 "finished tiled point cloud.");
+    docstring::ClassMethodDocInject(m, "TiledPointCloudWriter", "add_points",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloudWriter", "close",
+                                    map_tiled_point_cloud_docs);
+
+    // open3d.geometry.TiledPointCloud
+    py::class_<geometry::TiledPointCloud,
+               std::shared_ptr<geometry::TiledPointCloud>>
+            tiled(m, "TiledPointCloud",
+                  "Point cloud stored on disk as a grid of cubic tiles, for "
+                  "clouds that do not fit in memory. The processing "
+                  "functions stream the cloud tile by tile and write their "
+                  "result as a new tiled point cloud.");
+    py::class_<geometry::TiledPointCloud::Tile> tile(
+            tiled, "Tile", "A non-empty tile of the grid.");
+    tile.def_readonly("index", &geometry::TiledPointCloud::Tile::index_,
+                      "Integer coordinates of the tile in the grid.")
+            .def_readonly("num_points",
+                          &geometry::TiledPointCloud::Tile::num_points_,
+                          "Number of points in the tile.");
+    tiled.def(py::init<const std::string &, int64_t>(), "directory"_a,
+              "memory_budget"_a = int64_t(256) << 20)
+            .def("__repr__",
+                 [](const geometry::TiledPointCloud &cloud) {
+                     return std::string("geometry::TiledPointCloud with ") +
+                            std::to_string(cloud.GetNumPoints()) +
+                            " points in " +
+                            std::to_string(cloud.GetTiles().size()) +
+                            " tiles.";
+                 })
+            .def_property_readonly("directory",
+                                   &geometry::TiledPointCloud::GetDirectory)
+            .def_property_readonly("tile_size",
+                                   &geometry::TiledPointCloud::GetTileSize)
+            .def_property_readonly("tiles",
+                                   &geometry::TiledPointCloud::GetTiles)
+            .def("has_normals", &geometry::TiledPointCloud::HasNormals,
+                 "Returns ``True`` if the points carry normals.")
+            .def("has_colors", &geometry::TiledPointCloud::HasColors,
+                 "Returns ``True`` if the points carry colors.")
+            .def("get_num_points", &geometry::TiledPointCloud::GetNumPoints,
+                 "Returns the number of points.")
+            .def("get_min_bound", &geometry::TiledPointCloud::GetMinBound,
+                 "Returns min bounds for the points.")
+            .def("get_max_bound", &geometry::TiledPointCloud::GetMaxBound,
+                 "Returns max bounds for the points.")
+            .def("read_tile", &geometry::TiledPointCloud::ReadTile,
+                 "Reads the points of a tile.", "tile"_a)
+            .def("read_tile_with_halo",
+                 &geometry::TiledPointCloud::ReadTileWithHalo,
+                 "Reads the points of a tile followed by its halo.", "tile"_a,
+                 "halo"_a)
+            .def("read_point_cloud",
+                 &geometry::TiledPointCloud::ReadPointCloud,
+                 "Reads all tiles into one point cloud.")
+            .def("voxel_down_sample",
+                 &geometry::TiledPointCloud::VoxelDownSample,
+                 "Downsamples the cloud with a voxel grid anchored at the "
+                 "bounds of the whole cloud.",
+                 "voxel_size"_a, "output_directory"_a)
+            .def("crop",
+                 (std::shared_ptr<geometry::TiledPointCloud>(
+                         geometry::TiledPointCloud::*)(
+                         const geometry::AxisAlignedBoundingBox &,
+                         const std::string &) const) &
+                         geometry::TiledPointCloud::Crop,
+                 "Writes the points inside the bounding box.",
+                 "bounding_box"_a, "output_directory"_a)
+            .def("crop",
+                 (std::shared_ptr<geometry::TiledPointCloud>(
+                         geometry::TiledPointCloud::*)(
+                         const geometry::OrientedBoundingBox &,
+                         const std::string &) const) &
+                         geometry::TiledPointCloud::Crop,
+                 "Writes the points inside the bounding box.",
+                 "bounding_box"_a, "output_directory"_a)
+            .def("remove_statistical_outlier",
+                 &geometry::TiledPointCloud::RemoveStatisticalOutliers,
+                 "Writes the points that are not further away from their "
+                 "neighbors than average.",
+                 "nb_neighbors"_a, "std_ratio"_a, "halo"_a,
+                 "output_directory"_a)
+            .def("estimate_normals",
+                 &geometry::TiledPointCloud::EstimateNormals,
+                 "Writes the cloud with estimated normals.", "search_param"_a,
+                 "halo"_a, "output_directory"_a,
+                 "fast_normal_computation"_a = true)
+            .def_static("remove", &geometry::TiledPointCloud::Remove,
+                        "Removes the files of a tiled point cloud, and its "
+                        "directory if it is then empty.",
+                        "directory"_a);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "has_normals",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "has_colors",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "get_num_points",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "get_min_bound",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "get_max_bound",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "read_tile",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "read_tile_with_halo",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "read_point_cloud",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "voxel_down_sample",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "crop",
+                                    map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(
+            m, "TiledPointCloud", "remove_statistical_outlier",
+            map_tiled_point_cloud_docs);
+    docstring::ClassMethodDocInject(m, "TiledPointCloud", "estimate_normals",
+                                    map_tiled_point_cloud_docs);
+}
@@ -36,17 +36,26 @@
 namespace open3d {
 namespace pybind_utils {
 
+/// Buffer format of numpy.float16. pybind11 has no format_descriptor for it.
+static const std::string kHalfFormat = "e";
+
 Dtype ArrayFormatToDtype(const std::string& format) {
-    if (format == py::format_descriptor<float>::format()) {
+    if (format == kHalfFormat) {
+        return Dtype::Float16;
+    } else if (format == py::format_descriptor<float>::format()) {
         return Dtype::Float32;
     } else if (format == py::format_descriptor<double>::format()) {
         return Dtype::Float64;
+    } else if (format == py::format_descriptor<int16_t>::format()) {
+        return Dtype::Int16;
     } else if (format == py::format_descriptor<int32_t>::format()) {
         return Dtype::Int32;
     } else if (format == py::format_descriptor<int64_t>::format()) {
         return Dtype::Int64;
     } else if (format == py::format_descriptor<uint8_t>::format()) {
         return Dtype::UInt8;
+    } else if (format == py::format_descriptor<uint16_t>::format()) {
+        return Dtype::UInt16;
     } else if (format == py::format_descriptor<bool>::format()) {
         return Dtype::Bool;
     } else {
@@ -55,16 +64,22 @@ Dtype ArrayFormatToDtype(const std::string& format) {
 }
 
 std::string DtypeToArrayFormat(const Dtype& dtype) {
-    if (dtype == Dtype::Float32) {
+    if (dtype == Dtype::Float16) {
+        return kHalfFormat;
+    } else if (dtype == Dtype::Float32) {
         return py::format_descriptor<float>::format();
     } else if (dtype == Dtype::Float64) {
         return py::format_descriptor<double>::format();
+    } else if (dtype == Dtype::Int16) {
+        return py::format_descriptor<int16_t>::format();
     } else if (dtype == Dtype::Int32) {
         return py::format_descriptor<int32_t>::format();
     } else if (dtype == Dtype::Int64) {
         return py::format_descriptor<int64_t>::format();
     } else if (dtype == Dtype::UInt8) {
         return py::format_descriptor<uint8_t>::format();
+    } else if (dtype == Dtype::UInt16) {
+        return py::format_descriptor<uint16_t>::format();
     } else if (dtype == Dtype::Bool) {
         return py::format_descriptor<bool>::format();
     } else {
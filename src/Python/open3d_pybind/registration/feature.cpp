@@ -65,9 +65,30 @@ void pybind_feature(py::module &m) {
 void pybind_feature_methods(py::module &m) {
     m.def("compute_fpfh_feature", &registration::ComputeFPFHFeature,
           "Function to compute FPFH feature for a point cloud", "input"_a,
-          "search_param"_a);
+          "search_param"_a,
+          "backend"_a = geometry::NeighborSearchBackend::KDTree);
     docstring::FunctionDocInject(
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
-             {"search_param", "KDTree KNN search parameter."}});
+             {"search_param", "KDTree KNN search parameter."},
+             {"backend",
+              "Spatial index used for the neighbor search. The hash grid only "
+              "supports radius and hybrid search parameters."}});
+
+    m.def("correspondences_from_features",
+          &registration::CorrespondencesFromFeatures,
+          "Function to match every source feature to its nearest target "
+          "feature",
+          "source_features"_a, "target_features"_a, "mutual_filter"_a = false,
+          "ratio_test"_a = 1.0);
+    docstring::FunctionDocInject(
+            m, "correspondences_from_features",
+            {{"source_features", "Features of the source point cloud."},
+             {"target_features", "Features of the target point cloud."},
+             {"mutual_filter",
+              "Only keep matches that are nearest neighbors in both "
+              "directions."},
+             {"ratio_test",
+              "Only keep matches closer than ``ratio_test`` times the second "
+              "nearest match. Values of 1 or greater disable the test."}});
 }
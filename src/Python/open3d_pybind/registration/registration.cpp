@@ -30,6 +30,9 @@
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/FastGlobalRegistration.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/ICPEngine.h"
+#include "Open3D/Registration/MultiScaleICP.h"
+#include "Open3D/Registration/RobustKernel.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Open3D/Utility/Console.h"
 
@@ -153,6 +156,72 @@ void pybind_registration_classes(py::module &m) {
                              c.max_iteration_, c.max_validation_);
                  });
 
+    // open3d.registration.RobustKernel
+    py::class_<registration::RobustKernel,
+               std::shared_ptr<registration::RobustKernel>>
+            rk(m, "RobustKernel",
+               "Base class of the robust kernels that down-weight outlier "
+               "correspondences in point to plane registration.");
+    rk.def("weight", &registration::RobustKernel::Weight, "residual"_a,
+           "Returns the weight of a residual.");
+
+    // open3d.registration.L2Loss: RobustKernel
+    py::class_<registration::L2Loss, std::shared_ptr<registration::L2Loss>,
+               registration::RobustKernel>
+            l2(m, "L2Loss",
+               "Plain least squares, every residual has weight 1.");
+    py::detail::bind_default_constructor<registration::L2Loss>(l2);
+    l2.def("__repr__", [](const registration::L2Loss &kernel) {
+        return std::string("registration::L2Loss");
+    });
+
+    // open3d.registration.HuberLoss: RobustKernel
+    py::class_<registration::HuberLoss,
+               std::shared_ptr<registration::HuberLoss>,
+               registration::RobustKernel>
+            huber(m, "HuberLoss",
+                  "Huber loss, quadratic for residuals up to k and linear "
+                  "beyond.");
+    huber.def(py::init<double>(), "k"_a)
+            .def("__repr__",
+                 [](const registration::HuberLoss &kernel) {
+                     return fmt::format("registration::HuberLoss with k={:f}",
+                                        kernel.k_);
+                 })
+            .def_readwrite("k", &registration::HuberLoss::k_,
+                           "Residual at which the loss becomes linear.");
+
+    // open3d.registration.CauchyLoss: RobustKernel
+    py::class_<registration::CauchyLoss,
+               std::shared_ptr<registration::CauchyLoss>,
+               registration::RobustKernel>
+            cauchy(m, "CauchyLoss",
+                   "Cauchy loss, smoothly down-weights residuals larger "
+                   "than k.");
+    cauchy.def(py::init<double>(), "k"_a)
+            .def("__repr__",
+                 [](const registration::CauchyLoss &kernel) {
+                     return fmt::format("registration::CauchyLoss with k={:f}",
+                                        kernel.k_);
+                 })
+            .def_readwrite("k", &registration::CauchyLoss::k_,
+                           "Scale of the residuals.");
+
+    // open3d.registration.TukeyLoss: RobustKernel
+    py::class_<registration::TukeyLoss,
+               std::shared_ptr<registration::TukeyLoss>,
+               registration::RobustKernel>
+            tukey(m, "TukeyLoss",
+                  "Tukey's biweight loss, ignores residuals larger than k.");
+    tukey.def(py::init<double>(), "k"_a)
+            .def("__repr__",
+                 [](const registration::TukeyLoss &kernel) {
+                     return fmt::format("registration::TukeyLoss with k={:f}",
+                                        kernel.k_);
+                 })
+            .def_readwrite("k", &registration::TukeyLoss::k_,
+                           "Residual beyond which the weight is 0.");
+
     // open3d.registration.TransformationEstimation
     py::class_<
             registration::TransformationEstimation,
@@ -232,15 +301,24 @@ Sets :math:`c = 1` if ``with_scaling`` is ``False``.
             te_p2l(m, "TransformationEstimationPointToPlane",
                    "Class to estimate a transformation for point to plane "
                    "distance.");
-    py::detail::bind_default_constructor<
-            registration::TransformationEstimationPointToPlane>(te_p2l);
     py::detail::bind_copy_functions<
             registration::TransformationEstimationPointToPlane>(te_p2l);
-    te_p2l.def(
-            "__repr__",
-            [](const registration::TransformationEstimationPointToPlane &te) {
-                return std::string("TransformationEstimationPointToPlane");
-            });
+    te_p2l.def(py::init([](std::shared_ptr<registration::RobustKernel> kernel) {
+                   return new registration::
+                           TransformationEstimationPointToPlane(kernel);
+               }),
+               "kernel"_a = std::make_shared<registration::L2Loss>())
+            .def("__repr__",
+                 [](const registration::TransformationEstimationPointToPlane
+                            &te) {
+                     return std::string("TransformationEstimationPointToPlane");
+                 })
+            .def_readwrite(
+                    "kernel",
+                    &registration::TransformationEstimationPointToPlane::
+                            kernel_,
+                    "Robust kernel that weights the correspondences. "
+                    "``None`` is the same as ``L2Loss``.");
 
     // open3d.registration.CorrespondenceChecker
     py::class_<registration::CorrespondenceChecker,
@@ -483,6 +561,97 @@ must hold true for all edges.)");
                         rr.fitness_, rr.inlier_rmse_,
                         rr.correspondence_set_.size());
             });
+
+    // open3d.registration.ICPIterationInfo
+    py::class_<registration::ICPIterationInfo> iteration_info(
+            m, "ICPIterationInfo", "State and timing of one ICP iteration.");
+    iteration_info
+            .def_readonly("iteration",
+                          &registration::ICPIterationInfo::iteration_,
+                          "int: Iteration number. Iteration 0 is the "
+                          "correspondence search at the initial "
+                          "transformation.")
+            .def_readonly("fitness", &registration::ICPIterationInfo::fitness_,
+                          "float: Fitness after the iteration.")
+            .def_readonly("inlier_rmse",
+                          &registration::ICPIterationInfo::inlier_rmse_,
+                          "float: Inlier RMSE after the iteration.")
+            .def_readonly("estimation_time",
+                          &registration::ICPIterationInfo::estimation_time_,
+                          "float: Milliseconds spent estimating the "
+                          "transformation update.")
+            .def_readonly("correspondence_time",
+                          &registration::ICPIterationInfo::correspondence_time_,
+                          "float: Milliseconds spent searching the "
+                          "correspondences.");
+
+    // open3d.registration.ICPEngine
+    py::class_<registration::ICPEngine,
+               std::shared_ptr<registration::ICPEngine>>
+            icp_engine(m, "ICPEngine",
+                       "Runs ICP against a fixed target, keeping the target "
+                       "KDTree and the correspondence buffers alive across "
+                       "iterations and calls.");
+    icp_engine
+            .def(py::init([](std::shared_ptr<geometry::PointCloud> target) {
+                     return std::make_shared<registration::ICPEngine>(
+                             std::shared_ptr<const geometry::PointCloud>(
+                                     target));
+                 }),
+                 "target"_a)
+            .def("set_target",
+                 [](registration::ICPEngine &engine,
+                    std::shared_ptr<geometry::PointCloud> target) {
+                     engine.SetTarget(target);
+                 },
+                 "Replaces the target and rebuilds its KDTree.", "target"_a)
+            .def("evaluate", &registration::ICPEngine::Evaluate,
+                 "Evaluates a transformation like ``evaluate_registration``.",
+                 "source"_a, "max_correspondence_distance"_a,
+                 "transformation"_a = Eigen::Matrix4d::Identity())
+            .def("register", &registration::ICPEngine::Register,
+                 "Registers the source to the target like "
+                 "``registration_icp``.",
+                 "source"_a, "max_correspondence_distance"_a,
+                 "init"_a = Eigen::Matrix4d::Identity(),
+                 "estimation_method"_a =
+                         registration::TransformationEstimationPointToPoint(
+                                 false),
+                 "criteria"_a = registration::ICPConvergenceCriteria())
+            .def("get_iteration_info",
+                 &registration::ICPEngine::GetIterationInfo,
+                 "Returns one entry per iteration of the last ``register`` "
+                 "call.")
+            .def("__repr__", [](const registration::ICPEngine &engine) {
+                return fmt::format(
+                        "registration::ICPEngine with a target of {:d} points",
+                        engine.GetTarget().points_.size());
+            });
+
+    // open3d.registration.PointCloudPyramid
+    py::class_<registration::PointCloudPyramid,
+               std::shared_ptr<registration::PointCloudPyramid>>
+            pyramid(m, "PointCloudPyramid",
+                    "Voxel downsampled levels of a point cloud, from coarse "
+                    "to fine, shareable across multi-scale registrations.");
+    pyramid.def(py::init<const geometry::PointCloud &,
+                         const std::vector<double> &, bool>(),
+                "cloud"_a, "voxel_sizes"_a, "estimate_normals"_a = true)
+            .def("num_levels", &registration::PointCloudPyramid::NumLevels,
+                 "Returns the number of levels.")
+            .def("get_voxel_size",
+                 &registration::PointCloudPyramid::GetVoxelSize,
+                 "Returns the voxel size of a level.", "level"_a)
+            .def("get_level", &registration::PointCloudPyramid::GetLevel,
+                 "Returns a copy of the point cloud of a level.", "level"_a)
+            .def("get_engine", &registration::PointCloudPyramid::GetEngine,
+                 "Returns the ICP engine that uses a level as target.",
+                 "level"_a, py::return_value_policy::reference_internal)
+            .def("__repr__", [](const registration::PointCloudPyramid &p) {
+                return fmt::format(
+                        "registration::PointCloudPyramid with {:d} levels",
+                        p.NumLevels());
+            });
 }
 
 // Registration functions have similar arguments, sharing arg docstrings
@@ -497,6 +666,11 @@ static const std::unordered_map<std::string, std::string>
                  "``registration::CorrespondenceCheckerBasedOnDistance``, "
                  "``registration::CorrespondenceCheckerBasedOnNormal``)"},
                 {"criteria", "Convergence criteria"},
+                {"early_exit_relative_fitness",
+                 "Skips the remaining levels once the fitness of a level "
+                 "differs from the fitness of the previous level by less than "
+                 "this value."},
+                {"engine", "ICP engine of the target."},
                 {"estimation_method",
                  "Estimation method. One of "
                  "(``registration::TransformationEstimationPointToPoint``, "
@@ -505,8 +679,18 @@ static const std::unordered_map<std::string, std::string>
                 {"lambda_geometric", "lambda_geometric value"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
+                {"max_correspondence_distances",
+                 "Maximum correspondence points-pair distance of each "
+                 "level."},
+                {"mutual_filter",
+                 "Only use feature matches that are nearest neighbors in both "
+                 "directions."},
                 {"option", "Registration option"},
                 {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
+                {"ratio_test",
+                 "Only use feature matches closer than ``ratio_test`` times "
+                 "the second nearest match. Values of 1 or greater disable "
+                 "the test."},
                 {"source_feature", "Source point cloud feature."},
                 {"source", "The source point cloud."},
                 {"target_feature", "Target point cloud feature."},
@@ -533,15 +717,61 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_colored_icp", &registration::RegistrationColoredICP,
+    m.def("registration_colored_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::ICPConvergenceCriteria &, double)) &
+                  registration::RegistrationColoredICP,
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "criteria"_a = registration::ICPConvergenceCriteria(),
           "lambda_geometric"_a = 0.968);
+    m.def("registration_colored_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &, registration::ICPEngine &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::ICPConvergenceCriteria &, double)) &
+                  registration::RegistrationColoredICP,
+          "Function for Colored ICP registration against the target of an "
+          "engine created from ``create_target_for_colored_icp``",
+          "source"_a, "engine"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "criteria"_a = registration::ICPConvergenceCriteria(),
+          "lambda_geometric"_a = 0.968);
     docstring::FunctionDocInject(m, "registration_colored_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("create_target_for_colored_icp",
+          &registration::CreateTargetForColoredICP,
+          "Function to prepare a target point cloud for colored ICP",
+          "target"_a, "max_correspondence_distance"_a);
+    docstring::FunctionDocInject(m, "create_target_for_colored_icp",
+                                 map_shared_argument_docstrings);
+
+    m.def("registration_multi_scale_icp",
+          &registration::RegistrationMultiScaleICP,
+          "Function for coarse-to-fine ICP registration", "source"_a,
+          "target"_a, "max_correspondence_distances"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPoint(false),
+          "criteria"_a = std::vector<registration::ICPConvergenceCriteria>(),
+          "early_exit_relative_fitness"_a = 0.0);
+    docstring::FunctionDocInject(m, "registration_multi_scale_icp",
+                                 map_shared_argument_docstrings);
+
+    m.def("registration_multi_scale_colored_icp",
+          &registration::RegistrationMultiScaleColoredICP,
+          "Function for coarse-to-fine Colored ICP registration", "source"_a,
+          "target"_a, "max_correspondence_distances"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "criteria"_a = std::vector<registration::ICPConvergenceCriteria>(),
+          "lambda_geometric"_a = 0.968, "early_exit_relative_fitness"_a = 0.0);
+    docstring::FunctionDocInject(m, "registration_multi_scale_colored_icp",
+                                 map_shared_argument_docstrings);
+
     m.def("registration_ransac_based_on_correspondence",
           &registration::RegistrationRANSACBasedOnCorrespondence,
           "Function for global RANSAC registration based on a set of "
@@ -565,7 +795,8 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 4,
           "checkers"_a = std::vector<std::reference_wrapper<
                   const registration::CorrespondenceChecker>>(),
-          "criteria"_a = registration::RANSACConvergenceCriteria(100000, 100));
+          "criteria"_a = registration::RANSACConvergenceCriteria(100000, 100),
+          "mutual_filter"_a = false, "ratio_test"_a = 1.0);
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
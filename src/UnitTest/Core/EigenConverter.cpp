@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/EigenConverter.h"
+
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace std;
+using namespace open3d;
+
+TEST(EigenConverter, PointCloudAsTensor) {
+    auto pcd = std::make_shared<geometry::PointCloud>();
+    pcd->points_ = {{0, 1, 2}, {3, 4, 5}};
+    Tensor points =
+            eigen_converter::EigenVector3dVectorAsTensor(pcd->points_, pcd);
+    EXPECT_EQ(points.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(points.GetDtype(), Dtype::Float64);
+    EXPECT_EQ(points.GetDataPtr(), pcd->points_.data());
+    EXPECT_EQ(points.ToFlatVector<double>(),
+              std::vector<double>({0, 1, 2, 3, 4, 5}));
+
+    // Writes are shared in both directions.
+    points[1][2] = 10.0;
+    EXPECT_EQ(pcd->points_[1](2), 10);
+    pcd->points_[0](0) = -1;
+    EXPECT_EQ(points[0][0].Item<double>(), -1);
+
+    // The view keeps the point cloud alive.
+    geometry::PointCloud* pcd_ptr = pcd.get();
+    pcd.reset();
+    EXPECT_EQ(points.GetDataPtr(), pcd_ptr->points_.data());
+    EXPECT_EQ(points.ToFlatVector<double>(),
+              std::vector<double>({-1, 1, 2, 3, 4, 10}));
+}
+
+TEST(EigenConverter, TriangleMeshAsTensor) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {2, 1, 3}};
+    Tensor vertices =
+            eigen_converter::EigenVector3dVectorAsTensor(mesh.vertices_);
+    Tensor triangles =
+            eigen_converter::EigenVector3iVectorAsTensor(mesh.triangles_);
+    EXPECT_EQ(vertices.GetShape(), SizeVector({4, 3}));
+    EXPECT_EQ(triangles.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(triangles.GetDtype(), Dtype::Int32);
+    EXPECT_EQ(triangles.GetDataPtr(), mesh.triangles_.data());
+    EXPECT_EQ(triangles.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 2, 2, 1, 3}));
+
+    // In-place Tensor ops modify the mesh.
+    vertices.Mul_(2);
+    EXPECT_EQ(mesh.vertices_[3], Eigen::Vector3d(2, 2, 0));
+}
+
+TEST(EigenConverter, MoveRoundTrip) {
+    std::vector<Eigen::Vector3d> normals = {{0, 0, 1}, {0, 1, 0}, {1, 0, 0}};
+    const void* data_ptr = normals.data();
+    Tensor tensor = eigen_converter::EigenVector3dVectorToTensor(
+            std::move(normals));
+    EXPECT_EQ(tensor.GetDataPtr(), data_ptr);
+    EXPECT_EQ(tensor.GetShape(), SizeVector({3, 3}));
+
+    tensor.Neg_();
+    std::vector<Eigen::Vector3d> result =
+            eigen_converter::TensorToEigenVector3dVector(std::move(tensor));
+    EXPECT_EQ(result.data(), data_ptr);
+    EXPECT_EQ(result[0], Eigen::Vector3d(0, 0, -1));
+    EXPECT_EQ(tensor.GetBlob(), nullptr);
+
+    std::vector<Eigen::Vector3i> triangles = {{0, 1, 2}};
+    const void* triangles_ptr = triangles.data();
+    std::vector<Eigen::Vector3i> triangles_result =
+            eigen_converter::TensorToEigenVector3iVector(
+                    eigen_converter::EigenVector3iVectorToTensor(
+                            std::move(triangles)));
+    EXPECT_EQ(triangles_result.data(), triangles_ptr);
+    EXPECT_EQ(triangles_result[0], Eigen::Vector3i(0, 1, 2));
+}
+
+TEST(EigenConverter, CopyWhenShared) {
+    std::vector<Eigen::Vector3d> points = {{0, 1, 2}, {3, 4, 5}};
+    Tensor tensor =
+            eigen_converter::EigenVector3dVectorToTensor(std::move(points));
+    Tensor other = tensor;
+
+    // Another Tensor still refers to the data, so it is copied.
+    std::vector<Eigen::Vector3d> result =
+            eigen_converter::TensorToEigenVector3dVector(std::move(tensor));
+    EXPECT_NE(result.data(), other.GetDataPtr());
+    EXPECT_EQ(result[1], Eigen::Vector3d(3, 4, 5));
+    EXPECT_EQ(other.ToFlatVector<double>(),
+              std::vector<double>({0, 1, 2, 3, 4, 5}));
+
+    // Views and other dtypes are copied and converted.
+    result = eigen_converter::TensorToEigenVector3dVector(
+            other.T().Contiguous().T());
+    EXPECT_EQ(result[0], Eigen::Vector3d(0, 1, 2));
+    Tensor ints(std::vector<int32_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}),
+                {3, 4}, Dtype::Int32);
+    std::vector<Eigen::Vector3i> ints_result =
+            eigen_converter::TensorToEigenVector3iVector(
+                    ints.Slice(1, 1, 4));
+    EXPECT_EQ(ints_result.size(), 3u);
+    EXPECT_EQ(ints_result[2], Eigen::Vector3i(9, 10, 11));
+    result = eigen_converter::TensorToEigenVector3dVector(ints.Slice(1, 1, 4));
+    EXPECT_EQ(result[1], Eigen::Vector3d(5, 6, 7));
+
+    EXPECT_THROW(eigen_converter::TensorToEigenVector3dVector(ints),
+                 std::runtime_error);
+}
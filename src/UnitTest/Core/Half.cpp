@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Half.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "TestUtility/UnitTest.h"
+
+using namespace std;
+using namespace open3d;
+
+TEST(Half, ExactValues) {
+    EXPECT_EQ(Half(0.f).bits_, 0x0000);
+    EXPECT_EQ(Half(-0.f).bits_, 0x8000);
+    EXPECT_EQ(Half(1.f).bits_, 0x3C00);
+    EXPECT_EQ(Half(-2.f).bits_, 0xC000);
+    EXPECT_EQ(Half(65504.f).bits_, 0x7BFF);
+    EXPECT_EQ(Half(std::pow(2.f, -14.f)).bits_, 0x0400);
+    EXPECT_EQ(Half(std::pow(2.f, -24.f)).bits_, 0x0001);
+
+    EXPECT_EQ(float(Half::FromBits(0x3555)), 0.333251953125f);
+    EXPECT_EQ(float(Half::FromBits(0x0001)), std::pow(2.f, -24.f));
+    EXPECT_EQ(float(Half::FromBits(0x03FF)), 1023.f * std::pow(2.f, -24.f));
+}
+
+TEST(Half, Rounding) {
+    // 1 + 2^-11 is halfway between 1 and the next Half, ties go to even.
+    EXPECT_EQ(Half(1.f + std::pow(2.f, -11.f)).bits_, 0x3C00);
+    EXPECT_EQ(Half(1.f + 3.f * std::pow(2.f, -11.f)).bits_, 0x3C02);
+    EXPECT_EQ(Half(1.f + 1.5f * std::pow(2.f, -11.f)).bits_, 0x3C01);
+
+    // Overflow, including values that round up past the largest Half.
+    EXPECT_EQ(Half(65519.f).bits_, 0x7BFF);
+    EXPECT_EQ(Half(65520.f).bits_, 0x7C00);
+    EXPECT_EQ(Half(-1e10f).bits_, 0xFC00);
+
+    // Underflow: 2^-25 ties to zero, anything above rounds to 2^-24.
+    EXPECT_EQ(Half(std::pow(2.f, -25.f)).bits_, 0x0000);
+    EXPECT_EQ(Half(1.5f * std::pow(2.f, -25.f)).bits_, 0x0001);
+    EXPECT_EQ(Half(-1e-10f).bits_, 0x8000);
+}
+
+TEST(Half, InfNaN) {
+    EXPECT_EQ(Half(std::numeric_limits<float>::infinity()).bits_, 0x7C00);
+    EXPECT_TRUE(std::isinf(float(std::numeric_limits<Half>::infinity())));
+    EXPECT_TRUE(std::isnan(float(Half(std::nanf("")))));
+    EXPECT_TRUE(std::isnan(float(std::numeric_limits<Half>::quiet_NaN())));
+    EXPECT_EQ(float(std::numeric_limits<Half>::lowest()), -65504.f);
+    EXPECT_EQ(float(std::numeric_limits<Half>::epsilon()),
+              std::pow(2.f, -10.f));
+}
+
+TEST(Half, RoundTripAllBits) {
+    // Every finite Half is exactly representable as a float.
+    for (uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+        Half h = Half::FromBits(static_cast<uint16_t>(bits));
+        float f = h;
+        if (std::isnan(f)) {
+            continue;
+        }
+        EXPECT_EQ(Half(f).bits_, bits);
+    }
+}
+
+TEST(Half, Arithmetic) {
+    Half a = 1.5f;
+    Half b = -0.25f;
+    EXPECT_EQ(float(a + b), 1.25f);
+    EXPECT_EQ(float(a * b), -0.375f);
+    EXPECT_EQ(float(-a), -1.5f);
+    EXPECT_TRUE(b < a);
+    a += 1;
+    EXPECT_EQ(float(a), 2.5f);
+    a /= 2;
+    EXPECT_EQ(float(a), 1.25f);
+}
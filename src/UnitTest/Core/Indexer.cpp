@@ -183,3 +183,90 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(4), output_base_ptr + 4 * dtype_byte_size);
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
+
+TEST_P(IndexerPermuteDevices, GetFlatElementStride) {
+    Device device = GetParam();
+
+    Tensor input0({3, 2}, Dtype::Float32, device);
+    Tensor input1({1}, Dtype::Float32, device);
+    Tensor input2({2, 3}, Dtype::Float32, device);
+    Tensor output({3, 2}, Dtype::Float32, device);
+
+    // Contiguous and broadcasted scalar.
+    Indexer indexer({input0, input1}, output);
+    EXPECT_EQ(indexer.GetFlatElementStride(indexer.GetInput(0)), 1);
+    EXPECT_EQ(indexer.GetFlatElementStride(indexer.GetInput(1)), 0);
+    EXPECT_EQ(indexer.GetFlatElementStride(indexer.GetOutput()), 1);
+
+    // Transposed input is neither contiguous nor a scalar.
+    indexer = Indexer({input2.T(), input1}, output);
+    EXPECT_EQ(indexer.GetFlatElementStride(indexer.GetInput(0)), -1);
+    EXPECT_EQ(indexer.GetFlatElementStride(indexer.GetInput(1)), 0);
+    EXPECT_EQ(indexer.GetFlatElementStride(indexer.GetOutput()), 1);
+}
+
+template <int NDIMS>
+static void ExpectWalkerMatchesIndexer(const Indexer& indexer) {
+    const TensorRef* const refs[3] = {&indexer.GetInput(0),
+                                      &indexer.GetInput(1),
+                                      &indexer.GetOutput()};
+    const int64_t num_workloads = indexer.NumWorkloads();
+    for (int64_t start : {int64_t(0), int64_t(1), num_workloads / 2}) {
+        IndexerWalker<3, NDIMS> walker(indexer, refs, start);
+        int64_t workload_idx = start;
+        auto check = [&](char* const* ptrs) {
+            EXPECT_EQ(ptrs[0], indexer.GetInputPtr(0, workload_idx));
+            EXPECT_EQ(ptrs[1], indexer.GetInputPtr(1, workload_idx));
+            EXPECT_EQ(ptrs[2], indexer.GetOutputPtr(workload_idx));
+            workload_idx++;
+        };
+        // Walking in two pieces must continue where the first piece stopped.
+        int64_t first = std::min(int64_t(5), num_workloads - start);
+        walker.Walk(first, check);
+        walker.Walk(num_workloads - start - first, check);
+        EXPECT_EQ(workload_idx, num_workloads);
+    }
+}
+
+TEST(Indexer, Walker) {
+    // IndexerWalker is only used on the CPU.
+    Device device("CPU:0");
+
+    const SizeVector full_shape{3, 4, 2, 5, 3, 2};
+    for (int64_t ndims = 1; ndims <= 6; ++ndims) {
+        SizeVector shape(full_shape.begin(), full_shape.begin() + ndims);
+        // Broadcast every other dimension of input0 so that the Indexer's
+        // dimensions cannot be coalesced.
+        SizeVector broadcast_shape = shape;
+        for (int64_t i = 0; i < ndims; i += 2) {
+            broadcast_shape[i] = 1;
+        }
+        // input1 is a permuted, non-contiguous view.
+        SizeVector reversed_shape(shape.rbegin(), shape.rend());
+        SizeVector reversed_dims(ndims);
+        for (int64_t i = 0; i < ndims; ++i) {
+            reversed_dims[i] = ndims - 1 - i;
+        }
+        Tensor input0(broadcast_shape, Dtype::Float32, device);
+        Tensor input1 = Tensor(reversed_shape, Dtype::Float64, device)
+                                .Permute(reversed_dims);
+        Tensor output(shape, Dtype::Int32, device);
+        Indexer indexer({input0, input1}, output, DtypePolicy::NONE);
+
+        ExpectWalkerMatchesIndexer<0>(indexer);
+        switch (indexer.NumDims()) {
+            case 1:
+                ExpectWalkerMatchesIndexer<1>(indexer);
+                break;
+            case 2:
+                ExpectWalkerMatchesIndexer<2>(indexer);
+                break;
+            case 3:
+                ExpectWalkerMatchesIndexer<3>(indexer);
+                break;
+            case 4:
+                ExpectWalkerMatchesIndexer<4>(indexer);
+                break;
+        }
+    }
+}
@@ -27,6 +27,7 @@
 #include "Open3D/Core/MemoryManager.h"
 #include "Open3D/Core/Blob.h"
 #include "Open3D/Core/Device.h"
+#include "Open3D/Core/Tensor.h"
 
 #include "Core/CoreTest.h"
 #include "TestUtility/UnitTest.h"
@@ -76,3 +77,94 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     MemoryManager::Free(dst_ptr, dst_device);
     MemoryManager::Free(src_ptr, src_device);
 }
+
+TEST(MemoryManager, CPUCacheReuse) {
+    Device device("CPU:0");
+    MemoryManager::SetCacheEnabled(device, true);
+    EXPECT_TRUE(MemoryManager::IsCacheEnabled(device));
+
+    // Small block, served from the thread-local free list.
+    void* ptr = MemoryManager::Malloc(1000, device);
+    MemoryManager::Free(ptr, device);
+    MemoryStatistics stats = MemoryManager::GetStatistics(device);
+    EXPECT_GE(stats.bytes_cached_, 1000);
+    void* reused_ptr = MemoryManager::Malloc(1000, device);
+    EXPECT_EQ(reused_ptr, ptr);
+    EXPECT_EQ(MemoryManager::GetStatistics(device).num_cache_hits_,
+              stats.num_cache_hits_ + 1);
+    MemoryManager::Free(reused_ptr, device);
+
+    // Large block, served from the shared pool.
+    ptr = MemoryManager::Malloc(5 << 20, device);
+    MemoryManager::Free(ptr, device);
+    reused_ptr = MemoryManager::Malloc((5 << 20) - 100, device);
+    EXPECT_EQ(reused_ptr, ptr);
+    MemoryManager::Free(reused_ptr, device);
+
+    // Blocks allocated from the cache can be freed after disabling it.
+    ptr = MemoryManager::Malloc(100, device);
+    MemoryManager::SetCacheEnabled(device, false);
+    EXPECT_EQ(MemoryManager::GetStatistics(device).bytes_cached_, 0);
+    MemoryManager::Free(ptr, device);
+    EXPECT_EQ(MemoryManager::GetStatistics(device).bytes_cached_, 0);
+
+    // And vice versa.
+    ptr = MemoryManager::Malloc(100, device);
+    MemoryManager::SetCacheEnabled(device, true);
+    MemoryManager::Free(ptr, device);
+    EXPECT_EQ(MemoryManager::GetStatistics(device).bytes_cached_, 0);
+
+    MemoryManager::ReleaseCache(device);
+    MemoryManager::SetCacheEnabled(device, false);
+}
+
+TEST(MemoryManager, CPUCacheHighWaterMark) {
+    Device device("CPU:0");
+    MemoryManager::SetCacheEnabled(device, true);
+    MemoryManager::SetCacheHighWaterMark(device, 4096);
+
+    void* small_ptr = MemoryManager::Malloc(1024, device);
+    void* large_ptr = MemoryManager::Malloc(4 << 20, device);
+    MemoryManager::Free(small_ptr, device);
+    MemoryManager::Free(large_ptr, device);
+    MemoryStatistics stats = MemoryManager::GetStatistics(device);
+    EXPECT_GT(stats.bytes_cached_, 0);
+    EXPECT_LE(stats.bytes_cached_, 4096);
+
+    MemoryManager::ReleaseCache(device);
+    EXPECT_EQ(MemoryManager::GetStatistics(device).bytes_cached_, 0);
+
+    MemoryManager::SetCacheHighWaterMark(device, int64_t(1) << 30);
+    MemoryManager::SetCacheEnabled(device, false);
+}
+
+TEST(MemoryManager, CPUCacheStatistics) {
+    Device device("CPU:0");
+    MemoryManager::SetCacheEnabled(device, true);
+
+    MemoryStatistics stats = MemoryManager::GetStatistics(device);
+    {
+        Tensor t({100, 3}, Dtype::Float32, device);
+        EXPECT_GE(MemoryManager::GetStatistics(device).bytes_in_use_,
+                  stats.bytes_in_use_ + 1200);
+    }
+    EXPECT_EQ(MemoryManager::GetStatistics(device).bytes_in_use_,
+              stats.bytes_in_use_);
+    for (int i = 0; i < 10; ++i) {
+        Tensor t({100, 3}, Dtype::Float32, device);
+    }
+    MemoryStatistics new_stats = MemoryManager::GetStatistics(device);
+    EXPECT_EQ(new_stats.num_mallocs_, stats.num_mallocs_ + 11);
+    EXPECT_GE(new_stats.num_cache_hits_, stats.num_cache_hits_ + 10);
+    EXPECT_GT(new_stats.HitRate(), 0);
+    EXPECT_GE(new_stats.peak_bytes_in_use_, stats.bytes_in_use_ + 1200);
+
+    // With the cache disabled, allocations bypass it and are not counted.
+    MemoryManager::SetCacheEnabled(device, false);
+    stats = MemoryManager::GetStatistics(device);
+    void* ptr = MemoryManager::Malloc(1000, device);
+    new_stats = MemoryManager::GetStatistics(device);
+    EXPECT_EQ(new_stats.num_mallocs_, stats.num_mallocs_);
+    EXPECT_EQ(new_stats.bytes_in_use_, stats.bytes_in_use_);
+    MemoryManager::Free(ptr, device);
+}
@@ -0,0 +1,260 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/NumpyIO.h"
+#include "Open3D/Core/Blob.h"
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/FileSystem.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace std;
+using namespace open3d;
+
+class NumpyIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(NumpyIO,
+                         NumpyIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static void WriteBytes(const std::string& file_name,
+                       const std::vector<unsigned char>& bytes) {
+    FILE* file = utility::filesystem::FOpen(file_name, "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(bytes.data(), 1, bytes.size(), file);
+    fclose(file);
+}
+
+TEST_P(NumpyIOPermuteDevices, NpyRoundTrip) {
+    Device device = GetParam();
+    const std::string file_name = "NumpyIO_round_trip.npy";
+
+    for (Dtype dtype : {Dtype::Float16, Dtype::Float32, Dtype::Float64,
+                        Dtype::Int16, Dtype::Int32, Dtype::Int64, Dtype::UInt8,
+                        Dtype::UInt16, Dtype::Bool}) {
+        Tensor src = Tensor(std::vector<float>{0, 1, 0, 3, 4, 5}, {2, 3},
+                            Dtype::Float32, device)
+                             .To(dtype);
+        src.Save(file_name);
+        Tensor dst = Tensor::Load(file_name);
+        EXPECT_EQ(dst.GetDtype(), dtype);
+        EXPECT_EQ(dst.GetShape(), SizeVector({2, 3}));
+        EXPECT_EQ(dst.GetDevice(), Device("CPU:0"));
+        EXPECT_EQ(dst.To(Dtype::Float32).ToFlatVector<float>(),
+                  src.To(Dtype::Float32).ToFlatVector<float>());
+    }
+
+    // Scalars, 1-D and non-contiguous Tensors.
+    Tensor scalar = Tensor::Full({}, 7.5, Dtype::Float64, device);
+    scalar.Save(file_name);
+    Tensor scalar_loaded = Tensor::Load(file_name);
+    EXPECT_EQ(scalar_loaded.GetShape(), SizeVector({}));
+    EXPECT_EQ(scalar_loaded.Item<double>(), 7.5);
+
+    Tensor vector(std::vector<int32_t>{1, 2, 3}, {3}, Dtype::Int32, device);
+    vector.Save(file_name);
+    EXPECT_EQ(Tensor::Load(file_name).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 3}));
+
+    Tensor matrix(std::vector<int64_t>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Int64,
+                  device);
+    matrix.T().Save(file_name);
+    Tensor transposed = Tensor::Load(file_name);
+    EXPECT_EQ(transposed.GetShape(), SizeVector({3, 2}));
+    EXPECT_EQ(transposed.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 3, 1, 4, 2, 5}));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(NumpyIO, NpyMemoryMapped) {
+    // Memory mapping is only implemented on the CPU.
+    Device device("CPU:0");
+    const std::string file_name = "NumpyIO_mmap.npy";
+
+    Tensor src(std::vector<float>{1, 2, 3, 4, 5, 6}, {3, 2}, Dtype::Float32,
+               device);
+    src.Save(file_name);
+    {
+        Tensor mapped = Tensor::Load(file_name, /*mmap=*/true);
+        EXPECT_NE(mapped.GetBlob()->GetMappedFile(), nullptr);
+        EXPECT_EQ(mapped.ToFlatVector<float>(), src.ToFlatVector<float>());
+
+        // Mappings are copy-on-write: writes are not visible in the file.
+        mapped.Fill(0);
+        EXPECT_EQ(mapped.ToFlatVector<float>(), std::vector<float>(6, 0));
+    }
+    Tensor reloaded = Tensor::Load(file_name);
+    EXPECT_EQ(reloaded.GetBlob()->GetMappedFile(), nullptr);
+    EXPECT_EQ(reloaded.ToFlatVector<float>(), src.ToFlatVector<float>());
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(NumpyIO, NpyFortranOrder) {
+    // A 2x3 float32 array [[0, 1, 2], [3, 4, 5]] in Fortran order, with the
+    // 16-byte header alignment of older NumPy versions.
+    const std::string dict =
+            "{'descr': '<f4', 'fortran_order': True, 'shape': (2, 3), }";
+    std::vector<unsigned char> bytes{0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0};
+    size_t dict_size = (10 + dict.size() + 1 + 15) / 16 * 16 - 10;
+    bytes.push_back(static_cast<unsigned char>(dict_size & 0xff));
+    bytes.push_back(static_cast<unsigned char>(dict_size >> 8));
+    bytes.insert(bytes.end(), dict.begin(), dict.end());
+    bytes.insert(bytes.end(), dict_size - dict.size() - 1, ' ');
+    bytes.push_back('\n');
+    for (float v : {0.f, 3.f, 1.f, 4.f, 2.f, 5.f}) {
+        const unsigned char* v_bytes = reinterpret_cast<unsigned char*>(&v);
+        bytes.insert(bytes.end(), v_bytes, v_bytes + sizeof(float));
+    }
+    const std::string file_name = "NumpyIO_fortran.npy";
+    WriteBytes(file_name, bytes);
+
+    Tensor t = Tensor::Load(file_name);
+    EXPECT_EQ(t.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(t.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3, 4, 5}));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST_P(NumpyIOPermuteDevices, NpzRoundTrip) {
+    Device device = GetParam();
+    const std::string file_name = "NumpyIO_round_trip.npz";
+
+    Tensor points(std::vector<float>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Float32,
+                  device);
+    Tensor labels(std::vector<int64_t>{7, 8}, {2}, Dtype::Int64, device);
+    Tensor mask(std::vector<bool>{true, false}, {2}, Dtype::Bool, device);
+    WriteNpz(file_name,
+             {{"points", points}, {"labels", labels}, {"mask", mask}});
+
+    for (bool mmap : {false, true}) {
+        std::unordered_map<std::string, Tensor> tensors =
+                ReadNpz(file_name, mmap);
+        ASSERT_EQ(tensors.size(), 3);
+        EXPECT_EQ(tensors["points"].GetShape(), SizeVector({2, 3}));
+        EXPECT_EQ(tensors["points"].ToFlatVector<float>(),
+                  std::vector<float>({0, 1, 2, 3, 4, 5}));
+        EXPECT_EQ(tensors["labels"].ToFlatVector<int64_t>(),
+                  std::vector<int64_t>({7, 8}));
+        EXPECT_EQ(tensors["mask"].ToFlatVector<bool>(),
+                  std::vector<bool>({true, false}));
+    }
+    EXPECT_ANY_THROW(Tensor::Load(file_name));
+
+    points.Save(file_name);
+    EXPECT_EQ(ReadNpz(file_name).count("arr_0"), 1);
+    EXPECT_EQ(Tensor::Load(file_name).ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(NumpyIO, NpzCompressed) {
+    // Written by Python's zipfile with ZIP_DEFLATED, like
+    // numpy.savez_compressed(f, a=np.array([[1, 2, 3], [4, 5, 6]], np.int32),
+    //                        b=np.array([0.5, -1.5])).
+    const std::vector<unsigned char> bytes{
+        0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x1e,
+        0x52, 0x5d, 0xd3, 0x4b, 0x2e, 0xae, 0x57, 0x00, 0x00, 0x00, 0x98, 0x00,
+        0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x61, 0x2e, 0x6e, 0x70, 0x79, 0x9b,
+        0xec, 0x17, 0xea, 0x1b, 0x10, 0xc9, 0xc8, 0x50, 0xc6, 0x50, 0xad, 0x9e,
+        0x92, 0x5a, 0x9c, 0x5c, 0xa4, 0x6e, 0xa5, 0xa0, 0x6e, 0x93, 0x69, 0xa2,
+        0xae, 0xa3, 0xa0, 0x9e, 0x96, 0x5f, 0x54, 0x52, 0x94, 0x98, 0x17, 0x9f,
+        0x5f, 0x94, 0x92, 0x0a, 0x12, 0x77, 0x4b, 0xcc, 0x29, 0x4e, 0x05, 0x8a,
+        0x17, 0x67, 0x24, 0x16, 0xa4, 0x02, 0xf9, 0x1a, 0x46, 0x3a, 0x0a, 0xc6,
+        0x9a, 0x3a, 0x0a, 0xb5, 0x0a, 0x64, 0x03, 0x2e, 0x46, 0x06, 0x06, 0x06,
+        0x26, 0x20, 0x66, 0x06, 0x62, 0x16, 0x20, 0x66, 0x05, 0x62, 0x36, 0x20,
+        0x06, 0x00, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00,
+        0x03, 0x1e, 0x52, 0x5d, 0xb4, 0x5e, 0x63, 0x69, 0x4d, 0x00, 0x00, 0x00,
+        0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x62, 0x2e, 0x6e, 0x70,
+        0x79, 0x9b, 0xec, 0x17, 0xea, 0x1b, 0x10, 0xc9, 0xc8, 0x50, 0xc6, 0x50,
+        0xad, 0x9e, 0x92, 0x5a, 0x9c, 0x5c, 0xa4, 0x6e, 0xa5, 0xa0, 0x6e, 0x93,
+        0x66, 0xa1, 0xae, 0xa3, 0xa0, 0x9e, 0x96, 0x5f, 0x54, 0x52, 0x94, 0x98,
+        0x17, 0x9f, 0x5f, 0x94, 0x92, 0x0a, 0x12, 0x77, 0x4b, 0xcc, 0x29, 0x4e,
+        0x05, 0x8a, 0x17, 0x67, 0x24, 0x16, 0xa4, 0x02, 0xf9, 0x1a, 0x46, 0x3a,
+        0x9a, 0x3a, 0x0a, 0xb5, 0x0a, 0x14, 0x00, 0x2e, 0x06, 0x30, 0x78, 0x60,
+        0x0f, 0xa1, 0x7f, 0xec, 0x07, 0x00, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03,
+        0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x1e, 0x52, 0x5d, 0xd3, 0x4b,
+        0x2e, 0xae, 0x57, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x05, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x61, 0x2e, 0x6e, 0x70, 0x79, 0x50, 0x4b, 0x01,
+        0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x1e, 0x52,
+        0x5d, 0xb4, 0x5e, 0x63, 0x69, 0x4d, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
+        0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0x01, 0x7a, 0x00, 0x00, 0x00, 0x62, 0x2e, 0x6e, 0x70, 0x79,
+        0x50, 0x4b, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+        0x66, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+    const std::string file_name = "NumpyIO_compressed.npz";
+    WriteBytes(file_name, bytes);
+
+    std::unordered_map<std::string, Tensor> tensors = ReadNpz(file_name);
+    ASSERT_EQ(tensors.size(), 2);
+    EXPECT_EQ(tensors["a"].GetDtype(), Dtype::Int32);
+    EXPECT_EQ(tensors["a"].GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(tensors["a"].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(tensors["b"].ToFlatVector<double>(),
+              std::vector<double>({0.5, -1.5}));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(NumpyIO, InvalidFiles) {
+    const std::string file_name = "NumpyIO_invalid.npy";
+    WriteBytes(file_name, {'n', 'o', 't', ' ', 'n', 'p', 'y'});
+    EXPECT_ANY_THROW(Tensor::Load(file_name));
+    EXPECT_ANY_THROW(ReadNpz(file_name));
+    utility::filesystem::RemoveFile(file_name);
+
+    // Headers with malformed, negative or overflowing dimensions.
+    for (const std::string shape :
+         {"(abc,)", "(-2, 3)", "(99999999999999999999,)",
+          "(4294967296, 4294967296)", "(1152921504606846976,)"}) {
+        const std::string dict = "{'descr': '<f4', 'fortran_order': False, "
+                                 "'shape': " +
+                                 shape + ", }\n";
+        std::vector<unsigned char> bytes{0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0};
+        bytes.push_back(static_cast<unsigned char>(dict.size() & 0xff));
+        bytes.push_back(static_cast<unsigned char>(dict.size() >> 8));
+        bytes.insert(bytes.end(), dict.begin(), dict.end());
+        bytes.insert(bytes.end(), 64, 0);
+        WriteBytes(file_name, bytes);
+        EXPECT_ANY_THROW(Tensor::Load(file_name));
+        utility::filesystem::RemoveFile(file_name);
+    }
+
+    EXPECT_ANY_THROW(Tensor::Load("NumpyIO_does_not_exist.npy"));
+    EXPECT_ANY_THROW(Tensor::Ones({2}, Dtype::Float32, Device("CPU:0"))
+                             .Save("NumpyIO_invalid.txt"));
+}
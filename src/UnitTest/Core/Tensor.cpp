@@ -32,6 +32,7 @@
 #include "Open3D/Core/MemoryManager.h"
 #include "Open3D/Core/SizeVector.h"
 #include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/CPUInfo.h"
 #include "Open3D/Utility/Helper.h"
 
 #include "Core/CoreTest.h"
@@ -215,6 +216,61 @@ TEST_P(TensorPermuteDevices, To) {
     EXPECT_EQ(dst_t.ToFlatVector<int>(), dst_vals);
 }
 
+TEST_P(TensorPermuteDevices, ToFloat16) {
+    Device device = GetParam();
+
+    std::vector<float> src_vals{0.1, -1.5, 2.25, 65504, 70000, 1e-8};
+    Tensor src_t(src_vals, {2, 3}, Dtype::Float32, device);
+
+    Tensor half_t = src_t.To(Dtype::Float16);
+    EXPECT_EQ(half_t.GetDtype(), Dtype::Float16);
+    EXPECT_EQ(DtypeUtil::ByteSize(half_t.GetDtype()), 2);
+    std::vector<Half> half_vals = half_t.ToFlatVector<Half>();
+    for (size_t i = 0; i < src_vals.size(); ++i) {
+        EXPECT_EQ(half_vals[i].bits_, Half(src_vals[i]).bits_);
+    }
+
+    std::vector<float> back = half_t.To(Dtype::Float32).ToFlatVector<float>();
+    EXPECT_FLOAT_EQ(back[0], 0.0999755859375f);
+    EXPECT_EQ(back[1], -1.5f);
+    EXPECT_EQ(back[3], 65504.f);
+    EXPECT_TRUE(std::isinf(back[4]));
+    EXPECT_EQ(back[5], 0.f);
+
+    // Converting the overflowed (infinite) element to an integer is undefined,
+    // so only the finite elements are checked.
+    std::vector<int32_t> ints = half_t.To(Dtype::Int32).ToFlatVector<int32_t>();
+    EXPECT_EQ(ints[0], 0);
+    EXPECT_EQ(ints[1], -1);
+    EXPECT_EQ(ints[2], 2);
+    EXPECT_EQ(ints[3], 65504);
+    EXPECT_EQ(ints[5], 0);
+}
+
+TEST_P(TensorPermuteDevices, Int16UInt16) {
+    Device device = GetParam();
+
+    Tensor depth(std::vector<uint16_t>({0, 1000, 65535, 40000}), {2, 2},
+                 Dtype::UInt16, device);
+    EXPECT_EQ(DtypeUtil::ByteSize(depth.GetDtype()), 2);
+    EXPECT_EQ(depth.To(Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({0, 1000, 65535, 40000}));
+    EXPECT_EQ((depth + depth).ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({0, 2000, 65534, 14464}));
+    EXPECT_EQ(depth[1].ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({65535, 40000}));
+
+    Tensor a(std::vector<int16_t>({-3, 7, 32767, -32768}), {4}, Dtype::Int16,
+             device);
+    Tensor b(std::vector<int16_t>({2, 2, 1, -1}), {4}, Dtype::Int16, device);
+    EXPECT_EQ((a * b).ToFlatVector<int16_t>(),
+              std::vector<int16_t>({-6, 14, 32767, -32768}));
+    EXPECT_EQ((a > b).ToFlatVector<bool>(),
+              std::vector<bool>({false, true, true, false}));
+    EXPECT_EQ(a.Neg().ToFlatVector<int16_t>(),
+              std::vector<int16_t>({3, -7, -32767, -32768}));
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBroadcast) {
     Device dst_device;
     Device src_device;
@@ -1609,6 +1665,173 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceArgMinMaxNonContiguous) {
+    Device device = GetParam();
+    Tensor src(
+            std::vector<float>({22, 23, 20, 9, 6, 14, 18, 13, 15, 3, 17, 0,
+                                7,  21, 11, 1, 4, 2,  10, 19, 5,  8, 16, 12}),
+            {2, 3, 4}, Dtype::Float32, device);
+
+    // Indices are into the logical (row-major) order of the reduced dims,
+    // regardless of the memory layout.
+    Tensor src_t = src.Permute({2, 0, 1});
+    EXPECT_EQ(src_t.ArgMin({0, 1, 2}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({20}));
+    EXPECT_EQ(src_t.ArgMax({0, 1, 2}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({6}));
+    EXPECT_EQ(src_t.ArgMin({2}).ToFlatVector<int64_t>(),
+              src.ArgMin({1}).T().ToFlatVector<int64_t>());
+
+    // Ties resolve to the first index.
+    Tensor ties = Tensor::Ones({3, 1000}, Dtype::Int32, device);
+    EXPECT_EQ(ties.ArgMax({1}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 0, 0}));
+    EXPECT_EQ(ties.ArgMin({0, 1}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0}));
+}
+
+TEST_P(TensorPermuteDevices, ReduceMaxNegative) {
+    Device device = GetParam();
+    Tensor src(std::vector<float>({-3, -1, -2, -5}), {2, 2}, Dtype::Float32,
+               device);
+    EXPECT_EQ(src.Max({0, 1}).ToFlatVector<float>(), std::vector<float>({-1}));
+    EXPECT_EQ(src.Max({0}).ToFlatVector<float>(),
+              std::vector<float>({-2, -1}));
+}
+
+// Mean is only implemented on the CPU.
+TEST(Tensor, ReduceMean) {
+    Device device("CPU:0");
+    Tensor src(std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}),
+               {2, 3, 2}, Dtype::Float32, device);
+
+    Tensor dst = src.Mean({0, 1, 2});
+    EXPECT_EQ(dst.GetShape(), SizeVector({}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({5.5}));
+
+    dst = src.Mean({1}, true);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 1, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({2, 3, 8, 9}));
+
+    dst = src.Mean({0, 2});
+    EXPECT_EQ(dst.GetShape(), SizeVector({3}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({3.5, 5.5, 7.5}));
+
+    Tensor src_int = Tensor::Ones({2, 3}, Dtype::Int32, device);
+    EXPECT_ANY_THROW(src_int.Mean({0}));
+}
+
+// Var/Std is only implemented on the CPU.
+TEST(Tensor, ReduceVarStd) {
+    Device device("CPU:0");
+    Tensor src(std::vector<double>({1, 2, 3, 4, 2, 4, 6, 8}), {2, 4},
+               Dtype::Float64, device);
+
+    Tensor dst = src.Var({1});
+    EXPECT_EQ(dst.GetShape(), SizeVector({2}));
+    EXPECT_EQ(dst.ToFlatVector<double>(), std::vector<double>({1.25, 5}));
+
+    dst = src.Var({1}, true, 1);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 1}));
+    std::vector<double> unbiased = dst.ToFlatVector<double>();
+    EXPECT_DOUBLE_EQ(unbiased[0], 5. / 3.);
+    EXPECT_DOUBLE_EQ(unbiased[1], 20. / 3.);
+
+    dst = src.Std({0});
+    EXPECT_EQ(dst.ToFlatVector<double>(),
+              std::vector<double>({0.5, 1, 1.5, 2}));
+
+    std::vector<double> std_all = src.Std({0, 1}).ToFlatVector<double>();
+    EXPECT_DOUBLE_EQ(std_all[0], std::sqrt(4.6875));
+}
+
+// Any/All is only implemented on the CPU.
+TEST(Tensor, ReduceAnyAll) {
+    Device device("CPU:0");
+    Tensor src(std::vector<bool>({false, false, true, true, false, true}),
+               {2, 3}, Dtype::Bool, device);
+
+    EXPECT_EQ(src.Any({0}).ToFlatVector<bool>(),
+              std::vector<bool>({true, false, true}));
+    EXPECT_EQ(src.All({0}).ToFlatVector<bool>(),
+              std::vector<bool>({false, false, true}));
+    EXPECT_EQ(src.Any({1}, true).GetShape(), SizeVector({2, 1}));
+    EXPECT_EQ(src.Any({1}, true).ToFlatVector<bool>(),
+              std::vector<bool>({true, true}));
+    EXPECT_EQ(src.All({0, 1}).ToFlatVector<bool>(), std::vector<bool>({false}));
+
+    // Non-boolean inputs are tested against zero.
+    Tensor src_float(std::vector<float>({0, 0.5, 1, 2}), {4}, Dtype::Float32,
+                     device);
+    EXPECT_EQ(src_float.Any({0}).ToFlatVector<bool>(),
+              std::vector<bool>({true}));
+    EXPECT_EQ(src_float.All({0}).ToFlatVector<bool>(),
+              std::vector<bool>({false}));
+}
+
+TEST_P(TensorPermuteDevices, ReduceSumFloat32Precision) {
+    Device device = GetParam();
+
+    // A naive float accumulator stops growing at 2^24.
+    int64_t n = (1 << 24) + (1 << 20);
+    Tensor src = Tensor::Ones({n}, Dtype::Float32, device);
+    EXPECT_EQ(src.Sum({0}).ToFlatVector<float>(),
+              std::vector<float>({float(n)}));
+    EXPECT_EQ(src.Mean({0}).ToFlatVector<float>(), std::vector<float>({1}));
+
+    // Few outputs with long reductions along a strided dimension.
+    Tensor src_2d = Tensor::Full({n / 4, 4}, 0.1f, Dtype::Float32, device);
+    std::vector<float> sums = src_2d.Sum({0}).ToFlatVector<float>();
+    for (float sum : sums) {
+        EXPECT_NEAR(sum, 0.1 * (n / 4), 1e-6 * n);
+    }
+}
+
+TEST_P(TensorPermuteDevices, ReduceMatchesNaive) {
+    Device device = GetParam();
+
+    // Covers single-output, tiled-output and chunked reductions, over
+    // contiguous and transposed inputs.
+    for (const std::pair<int64_t, int64_t>& rows_cols :
+         std::vector<std::pair<int64_t, int64_t>>{
+                 {3, 70001}, {70001, 3}, {257, 129}}) {
+        int64_t rows = rows_cols.first;
+        int64_t cols = rows_cols.second;
+        std::vector<int64_t> vals(rows * cols);
+        for (int64_t i = 0; i < rows * cols; ++i) {
+            vals[i] = (i * 7919) % 1013 - 500;
+        }
+        std::vector<int64_t> row_sums(rows, 0), col_sums(cols, 0);
+        std::vector<int64_t> row_argmin(rows, 0), col_argmax(cols, 0);
+        int64_t total = 0;
+        for (int64_t r = 0; r < rows; ++r) {
+            for (int64_t c = 0; c < cols; ++c) {
+                int64_t v = vals[r * cols + c];
+                row_sums[r] += v;
+                col_sums[c] += v;
+                total += v;
+                if (v < vals[r * cols + row_argmin[r]]) {
+                    row_argmin[r] = c;
+                }
+                if (v > vals[col_argmax[c] * cols + c]) {
+                    col_argmax[c] = r;
+                }
+            }
+        }
+
+        Tensor src(vals, {rows, cols}, Dtype::Int64, device);
+        Tensor src_t = src.T().Contiguous().T();
+        for (const Tensor& t : {src, src_t}) {
+            EXPECT_EQ(t.Sum({1}).ToFlatVector<int64_t>(), row_sums);
+            EXPECT_EQ(t.Sum({0}).ToFlatVector<int64_t>(), col_sums);
+            EXPECT_EQ(t.Sum({0, 1}).ToFlatVector<int64_t>(),
+                      std::vector<int64_t>({total}));
+            EXPECT_EQ(t.ArgMin({1}).ToFlatVector<int64_t>(), row_argmin);
+            EXPECT_EQ(t.ArgMax({0}).ToFlatVector<int64_t>(), col_argmax);
+        }
+    }
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     Device device = GetParam();
     Tensor src(std::vector<float>({0, 1, 4, 9, 16, 25}), {2, 3}, Dtype::Float32,
@@ -1976,6 +2199,277 @@ TEST_P(TensorPermuteDevices, Ne) {
     EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({0, 1, 1, 1}));
 }
 
+template <typename T>
+static void CheckVectorizedEWMatchesScalar(Dtype dtype) {
+    Device device("CPU:0");
+    // Sizes cover a single element, lengths around the 2, 4, 8 and 16 lane
+    // vector widths, and a multi-threaded launch.
+    for (int64_t n : {1, 3, 4, 7, 8, 9, 15, 16, 17, 31, 33, 37, 10007}) {
+        const int64_t base_n = 2 * n + 1;
+        std::vector<T> a_vals(base_n);
+        std::vector<T> b_vals(base_n);
+        for (int64_t i = 0; i < base_n; ++i) {
+            a_vals[i] = static_cast<T>(i % 17) - static_cast<T>(8);
+            b_vals[i] = static_cast<T>(i % 13) + static_cast<T>(1);
+        }
+        Tensor a_base(a_vals, {base_n}, dtype, device);
+        Tensor b_base(b_vals, {base_n}, dtype, device);
+        Tensor s(std::vector<T>{static_cast<T>(3)}, {1}, dtype, device);
+
+        // Contiguous views, contiguous views whose data pointer is offset by
+        // one element, and strided views, which take the non-vectorized
+        // fallback.
+        const std::vector<std::pair<Tensor, Tensor>> views = {
+                {a_base.Slice(0, 0, n), b_base.Slice(0, 0, n)},
+                {a_base.Slice(0, 1, n + 1), b_base.Slice(0, 1, n + 1)},
+                {a_base.Slice(0, 0, 2 * n, 2), b_base.Slice(0, 1, 2 * n, 2)},
+                {a_base.Slice(0, 1, n + 1), b_base.Slice(0, 0, 2 * n, 2)}};
+        auto compute = [&]() -> std::vector<std::vector<T>> {
+            std::vector<std::vector<T>> results;
+            for (const auto& view : views) {
+                const Tensor& a = view.first;
+                const Tensor& b = view.second;
+                std::vector<T> a_flat = a.ToFlatVector<T>();
+                std::vector<T> b_flat = b.ToFlatVector<T>();
+                std::vector<T> sum(n);
+                for (int64_t i = 0; i < n; ++i) {
+                    sum[i] = a_flat[i] + b_flat[i];
+                }
+                EXPECT_EQ((a + b).ToFlatVector<T>(), sum);
+                for (Tensor r : {a + b, a - b, a * b, a / b, a + s, s - a,
+                                 s / b, a.Neg(), a.Abs()}) {
+                    results.push_back(r.ToFlatVector<T>());
+                }
+                if (std::is_floating_point<T>::value) {
+                    results.push_back(b.Sqrt().ToFlatVector<T>());
+                }
+                // In-place into an offset view of a larger tensor.
+                Tensor dst = a_base.Copy(device);
+                dst.Slice(0, 1, n + 1).Add_(b);
+                results.push_back(dst.ToFlatVector<T>());
+            }
+            return results;
+        };
+
+        utility::SetMaxSIMDLevel(utility::SIMDLevel::Scalar);
+        std::vector<std::vector<T>> expected = compute();
+        for (int level = static_cast<int>(utility::SIMDLevel::SSE2);
+             level <= static_cast<int>(utility::GetCPUSIMDLevel()); ++level) {
+            utility::SetMaxSIMDLevel(static_cast<utility::SIMDLevel>(level));
+            EXPECT_EQ(compute(), expected);
+        }
+        utility::SetMaxSIMDLevel(utility::SIMDLevel::AVX512);
+    }
+}
+
+TEST(Tensor, VectorizedEWMatchesScalar) {
+    CheckVectorizedEWMatchesScalar<float>(Dtype::Float32);
+    CheckVectorizedEWMatchesScalar<double>(Dtype::Float64);
+    CheckVectorizedEWMatchesScalar<int32_t>(Dtype::Int32);
+    CheckVectorizedEWMatchesScalar<int64_t>(Dtype::Int64);
+}
+
+// The F16C conversion is only implemented on the CPU.
+TEST(Tensor, Float16CopyMatchesScalar) {
+    Device device("CPU:0");
+    utility::SIMDLevel cpu_level = utility::GetCPUSIMDLevel();
+
+    // Covers normals, subnormals, overflow, ties and non-multiples of the
+    // vector width.
+    std::vector<float> vals;
+    for (int i = -520; i < 523; ++i) {
+        vals.push_back(static_cast<float>(i) * 0.37f);
+        vals.push_back(std::ldexp(static_cast<float>(i), -30));
+        vals.push_back(std::ldexp(static_cast<float>(i), 8));
+    }
+    vals.push_back(1.f + std::ldexp(1.f, -11));
+    vals.push_back(std::numeric_limits<float>::infinity());
+    vals.push_back(-std::numeric_limits<float>::infinity());
+    Tensor src(vals, {static_cast<int64_t>(vals.size())}, Dtype::Float32,
+               device);
+
+    for (utility::SIMDLevel level :
+         {utility::SIMDLevel::Scalar, utility::SIMDLevel::AVX2}) {
+        utility::SetMaxSIMDLevel(level);
+        Tensor half = src.To(Dtype::Float16);
+        std::vector<Half> half_vals = half.ToFlatVector<Half>();
+        for (size_t i = 0; i < vals.size(); ++i) {
+            EXPECT_EQ(half_vals[i].bits_, Half(vals[i]).bits_);
+        }
+        std::vector<float> back = half.To(Dtype::Float32).ToFlatVector<float>();
+        for (size_t i = 0; i < vals.size(); ++i) {
+            EXPECT_EQ(back[i], static_cast<float>(half_vals[i]));
+        }
+
+        // Broadcasted scalar source.
+        Tensor dst = Tensor::Empty({11}, Dtype::Float16, device);
+        dst.CopyFrom(src[1].To(Dtype::Float32).Expand({11}).To(Dtype::Float32));
+        EXPECT_EQ(dst.ToFlatVector<Half>()[10].bits_, Half(vals[1]).bits_);
+    }
+    utility::SetMaxSIMDLevel(cpu_level);
+}
+
+// Float16 reductions are only implemented on the CPU.
+TEST(Tensor, ReduceFloat16) {
+    Device device("CPU:0");
+
+    // Accumulating in Float16 would stop at 2048 and overflow the mean.
+    Tensor src = Tensor::Ones({100000}, Dtype::Float16, device);
+    EXPECT_EQ(float(src.Mean({0}).Item<Half>()), 1.f);
+    EXPECT_TRUE(std::isinf(float(src.Sum({0}).Item<Half>())));
+    Tensor tenths = Tensor::Full<float>({4000}, 0.1f, Dtype::Float16, device);
+    EXPECT_EQ(float(tenths.Sum({0}).Item<Half>()),
+              float(Half(4000 * float(Half(0.1f)))));
+
+    Tensor vals(std::vector<Half>({Half(1.5f), Half(-2.f), Half(4.f),
+                                   Half(0.5f)}),
+                {2, 2}, Dtype::Float16, device);
+    EXPECT_EQ(float(vals.Max({0, 1}).Item<Half>()), 4.f);
+    EXPECT_EQ(float(vals.Min({0, 1}).Item<Half>()), -2.f);
+    EXPECT_EQ(vals.ArgMax({0, 1}).Item<int64_t>(), 2);
+    EXPECT_EQ(float(vals.Prod({0, 1}).Item<Half>()), -6.f);
+    EXPECT_EQ(float(vals.Std({0, 1}).Item<Half>()),
+              float(Half(std::sqrt(4.625f))));
+    EXPECT_EQ(float(vals.Sqrt().Abs()[1][1].Item<Half>()),
+              float(Half(std::sqrt(0.5f))));
+    EXPECT_EQ(vals.ToString(false), "[[1.5 -2],\n [4 0.5]]");
+}
+
+/// Row-major reference product of a (m x k) and b (k x n).
+template <typename T>
+static std::vector<T> NaiveMatmul(const std::vector<T>& a,
+                                  const std::vector<T>& b,
+                                  int64_t m,
+                                  int64_t k,
+                                  int64_t n) {
+    std::vector<T> c(m * n, 0);
+    for (int64_t i = 0; i < m; ++i) {
+        for (int64_t p = 0; p < k; ++p) {
+            for (int64_t j = 0; j < n; ++j) {
+                c[i * n + j] += a[i * k + p] * b[p * n + j];
+            }
+        }
+    }
+    return c;
+}
+
+// Matmul is only implemented on the CPU.
+TEST(Tensor, Matmul) {
+    Device device("CPU:0");
+    Tensor a(std::vector<float>({1, 2, 3, 4, 5, 6}), {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>({7, 8, 9, 10, 11, 12}), {3, 2},
+             Dtype::Float32, device);
+    Tensor c = a.Matmul(b);
+    EXPECT_EQ(c.GetShape(), SizeVector({2, 2}));
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>({58, 64, 139, 154}));
+
+    // Non-contiguous operands.
+    c = b.T().Matmul(a.T());
+    EXPECT_EQ(c.GetShape(), SizeVector({2, 2}));
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>({58, 139, 64, 154}));
+
+    // 1-D operands.
+    Tensor v(std::vector<float>({1, 0, -1}), {3}, Dtype::Float32, device);
+    EXPECT_EQ(a.Matmul(v).GetShape(), SizeVector({2}));
+    EXPECT_EQ(a.Matmul(v).ToFlatVector<float>(), std::vector<float>({-2, -2}));
+    EXPECT_EQ(v.Matmul(b).GetShape(), SizeVector({2}));
+    EXPECT_EQ(v.Matmul(b).ToFlatVector<float>(), std::vector<float>({-4, -4}));
+    EXPECT_EQ(v.Matmul(v).GetShape(), SizeVector({}));
+    EXPECT_EQ(v.Matmul(v).ToFlatVector<float>(), std::vector<float>({2}));
+
+    // Empty inner dimension.
+    c = Tensor::Empty({2, 0}, Dtype::Float32, device)
+                .Matmul(Tensor::Empty({0, 3}, Dtype::Float32, device));
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>(6, 0));
+
+    EXPECT_THROW(a.Matmul(a), std::runtime_error);
+    EXPECT_THROW(a.Matmul(b.To(Dtype::Float64)), std::runtime_error);
+    EXPECT_THROW(Tensor(std::vector<float>({1}), {}, Dtype::Float32, device)
+                         .Matmul(a),
+                 std::runtime_error);
+}
+
+TEST(Tensor, MatmulBatchBroadcast) {
+    Device device("CPU:0");
+    std::vector<int32_t> a_vals(2 * 1 * 2 * 3);
+    std::vector<int32_t> b_vals(3 * 3 * 4);
+    for (size_t i = 0; i < a_vals.size(); ++i) {
+        a_vals[i] = int32_t(i) - 5;
+    }
+    for (size_t i = 0; i < b_vals.size(); ++i) {
+        b_vals[i] = int32_t(i % 7) - 3;
+    }
+    Tensor a(a_vals, {2, 1, 2, 3}, Dtype::Int32, device);
+    Tensor b(b_vals, {3, 3, 4}, Dtype::Int32, device);
+    Tensor c = a.Matmul(b);
+    EXPECT_EQ(c.GetShape(), SizeVector({2, 3, 2, 4}));
+
+    std::vector<int32_t> expected;
+    for (int64_t i = 0; i < 2; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            std::vector<int32_t> a_mat(a_vals.begin() + i * 6,
+                                       a_vals.begin() + (i + 1) * 6);
+            std::vector<int32_t> b_mat(b_vals.begin() + j * 12,
+                                       b_vals.begin() + (j + 1) * 12);
+            std::vector<int32_t> c_mat = NaiveMatmul(a_mat, b_mat, 2, 3, 4);
+            expected.insert(expected.end(), c_mat.begin(), c_mat.end());
+        }
+    }
+    EXPECT_EQ(c.ToFlatVector<int32_t>(), expected);
+
+    EXPECT_THROW(a.Matmul(Tensor::Empty({3, 2, 3, 4}, Dtype::Int32, device)),
+                 std::runtime_error);
+}
+
+TEST(Tensor, MatmulBlocked) {
+    Device device("CPU:0");
+
+    // Larger than one cache block in every dimension, with ragged edges.
+    const int64_t m = 131;
+    const int64_t k = 263;
+    const int64_t n = 1031;
+    std::vector<int64_t> a_vals(m * k);
+    std::vector<int64_t> b_vals(k * n);
+    for (int64_t i = 0; i < m * k; ++i) {
+        a_vals[i] = (i * 7919) % 13 - 6;
+    }
+    for (int64_t i = 0; i < k * n; ++i) {
+        b_vals[i] = (i * 104729) % 11 - 5;
+    }
+    std::vector<int64_t> expected = NaiveMatmul(a_vals, b_vals, m, k, n);
+
+    Tensor a(a_vals, {m, k}, Dtype::Int64, device);
+    Tensor b(b_vals, {k, n}, Dtype::Int64, device);
+    for (int level = static_cast<int>(utility::SIMDLevel::SSE2);
+         level <= static_cast<int>(utility::GetCPUSIMDLevel()); ++level) {
+        utility::SetMaxSIMDLevel(static_cast<utility::SIMDLevel>(level));
+        EXPECT_EQ(a.Matmul(b).ToFlatVector<int64_t>(), expected);
+    }
+    utility::SetMaxSIMDLevel(utility::SIMDLevel::AVX512);
+
+    // Thin products are computed transposed.
+    std::vector<int64_t> b_thin_vals(k * 3);
+    for (int64_t p = 0; p < k; ++p) {
+        for (int64_t j = 0; j < 3; ++j) {
+            b_thin_vals[p * 3 + j] = b_vals[p * n + j];
+        }
+    }
+    EXPECT_EQ(a.Matmul(b.Slice(1, 0, 3)).ToFlatVector<int64_t>(),
+              NaiveMatmul(a_vals, b_thin_vals, m, k, 3));
+
+    // Float64 operands go through BLAS when it is available.
+    std::vector<double> expected_double(expected.begin(), expected.end());
+    Tensor c = a.To(Dtype::Float64).Matmul(b.To(Dtype::Float64));
+    EXPECT_EQ(c.ToFlatVector<double>(), expected_double);
+    c = a.To(Dtype::Float64)
+                .T()
+                .Contiguous()
+                .T()
+                .Matmul(b.To(Dtype::Float64).T().Contiguous().T());
+    EXPECT_EQ(c.ToFlatVector<double>(), expected_double);
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     Device device = GetParam();
 
@@ -2138,3 +2632,57 @@ TEST_P(TensorPermuteDevices, ScalarOperatorOverload) {
     a /= true;
     EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({5, 5}));
 }
+
+TEST_P(TensorPermuteDevices, BinaryEWHighRankStrided) {
+    Device device = GetParam();
+
+    // src has shape {2, 3, 2, 2, 3}, src_t is its reversed view of shape
+    // {3, 2, 2, 3, 2} and b broadcasts along dims 0, 2 and 4 of src_t.
+    std::vector<float> src_vals(72);
+    for (size_t i = 0; i < src_vals.size(); ++i) {
+        src_vals[i] = static_cast<float>(i);
+    }
+    Tensor src(src_vals, {2, 3, 2, 2, 3}, Dtype::Float32, device);
+    Tensor src_t = src.Permute({4, 3, 2, 1, 0});
+    Tensor b(std::vector<float>{100, 200, 300, 400, 500, 600}, {1, 2, 1, 3, 1},
+             Dtype::Float32, device);
+
+    Tensor dst = src_t.Add(b);
+    EXPECT_EQ(dst.GetShape(), SizeVector({3, 2, 2, 3, 2}));
+    std::vector<float> expected;
+    for (int64_t i0 = 0; i0 < 3; ++i0) {
+        for (int64_t i1 = 0; i1 < 2; ++i1) {
+            for (int64_t i2 = 0; i2 < 2; ++i2) {
+                for (int64_t i3 = 0; i3 < 3; ++i3) {
+                    for (int64_t i4 = 0; i4 < 2; ++i4) {
+                        int64_t src_idx =
+                                (((i4 * 3 + i3) * 2 + i2) * 2 + i1) * 3 + i0;
+                        expected.push_back(src_vals[src_idx] +
+                                           100.f * (i1 * 3 + i3 + 1));
+                    }
+                }
+            }
+        }
+    }
+    EXPECT_EQ(dst.ToFlatVector<float>(), expected);
+
+    // Reduce the strided view over two non-adjacent dims.
+    Tensor sum = src_t.Sum({1, 3});
+    EXPECT_EQ(sum.GetShape(), SizeVector({3, 2, 2}));
+    std::vector<float> sum_vals = sum.ToFlatVector<float>();
+    for (int64_t i0 = 0; i0 < 3; ++i0) {
+        for (int64_t i2 = 0; i2 < 2; ++i2) {
+            for (int64_t i4 = 0; i4 < 2; ++i4) {
+                float expected_sum = 0;
+                for (int64_t i1 = 0; i1 < 2; ++i1) {
+                    for (int64_t i3 = 0; i3 < 3; ++i3) {
+                        expected_sum += src_vals[(((i4 * 3 + i3) * 2 + i2) * 2 +
+                                                  i1) * 3 +
+                                                 i0];
+                    }
+                }
+                EXPECT_EQ(sum_vals[(i0 * 2 + i2) * 2 + i4], expected_sum);
+            }
+        }
+    }
+}
@@ -0,0 +1,200 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/TensorExpr.h"
+
+#include <cmath>
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace std;
+using namespace open3d;
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static void ExpectAllNear(const Tensor& expected, const Tensor& actual) {
+    EXPECT_EQ(expected.GetShape(), actual.GetShape());
+    EXPECT_EQ(expected.GetDtype(), actual.GetDtype());
+    vector<float> expected_vals = expected.ToFlatVector<float>();
+    vector<float> actual_vals = actual.ToFlatVector<float>();
+    ASSERT_EQ(expected_vals.size(), actual_vals.size());
+    for (size_t i = 0; i < expected_vals.size(); ++i) {
+        EXPECT_NEAR(expected_vals[i], actual_vals[i], 1e-5);
+    }
+}
+
+TEST_P(TensorExprPermuteDevices, Leaf) {
+    Device device = GetParam();
+
+    Tensor a(vector<float>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Float32, device);
+    TensorExpr expr = a.Lazy();
+    EXPECT_TRUE(expr.IsLeaf());
+    EXPECT_EQ(expr.NumOps(), 0);
+    EXPECT_EQ(expr.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(expr.GetDtype(), Dtype::Float32);
+    EXPECT_EQ(expr.GetDevice(), device);
+    EXPECT_EQ(expr.Contiguous().ToFlatVector<float>(),
+              a.ToFlatVector<float>());
+}
+
+TEST_P(TensorExprPermuteDevices, FusedMatchesEager) {
+    Device device = GetParam();
+
+    Tensor a(vector<float>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Float32, device);
+    Tensor b(vector<float>{5, 4, 3, 2, 1, 0}, {2, 3}, Dtype::Float32, device);
+    Tensor c(vector<float>{2, 2, 2, -1, -1, -1}, {2, 3}, Dtype::Float32,
+             device);
+    Tensor d(vector<float>{1, 1, 1, 1, 1, 1}, {2, 3}, Dtype::Float32, device);
+
+    TensorExpr expr = (a.Lazy() - b) * c + d;
+    EXPECT_FALSE(expr.IsLeaf());
+    EXPECT_EQ(expr.NumOps(), 3);
+    ExpectAllNear((a - b) * c + d, expr.Contiguous());
+
+    // Repeated leaves and unary ops.
+    ExpectAllNear(
+            ((a * a + b).Sqrt() - a.Abs()) / (c * 2.f),
+            (((a.Lazy() * a + b).Sqrt() - a.Lazy().Abs()) / (c.Lazy() * 2))
+                    .Contiguous());
+    ExpectAllNear(a.Sin() * a.Cos() + a.Neg().Exp(),
+                  (a.Lazy().Sin() * a.Lazy().Cos() + (-a.Lazy()).Exp())
+                          .Contiguous());
+}
+
+TEST_P(TensorExprPermuteDevices, Broadcast) {
+    Device device = GetParam();
+
+    Tensor a(vector<float>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Float32, device);
+    Tensor row(vector<float>{10, 20, 30}, {3}, Dtype::Float32, device);
+    Tensor col(vector<float>{1, 2}, {2, 1}, Dtype::Float32, device);
+
+    Tensor result = ((a.Lazy() + row) * col).Contiguous();
+    EXPECT_EQ(result.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(result.ToFlatVector<float>(),
+              vector<float>({10, 21, 32, 26, 48, 70}));
+
+    // Broadcasting both operands to a larger shape.
+    Tensor outer = (row.Lazy() + col).Contiguous();
+    EXPECT_EQ(outer.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(outer.ToFlatVector<float>(),
+              vector<float>({11, 21, 31, 12, 22, 32}));
+
+    EXPECT_ANY_THROW(a.Lazy() + Tensor::Ones({4}, Dtype::Float32, device));
+}
+
+TEST_P(TensorExprPermuteDevices, AssignToSlice) {
+    Device device = GetParam();
+
+    Tensor a(vector<float>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Float32, device);
+    Tensor b(vector<float>{1, 1, 1}, {3}, Dtype::Float32, device);
+
+    Tensor dst = Tensor::Full({2, 3}, 7.f, Dtype::Float32, device);
+    dst.Slice(0, 1, 2) = a.Slice(0, 0, 1).Lazy() * 2 - b;
+    EXPECT_EQ(dst.ToFlatVector<float>(), vector<float>({7, 7, 7, -1, 1, 3}));
+
+    // Non-contiguous destination.
+    Tensor dst_t = Tensor::Zeros({3, 2}, Dtype::Float32, device).T();
+    (a.Lazy() + b).AssignTo(dst_t);
+    EXPECT_EQ(dst_t.ToFlatVector<float>(), vector<float>({1, 2, 3, 4, 5, 6}));
+
+    // Shape and dtype mismatches.
+    Tensor dst_small = Tensor::Zeros({3}, Dtype::Float32, device);
+    EXPECT_ANY_THROW(dst_small.AsRvalue() = a.Lazy() + b);
+    Tensor dst_int = Tensor::Zeros({2, 3}, Dtype::Int32, device);
+    EXPECT_ANY_THROW(dst_int.AsRvalue() = a.Lazy() + b);
+}
+
+TEST_P(TensorExprPermuteDevices, AssignAliasing) {
+    Device device = GetParam();
+
+    // In-place update of a leaf.
+    Tensor a(vector<float>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Float32, device);
+    a.AsRvalue() = a.Lazy() * 2 + 1;
+    EXPECT_EQ(a.ToFlatVector<float>(), vector<float>({1, 3, 5, 7, 9, 11}));
+
+    // The destination overlaps a differently strided view of an input.
+    Tensor b(vector<float>{0, 1, 2, 3}, {2, 2}, Dtype::Float32, device);
+    b.AsRvalue() = b.T().Lazy() + b;
+    EXPECT_EQ(b.ToFlatVector<float>(), vector<float>({0, 3, 3, 6}));
+}
+
+TEST_P(TensorExprPermuteDevices, Int32) {
+    Device device = GetParam();
+
+    Tensor a(vector<int>{-3, -2, -1, 0, 1, 2}, {2, 3}, Dtype::Int32, device);
+    Tensor b(vector<int>{2, 2, 2, 2, 2, 2}, {2, 3}, Dtype::Int32, device);
+
+    Tensor r = (((a.Lazy() + b) * b - a.Lazy().Abs()) / b).Contiguous();
+    EXPECT_EQ(r.ToFlatVector<int>(),
+              (((a + b) * b - a.Abs()) / b).ToFlatVector<int>());
+    EXPECT_ANY_THROW(a.Lazy().Sqrt().Contiguous());
+}
+
+TEST_P(TensorExprPermuteDevices, ManyInputs) {
+    Device device = GetParam();
+
+    // More distinct leaves than a single fused kernel accepts.
+    const int num_leaves = 24;
+    vector<Tensor> leaves;
+    for (int i = 0; i < num_leaves; ++i) {
+        leaves.push_back(
+                Tensor::Full({4, 5}, float(i), Dtype::Float32, device));
+    }
+    TensorExpr expr = leaves[0];
+    Tensor eager = leaves[0];
+    for (int i = 1; i < num_leaves; ++i) {
+        expr = expr + leaves[i];
+        eager = eager + leaves[i];
+    }
+    EXPECT_EQ(expr.NumOps(), num_leaves - 1);
+    EXPECT_EQ(expr.Contiguous().ToFlatVector<float>(),
+              eager.ToFlatVector<float>());
+}
+
+TEST_P(TensorExprPermuteDevices, LargeContiguous) {
+    Device device = GetParam();
+
+    // Spans several fused blocks and leaves a ragged tail.
+    const int64_t n = 100003;
+    vector<float> a_vals(n);
+    vector<float> b_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        a_vals[i] = float(i % 97) * 0.5f;
+        b_vals[i] = float(i % 13) + 1.f;
+    }
+    Tensor a(a_vals, {n}, Dtype::Float32, device);
+    Tensor b(b_vals, {n}, Dtype::Float32, device);
+    ExpectAllNear((a - b) * b + a / b,
+                  ((a.Lazy() - b) * b + a.Lazy() / b).Contiguous());
+}
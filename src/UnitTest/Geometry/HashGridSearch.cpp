@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/HashGridSearch.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+// Checks radius and hybrid searches of \p grid against an exhaustive search
+// over \p points. Neighbors must come sorted by distance, then by index.
+static void ExpectMatchesBruteForce(const geometry::HashGridSearch &grid,
+                                    const vector<Vector3d> &points,
+                                    const vector<Vector3d> &queries,
+                                    double radius) {
+    const int max_nn = 15;
+    const double radius2 = float(radius * radius);
+    for (const Vector3d &query : queries) {
+        vector<pair<double, int>> all;
+        for (int i = 0; i < int(points.size()); i++) {
+            double d2 = (points[i] - query).squaredNorm();
+            if (d2 < radius2) {
+                all.emplace_back(d2, i);
+            }
+        }
+        sort(all.begin(), all.end());
+
+        vector<int> indices;
+        vector<double> distance2;
+        auto expect_prefix = [&](int k) {
+            ASSERT_EQ(int(indices.size()), k);
+            ASSERT_EQ(int(distance2.size()), k);
+            for (int i = 0; i < k; i++) {
+                EXPECT_EQ(indices[i], all[i].second);
+                EXPECT_EQ(distance2[i], all[i].first);
+            }
+        };
+        EXPECT_EQ(grid.SearchRadius(query, radius, indices, distance2),
+                  int(all.size()));
+        expect_prefix(int(all.size()));
+        EXPECT_EQ(grid.SearchHybrid(query, radius, max_nn, indices, distance2),
+                  min(max_nn, int(all.size())));
+        expect_prefix(min(max_nn, int(all.size())));
+    }
+}
+
+TEST(HashGridSearch, MatchesBruteForce) {
+    vector<Vector3d> points(5000);
+    Rand(points, Vector3d(-5.0, -5.0, -5.0), Vector3d(5.0, 5.0, 5.0), 0);
+    vector<Vector3d> queries(points.begin(), points.begin() + 100);
+    vector<Vector3d> random_queries(100);
+    Rand(random_queries, Vector3d(-6.0, -6.0, -6.0), Vector3d(6.0, 6.0, 6.0),
+         1);
+    queries.insert(queries.end(), random_queries.begin(),
+                   random_queries.end());
+
+    const double radius = 0.8;
+    // Cells matching the radius, smaller cells that need a wider stencil, and
+    // cells so small that the stencil covers every bucket.
+    for (double cell_size : {radius, 0.3 * radius, 0.01}) {
+        geometry::HashGridSearch grid(points, cell_size);
+        EXPECT_EQ(grid.GetCellSize(), cell_size);
+        ExpectMatchesBruteForce(grid, points, queries, radius);
+        // Searching past the cell size widens the stencil.
+        ExpectMatchesBruteForce(grid, points, queries, 1.7 * radius);
+    }
+
+    geometry::HashGridSearch empty(vector<Vector3d>(), radius);
+    vector<int> indices;
+    vector<double> distance2;
+    EXPECT_EQ(empty.SearchRadius(Vector3d::Zero(), radius, indices, distance2),
+              -1);
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST(HashGridSearch, SearchBatch) {
+    vector<Vector3d> points(3000);
+    Rand(points, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::HashGridSearch grid(points, 1.0);
+
+    MatrixXd queries = MatrixXd::Random(3, 200) * 5.0;
+    queries.array() += 5.0;
+    geometry::KDTreeSearchParamRadius radius_param(1.0);
+    geometry::KDTreeSearchParamHybrid hybrid_param(1.0, 20);
+    const geometry::KDTreeSearchParam *params[] = {&radius_param,
+                                                   &hybrid_param};
+    for (const geometry::KDTreeSearchParam *param : params) {
+        geometry::KDTreeSearchResult result;
+        EXPECT_TRUE(grid.SearchBatch(queries, *param, result));
+        ASSERT_EQ(result.NumQueries(), queries.cols());
+        for (int64_t i = 0; i < queries.cols(); i++) {
+            vector<int> indices;
+            vector<double> distance2;
+            int k = grid.Search(Vector3d(queries.col(i)), *param, indices,
+                                distance2);
+            ASSERT_EQ(result.NumNeighbors(i), k);
+            ExpectEQ(indices,
+                     vector<int>(result.Indices(i), result.Indices(i) + k));
+            ExpectEQ(distance2, vector<double>(result.Distance2(i),
+                                               result.Distance2(i) + k));
+        }
+    }
+
+    geometry::KDTreeSearchParamKNN knn_param(10);
+    vector<int> indices;
+    vector<double> distance2;
+    EXPECT_EQ(grid.Search(Vector3d::Zero(), knn_param, indices, distance2),
+              -1);
+    geometry::KDTreeSearchResult result;
+    EXPECT_FALSE(grid.SearchBatch(queries, knn_param, result));
+    EXPECT_EQ(result.NumQueries(), queries.cols());
+    EXPECT_TRUE(result.indices_.empty());
+}
+
+TEST(HashGridSearch, BackendsAgree) {
+    geometry::PointCloud pc;
+    pc.points_.resize(4000);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    // A dense blob so that DBSCAN finds more than noise.
+    vector<Vector3d> blob(2000);
+    Rand(blob, Vector3d(2.0, 2.0, 2.0), Vector3d(4.0, 4.0, 4.0), 1);
+    pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+
+    auto kdtree_outliers = pc.RemoveRadiusOutliers(
+            8, 1.0, geometry::NeighborSearchBackend::KDTree);
+    auto grid_outliers = pc.RemoveRadiusOutliers(
+            8, 1.0, geometry::NeighborSearchBackend::HashGrid);
+    EXPECT_EQ(get<1>(kdtree_outliers), get<1>(grid_outliers));
+
+    ExpectEQ(pc.ClusterDBSCAN(0.3, 10, false,
+                              geometry::NeighborSearchBackend::KDTree),
+             pc.ClusterDBSCAN(0.3, 10, false,
+                              geometry::NeighborSearchBackend::HashGrid));
+
+    pc.EstimateNormals();
+    geometry::KDTreeSearchParamHybrid param(0.8, 50);
+    auto kdtree_feature = registration::ComputeFPFHFeature(
+            pc, param, geometry::NeighborSearchBackend::KDTree);
+    auto grid_feature = registration::ComputeFPFHFeature(
+            pc, param, geometry::NeighborSearchBackend::HashGrid);
+    ExpectEQ(kdtree_feature->data_, grid_feature->data_);
+}
@@ -144,3 +144,168 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_indices, indices);
     ExpectEQ(ref_distance2, distance2);
 }
+
+// Checks that a batch search finds, for every query, the same neighbors as the
+// single-query search with the same parameters.
+static void ExpectBatchMatchesSingle(const geometry::KDTreeFlann &kdtree,
+                                     const MatrixXd &queries,
+                                     const geometry::KDTreeSearchParam &param) {
+    geometry::KDTreeSearchResult result;
+    EXPECT_TRUE(kdtree.SearchBatch(queries, param, result));
+    ASSERT_EQ(result.NumQueries(), queries.cols());
+    for (int64_t i = 0; i < queries.cols(); i++) {
+        vector<int> indices;
+        vector<double> distance2;
+        VectorXd query = queries.col(i);
+        int k = kdtree.Search<VectorXd>(query, param, indices, distance2);
+        ASSERT_EQ(result.NumNeighbors(i), k);
+        ExpectEQ(indices,
+                 vector<int>(result.Indices(i), result.Indices(i) + k));
+        ExpectEQ(distance2, vector<double>(result.Distance2(i),
+                                           result.Distance2(i) + k));
+    }
+}
+
+TEST(KDTreeFlann, SearchBatch) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlann kdtree(pc);
+
+    vector<Vector3d> query_points(777);
+    Rand(query_points, Vector3d(-1.0, -1.0, -1.0), Vector3d(11.0, 11.0, 11.0),
+         1);
+    MatrixXd queries(3, query_points.size());
+    for (size_t i = 0; i < query_points.size(); i++) {
+        queries.col(i) = query_points[i];
+    }
+
+    ExpectBatchMatchesSingle(kdtree, queries,
+                             geometry::KDTreeSearchParamKNN(30));
+    ExpectBatchMatchesSingle(kdtree, queries,
+                             geometry::KDTreeSearchParamKNN(2000));
+    ExpectBatchMatchesSingle(kdtree, queries,
+                             geometry::KDTreeSearchParamRadius(1.5));
+    ExpectBatchMatchesSingle(kdtree, queries,
+                             geometry::KDTreeSearchParamHybrid(1.5, 10));
+
+    geometry::KDTreeSearchResult result;
+    EXPECT_TRUE(kdtree.SearchHybridBatch(queries, 1.5, 0, result));
+    EXPECT_EQ(result.NumQueries(), queries.cols());
+    EXPECT_TRUE(result.indices_.empty());
+
+    // Invalid queries give every query an empty neighborhood.
+    EXPECT_FALSE(kdtree.SearchKNNBatch(MatrixXd::Zero(2, 5), 3, result));
+    EXPECT_EQ(result.NumQueries(), 5);
+    EXPECT_EQ(result.NumNeighbors(4), 0);
+    EXPECT_FALSE(kdtree.SearchHybridBatch(queries, 1.0, -1, result));
+    EXPECT_EQ(result.NumQueries(), queries.cols());
+    EXPECT_TRUE(result.indices_.empty());
+}
+
+TEST(KDTreeFlann, SearchBatchInBlocks) {
+    geometry::PointCloud pc;
+    pc.points_.resize(500);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlann kdtree(pc);
+    Map<const MatrixXd> queries((const double *)pc.points_.data(), 3,
+                                pc.points_.size());
+    geometry::KDTreeSearchParamHybrid param(2.0, 20);
+
+    geometry::KDTreeSearchResult full;
+    kdtree.SearchBatch(queries, param, full);
+    int64_t num_visited = 0;
+    kdtree.SearchBatchInBlocks(
+            queries, param,
+            [&](int64_t begin, int64_t end,
+                const geometry::KDTreeSearchResult &result) {
+                EXPECT_LE(end - begin, 64);
+                ASSERT_EQ(result.NumQueries(), end - begin);
+                for (int64_t i = begin; i < end; i++) {
+                    int k = result.NumNeighbors(i - begin);
+                    ASSERT_EQ(k, full.NumNeighbors(i));
+                    ExpectEQ(vector<int>(full.Indices(i), full.Indices(i) + k),
+                             vector<int>(result.Indices(i - begin),
+                                         result.Indices(i - begin) + k));
+                }
+                num_visited += end - begin;
+            },
+            64);
+    EXPECT_EQ(num_visited, int64_t(pc.points_.size()));
+}
+
+// Checks that \p kdtree finds neighbors at the same distances as the double
+// precision tree, and that the reported distances belong to the returned
+// points. Ties between nearly equidistant points may be broken differently.
+template <typename KDTree>
+static void ExpectMatchesDoubleTree(const KDTree &kdtree,
+                                    const geometry::PointCloud &pc,
+                                    const vector<Vector3d> &queries) {
+    geometry::KDTreeFlann reference(pc);
+    geometry::KDTreeSearchParamKNN knn(20);
+    geometry::KDTreeSearchParamHybrid hybrid(1.5, 10);
+    for (const geometry::KDTreeSearchParam *param :
+         {(const geometry::KDTreeSearchParam *)&knn,
+          (const geometry::KDTreeSearchParam *)&hybrid}) {
+        for (const Vector3d &query : queries) {
+            vector<int> indices, ref_indices;
+            vector<double> distance2, ref_distance2;
+            int k = kdtree.Search(query, *param, indices, distance2);
+            int ref_k = reference.Search(query, *param, ref_indices,
+                                         ref_distance2);
+            ASSERT_EQ(k, ref_k);
+            for (int i = 0; i < k; i++) {
+                EXPECT_NEAR(distance2[i], ref_distance2[i], 1e-4);
+                EXPECT_NEAR(distance2[i],
+                            (pc.points_[indices[i]] - query).squaredNorm(),
+                            1e-4);
+            }
+        }
+    }
+}
+
+TEST(KDTreeFlann, Float) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    vector<Vector3d> queries(100);
+    Rand(queries, Vector3d(-1.0, -1.0, -1.0), Vector3d(11.0, 11.0, 11.0), 1);
+
+    geometry::KDTreeFlannFloat kdtree(pc);
+    ExpectMatchesDoubleTree(kdtree, pc, queries);
+
+    // The same points indexed in place.
+    vector<float> points_float;
+    for (const Vector3d &point : pc.points_) {
+        points_float.insert(points_float.end(), {float(point(0)),
+                                                 float(point(1)),
+                                                 float(point(2))});
+    }
+    geometry::KDTreeFlannFloat kdtree_external(Map<const MatrixXf>(
+            points_float.data(), 3, pc.points_.size()));
+    ExpectMatchesDoubleTree(kdtree_external, pc, queries);
+
+    MatrixXd query_matrix(3, queries.size());
+    for (size_t i = 0; i < queries.size(); i++) {
+        query_matrix.col(i) = queries[i];
+    }
+    geometry::KDTreeSearchResult result;
+    EXPECT_TRUE(kdtree_external.SearchRadiusBatch(query_matrix, 1.5, result));
+    for (size_t i = 0; i < queries.size(); i++) {
+        vector<int> indices;
+        vector<double> distance2;
+        int k = kdtree.SearchRadius(queries[i], 1.5, indices, distance2);
+        ASSERT_EQ(result.NumNeighbors(i), k);
+        ExpectEQ(indices,
+                 vector<int>(result.Indices(i), result.Indices(i) + k));
+    }
+
+    // Queries of the wrong dimension are rejected.
+    vector<int> indices;
+    vector<double> distance2;
+    EXPECT_EQ(kdtree.SearchKNN(VectorXd(VectorXd::Zero(2)), 3, indices,
+                               distance2),
+              -1);
+    geometry::KDTreeFlannFloat empty;
+    EXPECT_EQ(empty.SearchKNN(Vector3d(0, 0, 0), 3, indices, distance2), -1);
+}
@@ -0,0 +1,175 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/KDTreeFlannDynamic.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+// Checks every search type of \p kdtree against an exhaustive search over the
+// ids below \p num_ids that have not been removed.
+static void ExpectMatchesBruteForce(const geometry::KDTreeFlannDynamic &kdtree,
+                                    int num_ids,
+                                    const vector<Vector3d> &queries) {
+    const int knn = 15;
+    const double radius = 1.2;
+    const double radius2 = float(radius * radius);
+    for (const Vector3d &query : queries) {
+        vector<pair<double, int>> all;
+        for (int id = 0; id < num_ids; id++) {
+            if (kdtree.HasPoint(id)) {
+                all.emplace_back((kdtree.GetPoint(id) - query).squaredNorm(),
+                                 id);
+            }
+        }
+        sort(all.begin(), all.end());
+        int num_within = int(count_if(
+                all.begin(), all.end(),
+                [&](const pair<double, int> &n) { return n.first < radius2; }));
+
+        vector<int> indices;
+        vector<double> distance2;
+        auto expect_prefix = [&](int k) {
+            ASSERT_EQ(int(indices.size()), k);
+            for (int i = 0; i < k; i++) {
+                EXPECT_NEAR(distance2[i], all[i].first, 1e-12);
+                EXPECT_TRUE(kdtree.HasPoint(indices[i]));
+                EXPECT_NEAR(distance2[i],
+                            (kdtree.GetPoint(indices[i]) - query).squaredNorm(),
+                            1e-12);
+            }
+        };
+        EXPECT_EQ(kdtree.SearchKNN(query, knn, indices, distance2),
+                  min(knn, int(all.size())));
+        expect_prefix(min(knn, int(all.size())));
+        EXPECT_EQ(kdtree.SearchRadius(query, radius, indices, distance2),
+                  num_within);
+        expect_prefix(num_within);
+        EXPECT_EQ(kdtree.SearchHybrid(query, radius, knn, indices, distance2),
+                  min(knn, num_within));
+        expect_prefix(min(knn, num_within));
+    }
+}
+
+TEST(KDTreeFlannDynamic, AddAndRemove) {
+    vector<Vector3d> queries(50);
+    Rand(queries, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+
+    geometry::KDTreeFlannDynamic kdtree;
+    vector<int> indices;
+    vector<double> distance2;
+    EXPECT_EQ(kdtree.SearchKNN(queries[0], 3, indices, distance2), -1);
+
+    // Batches of varying sizes go through the buffer and several tree levels.
+    int seed = 1;
+    size_t num_added = 0;
+    for (size_t size : {10, 300, 1, 2000, 77, 255, 4096, 3}) {
+        vector<Vector3d> points(size);
+        Rand(points, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0),
+             seed++);
+        EXPECT_EQ(kdtree.AddPoints(points), int(num_added));
+        num_added += size;
+        EXPECT_EQ(kdtree.NumPoints(), num_added);
+        EXPECT_EQ(kdtree.GetPoint(int(num_added) - 1), points.back());
+    }
+    ExpectMatchesBruteForce(kdtree, int(num_added), queries);
+
+    // Remove a random half of the points, which also compacts trees.
+    vector<int> ids(num_added / 2);
+    Rand(ids, 0, int(num_added) - 1, seed++);
+    kdtree.RemovePoints(ids);
+    for (int id : ids) {
+        EXPECT_FALSE(kdtree.HasPoint(id));
+    }
+    ExpectMatchesBruteForce(kdtree, int(num_added), queries);
+
+    // Removing again is a no-op.
+    size_t num_points = kdtree.NumPoints();
+    kdtree.RemovePoints(ids);
+    kdtree.RemovePoints({-1, int(num_added) + 10});
+    EXPECT_EQ(kdtree.NumPoints(), num_points);
+
+    geometry::AxisAlignedBoundingBox box(Vector3d(2.0, 2.0, 2.0),
+                                         Vector3d(6.0, 7.0, 8.0));
+    size_t num_removed = kdtree.RemoveBox(box);
+    EXPECT_GT(num_removed, 0u);
+    EXPECT_EQ(kdtree.NumPoints(), num_points - num_removed);
+    for (int id = 0; id < int(num_added); id++) {
+        if (kdtree.HasPoint(id)) {
+            const Vector3d &point = kdtree.GetPoint(id);
+            EXPECT_FALSE((point.array() >= box.min_bound_.array()).all() &&
+                         (point.array() <= box.max_bound_.array()).all());
+        }
+    }
+    EXPECT_EQ(kdtree.RemoveBox(box), 0u);
+    ExpectMatchesBruteForce(kdtree, int(num_added), queries);
+
+    // New points still get fresh ids after removals.
+    vector<Vector3d> points(500);
+    Rand(points, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), seed++);
+    EXPECT_EQ(kdtree.AddPoints(points), int(num_added));
+    ExpectMatchesBruteForce(kdtree, int(num_added + points.size()), queries);
+
+    kdtree.Clear();
+    EXPECT_EQ(kdtree.NumPoints(), 0u);
+    EXPECT_EQ(kdtree.SearchKNN(queries[0], 3, indices, distance2), -1);
+}
+
+TEST(KDTreeFlannDynamic, SearchBatch) {
+    vector<Vector3d> points(3000);
+    Rand(points, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlannDynamic kdtree(points);
+    kdtree.AddPoints(vector<Vector3d>(points.begin(), points.begin() + 100));
+
+    MatrixXd queries = MatrixXd::Random(3, 200) * 5.0;
+    queries.array() += 5.0;
+    geometry::KDTreeSearchParamHybrid param(1.0, 20);
+    geometry::KDTreeSearchResult result;
+    EXPECT_TRUE(kdtree.SearchBatch(queries, param, result));
+    ASSERT_EQ(result.NumQueries(), queries.cols());
+    for (int64_t i = 0; i < queries.cols(); i++) {
+        vector<int> indices;
+        vector<double> distance2;
+        int k = kdtree.Search(Vector3d(queries.col(i)), param, indices,
+                              distance2);
+        ASSERT_EQ(result.NumNeighbors(i), k);
+        ExpectEQ(indices,
+                 vector<int>(result.Indices(i), result.Indices(i) + k));
+    }
+
+    EXPECT_FALSE(kdtree.SearchBatch(
+            queries, geometry::KDTreeSearchParamKNN(-1), result));
+    EXPECT_EQ(result.NumQueries(), queries.cols());
+    EXPECT_TRUE(result.indices_.empty());
+}
@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <tuple>
+
+#include "Open3D/Geometry/LinearOctree.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+/// Points on the surface of a unit sphere and inside a small cube, colored
+/// by position.
+geometry::PointCloud CreateCloud() {
+    std::mt19937 rng(0);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, 0.2);
+    geometry::PointCloud pc;
+    for (int i = 0; i < 20000; i++) {
+        Vector3d p(normal(rng), normal(rng), normal(rng));
+        pc.points_.push_back(p.normalized());
+    }
+    for (int i = 0; i < 5000; i++) {
+        pc.points_.emplace_back(uniform(rng), uniform(rng), uniform(rng));
+    }
+    // Duplicates end in leaves.
+    pc.points_.insert(pc.points_.end(), 100, Vector3d(0.1, 0.1, 0.1));
+    for (const Vector3d &p : pc.points_) {
+        pc.colors_.push_back((p + Vector3d::Ones()) / 2.0);
+    }
+    return pc;
+}
+
+/// Parent of each node, or -1 for the root.
+std::vector<int64_t> GetParents(const geometry::LinearOctree &octree) {
+    const auto &nodes = octree.GetNodes();
+    std::vector<int64_t> parents(nodes.size(), -1);
+    for (size_t n = 0; n < nodes.size(); n++) {
+        for (int c = 0; c < nodes[n].num_children_; c++) {
+            parents[nodes[n].first_child_ + c] = int64_t(n);
+        }
+    }
+    return parents;
+}
+
+}  // unnamed namespace
+
+TEST(LinearOctree, CreateFromPointCloud) {
+    geometry::PointCloud pc = CreateCloud();
+    const int sample_depth = 3;
+    auto octree = geometry::LinearOctree::CreateFromPointCloud(pc, 8, 64,
+                                                               sample_depth);
+    const auto &nodes = octree->GetNodes();
+    const auto &points = octree->GetPoints();
+    ASSERT_EQ(points.size(), pc.points_.size());
+
+    // Every point is owned once.
+    std::vector<int> counts(pc.points_.size(), 0);
+    for (size_t i = 0; i < points.size(); i++) {
+        int64_t index = octree->GetPointIndices()[i];
+        counts[index]++;
+        ExpectEQ(points[i], pc.points_[index], 0.0);
+    }
+    EXPECT_EQ(*std::min_element(counts.begin(), counts.end()), 1);
+    EXPECT_EQ(*std::max_element(counts.begin(), counts.end()), 1);
+
+    std::vector<int64_t> parents = GetParents(*octree);
+    int64_t point_end = 0;
+    for (size_t n = 0; n < nodes.size(); n++) {
+        const geometry::LinearOctree::Node &node = nodes[n];
+        EXPECT_EQ(node.point_begin_, point_end);
+        point_end = node.point_end_;
+        if (n > 0) {
+            ASSERT_GE(parents[n], 0);
+            EXPECT_EQ(node.depth_, nodes[parents[n]].depth_ + 1);
+            EXPECT_EQ(node.code_ >> 3, nodes[parents[n]].code_);
+            EXPECT_GE(node.depth_, nodes[n - 1].depth_);
+        }
+        EXPECT_LE(node.depth_, 8);
+
+        // Owned points are inside the cell, and internal nodes own at most
+        // one point per cell sample_depth levels deeper.
+        auto bounds = octree->GetNodeBounds(n);
+        const double cell_size = bounds.second / (1 << sample_depth);
+        std::set<std::tuple<int, int, int>> cells;
+        for (int64_t i = node.point_begin_; i < node.point_end_; i++) {
+            Vector3d offset = (points[i] - bounds.first) / bounds.second;
+            EXPECT_GE(offset.minCoeff(), -1e-9);
+            EXPECT_LE(offset.maxCoeff(), 1.0 + 1e-9);
+            Vector3i cell = ((points[i] - bounds.first) / cell_size)
+                                    .array()
+                                    .floor()
+                                    .cast<int>();
+            if (node.num_children_ > 0) {
+                EXPECT_TRUE(cells.emplace(cell(0), cell(1), cell(2)).second);
+            }
+        }
+    }
+    EXPECT_EQ(point_end, int64_t(points.size()));
+
+    // The points up to a depth are a prefix that grows with the depth.
+    size_t prev_size = 0;
+    for (int depth = 0; depth <= 8; depth++) {
+        auto sample = octree->ExtractPointsUpToDepth(depth);
+        size_t expected = 0;
+        for (const auto &node : nodes) {
+            expected += node.depth_ <= depth
+                                ? size_t(node.point_end_ - node.point_begin_)
+                                : 0;
+        }
+        EXPECT_EQ(sample->points_.size(), expected);
+        EXPECT_EQ(sample->colors_.size(), expected);
+        EXPECT_GE(sample->points_.size(), prev_size);
+        prev_size = sample->points_.size();
+    }
+    EXPECT_EQ(prev_size, pc.points_.size());
+    EXPECT_LT(octree->ExtractPointsUpToDepth(2)->points_.size(),
+              pc.points_.size() / 4);
+
+    EXPECT_TRUE(geometry::LinearOctree::CreateFromPointCloud(
+                        geometry::PointCloud())
+                        ->IsEmpty());
+}
+
+TEST(LinearOctree, SelectNodes) {
+    geometry::PointCloud pc = CreateCloud();
+    auto octree = geometry::LinearOctree::CreateFromPointCloud(pc, 8, 64, 3);
+    const auto &nodes = octree->GetNodes();
+    std::vector<int64_t> parents = GetParents(*octree);
+
+    // Orthographic view of x in [-1, 0], y and z in [-1.5, 1.5].
+    Matrix4d view_projection = Matrix4d::Identity();
+    view_projection(0, 0) = 2.0;
+    view_projection(0, 3) = 1.0;
+    view_projection(1, 1) = 1.0 / 1.5;
+    view_projection(2, 2) = 1.0 / 1.5;
+    const Vector3d camera(-5.0, 0.0, 0.0);
+
+    size_t prev_points = 0;
+    for (size_t max_points : {100, 2000, 100000}) {
+        std::vector<size_t> selected =
+                octree->SelectNodes(camera, view_projection, 0.0, max_points);
+        std::set<size_t> visited;
+        size_t num_points = 0;
+        for (size_t n : selected) {
+            if (n > 0) {
+                EXPECT_TRUE(visited.count(size_t(parents[n])));
+            }
+            visited.insert(n);
+            num_points += size_t(nodes[n].point_end_ - nodes[n].point_begin_);
+            auto bounds = octree->GetNodeBounds(n);
+            EXPECT_LE(bounds.first(0), 0.0);
+        }
+        EXPECT_LE(num_points, max_points);
+        EXPECT_GE(num_points, prev_points);
+        EXPECT_EQ(octree->ExtractPoints(selected)->points_.size(), num_points);
+        prev_points = num_points;
+    }
+
+    // A coarser spacing refines fewer nodes.
+    EXPECT_LT(octree->SelectNodes(camera, view_projection, 0.05, 100000)
+                      .size(),
+              octree->SelectNodes(camera, view_projection, 0.005, 100000)
+                      .size());
+}
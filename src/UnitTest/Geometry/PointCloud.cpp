@@ -24,13 +24,19 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Eigenvalues>
 #include <algorithm>
+#include <map>
+#include <random>
+#include <tuple>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Utility/Parallel.h"
 #include "TestUtility/UnitTest.h"
 
 using namespace Eigen;
@@ -527,6 +533,148 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ref_colors, output_pc->colors_);
 }
 
+TEST(PointCloud, VoxelDownSampleMatchesReference) {
+    geometry::PointCloud pc;
+    pc.points_.resize(20000);
+    pc.normals_.resize(20000);
+    pc.colors_.resize(20000);
+    Rand(pc.points_, Vector3d(-10.0, -10.0, -10.0), Vector3d(10.0, 10.0, 10.0),
+         0);
+    Rand(pc.normals_, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pc.colors_, Zero3d, Vector3d(1.0, 1.0, 1.0), 2);
+    pc.normals_[5] = Vector3d(NAN, 0.0, 0.0);
+
+    // Sequential accumulation in point order, with the voxels ordered by
+    // their integer coordinates.
+    const double voxel_size = 1.3;
+    Vector3d voxel_min_bound =
+            pc.GetMinBound() - Vector3d::Constant(voxel_size * 0.5);
+    map<tuple<int, int, int>, vector<int>> voxels;
+    for (int i = 0; i < int(pc.points_.size()); i++) {
+        Vector3d ref_coord = (pc.points_[i] - voxel_min_bound) / voxel_size;
+        voxels[make_tuple(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                          int(floor(ref_coord(2))))]
+                .push_back(i);
+    }
+    vector<Vector3d> ref_points;
+    vector<Vector3d> ref_normals;
+    vector<Vector3d> ref_colors;
+    for (const auto &voxel : voxels) {
+        Vector3d point = Zero3d;
+        Vector3d normal = Zero3d;
+        Vector3d color = Zero3d;
+        for (int i : voxel.second) {
+            point += pc.points_[i];
+            if (!pc.normals_[i].hasNaN()) {
+                normal += pc.normals_[i];
+            }
+            color += pc.colors_[i];
+        }
+        ref_points.push_back(point / double(voxel.second.size()));
+        ref_normals.push_back(normal.normalized());
+        ref_colors.push_back(color / double(voxel.second.size()));
+    }
+
+    auto output_pc = pc.VoxelDownSample(voxel_size);
+    ExpectEQ(ref_points, output_pc->points_, 0.0);
+    ExpectEQ(ref_normals, output_pc->normals_, 0.0);
+    ExpectEQ(ref_colors, output_pc->colors_, 0.0);
+
+    Vector3d trace_min_bound(-5.0, -5.0, -5.0);
+    auto trace = pc.VoxelDownSampleAndTrace(voxel_size, trace_min_bound,
+                                            Vector3d(5.0, 5.0, 5.0));
+    const auto &trace_pc = get<0>(trace);
+    const MatrixXi &cubic_id = get<1>(trace);
+    const auto &original_indices = get<2>(trace);
+    ASSERT_EQ(cubic_id.rows(), int(trace_pc->points_.size()));
+    ASSERT_EQ(original_indices.size(), trace_pc->points_.size());
+    vector<int> traced;
+    for (size_t v = 0; v < original_indices.size(); v++) {
+        Vector3d point = Zero3d;
+        for (int i : original_indices[v]) {
+            point += pc.points_[i];
+            traced.push_back(i);
+        }
+        ExpectEQ(trace_pc->points_[v],
+                 Vector3d(point / double(original_indices[v].size())), 0.0);
+        for (int cid = 0; cid < 8; cid++) {
+            if (cubic_id(v, cid) >= 0) {
+                EXPECT_NE(find(original_indices[v].begin(),
+                               original_indices[v].end(), cubic_id(v, cid)),
+                          original_indices[v].end());
+            }
+        }
+    }
+    sort(traced.begin(), traced.end());
+    ASSERT_EQ(traced.size(), pc.points_.size());
+    for (int i = 0; i < int(traced.size()); i++) {
+        EXPECT_EQ(traced[i], i);
+    }
+}
+
+TEST(PointCloud, VoxelDownSampleAggregation) {
+    geometry::PointCloud pc;
+    pc.points_.resize(5000);
+    pc.normals_.resize(5000);
+    pc.colors_.resize(5000);
+    Rand(pc.points_, Zero3d, Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pc.normals_, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pc.colors_, Zero3d, Vector3d(1.0, 1.0, 1.0), 2);
+
+    const double voxel_size = 2.0;
+    Vector3d voxel_min_bound =
+            pc.GetMinBound() - Vector3d::Constant(voxel_size * 0.5);
+    auto voxel_of = [&](const Vector3d &point) {
+        Vector3d ref_coord = (point - voxel_min_bound) / voxel_size;
+        return make_tuple(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                          int(floor(ref_coord(2))));
+    };
+    map<tuple<int, int, int>, vector<int>> voxels;
+    for (int i = 0; i < int(pc.points_.size()); i++) {
+        voxels[voxel_of(pc.points_[i])].push_back(i);
+    }
+
+    auto centroid = pc.VoxelDownSample(voxel_size);
+    using Aggregation = geometry::PointCloud::VoxelAggregation;
+    for (Aggregation aggregation :
+         {Aggregation::NearestToCenter, Aggregation::Random}) {
+        auto output_pc = pc.VoxelDownSample(voxel_size, aggregation);
+        ASSERT_EQ(output_pc->points_.size(), voxels.size());
+        ASSERT_EQ(output_pc->normals_.size(), voxels.size());
+        ASSERT_EQ(output_pc->colors_.size(), voxels.size());
+        size_t v = 0;
+        for (const auto &voxel : voxels) {
+            // The kept point is an input point of the voxel, with its own
+            // normal and color.
+            int selected = -1;
+            for (int i : voxel.second) {
+                if (pc.points_[i] == output_pc->points_[v]) {
+                    selected = i;
+                }
+            }
+            ASSERT_GE(selected, 0);
+            ExpectEQ(output_pc->normals_[v], pc.normals_[selected], 0.0);
+            ExpectEQ(output_pc->colors_[v], pc.colors_[selected], 0.0);
+            EXPECT_TRUE(voxel_of(centroid->points_[v]) == voxel.first);
+            if (aggregation == Aggregation::NearestToCenter) {
+                Vector3d center = voxel_min_bound +
+                                  voxel_size * Vector3d(get<0>(voxel.first),
+                                                        get<1>(voxel.first),
+                                                        get<2>(voxel.first)) +
+                                  Vector3d::Constant(voxel_size * 0.5);
+                for (int i : voxel.second) {
+                    EXPECT_LE((output_pc->points_[v] - center).squaredNorm(),
+                              (pc.points_[i] - center).squaredNorm() + 1e-12);
+                }
+            }
+            v++;
+        }
+        // The choice does not depend on the thread schedule.
+        ExpectEQ(output_pc->points_,
+                 pc.VoxelDownSample(voxel_size, aggregation)->points_);
+    }
+}
+
 TEST(PointCloud, UniformDownSample) {
     vector<Vector3d> ref = {{839.215686, 392.156863, 780.392157},
                             {364.705882, 509.803922, 949.019608},
@@ -639,6 +787,113 @@ TEST(PointCloud, EstimateNormals) {
     ExpectEQ(ref, pc.normals_);
 }
 
+TEST(PointCloud, EstimateNormalsBlocked) {
+    // Rand() draws from a coarse lattice, where small neighborhoods are often
+    // collinear and their normals ill-defined.
+    geometry::PointCloud pc;
+    pc.points_.resize(2000);
+    pc.normals_.resize(2000);
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        pc.points_[i] = Vector3d(uniform(generator), uniform(generator),
+                                 uniform(generator));
+        pc.normals_[i] = Vector3d(uniform(generator) - 0.5,
+                                  uniform(generator) - 0.5,
+                                  uniform(generator) - 0.5);
+    }
+
+    // Per-point reference, as computed before the blocked rewrite. The hybrid
+    // search gives the points of a block different neighbor counts, some of
+    // them below 3.
+    const geometry::KDTreeSearchParamHybrid param(0.08, 30);
+    geometry::KDTreeFlann kdtree(pc);
+    vector<Vector3d> ref(pc.points_.size());
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        vector<int> indices;
+        vector<double> distance2;
+        if (kdtree.Search(pc.points_[i], param, indices, distance2) < 3) {
+            ref[i] = Vector3d(0.0, 0.0, 1.0);
+            continue;
+        }
+        Matrix<double, 9, 1> cumulants = Matrix<double, 9, 1>::Zero();
+        for (int index : indices) {
+            const Vector3d &p = pc.points_[index];
+            cumulants.head<3>() += p;
+            cumulants(3) += p(0) * p(0);
+            cumulants(4) += p(0) * p(1);
+            cumulants(5) += p(0) * p(2);
+            cumulants(6) += p(1) * p(1);
+            cumulants(7) += p(1) * p(2);
+            cumulants(8) += p(2) * p(2);
+        }
+        cumulants /= double(indices.size());
+        Matrix3d covariance;
+        covariance << cumulants(3) - cumulants(0) * cumulants(0),
+                cumulants(4) - cumulants(0) * cumulants(1),
+                cumulants(5) - cumulants(0) * cumulants(2),
+                cumulants(4) - cumulants(0) * cumulants(1),
+                cumulants(6) - cumulants(1) * cumulants(1),
+                cumulants(7) - cumulants(1) * cumulants(2),
+                cumulants(5) - cumulants(0) * cumulants(2),
+                cumulants(7) - cumulants(1) * cumulants(2),
+                cumulants(8) - cumulants(2) * cumulants(2);
+        SelfAdjointEigenSolver<Matrix3d> solver(covariance);
+        ref[i] = solver.eigenvectors().col(0);
+        if (ref[i].dot(pc.normals_[i]) < 0.0) {
+            ref[i] *= -1.0;
+        }
+    }
+
+    pc.EstimateNormals(param, false);
+    ExpectEQ(ref, pc.normals_, 1e-8);
+}
+
+TEST(PointCloud, EstimateNormalsOrganized) {
+    // Two parallel planes z - 0.5 x = 1 and z - 0.5 x = 1.5, seen through the
+    // left and the right half of the image, with a hole of invalid depth.
+    const int width = 64;
+    const int height = 48;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 50.0, 50.0, 31.5,
+                                             23.5);
+    geometry::Image depth;
+    depth.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            double offset = u < width / 2 ? 1.0 : 1.5;
+            double z = offset / (1.0 - 0.5 * (u - 31.5) / 50.0);
+            if (u >= 10 && u < 14 && v >= 10 && v < 14) {
+                z = 0.0;
+            }
+            *depth.PointerAt<float>(u, v) = float(z);
+        }
+    }
+    auto pc = geometry::PointCloud::CreateFromDepthImage(
+            depth, intrinsic, Matrix4d::Identity(), 1.0, 1000.0, 1, false);
+    ASSERT_EQ(int(pc->points_.size()), width * height);
+
+    EXPECT_FALSE(pc->EstimateNormalsOrganized(width + 1, height));
+    const Vector3d normal = Vector3d(-0.5, 0.0, 1.0).normalized();
+    ASSERT_TRUE(pc->EstimateNormalsOrganized(width, height, 2, 0.1));
+    for (size_t i = 0; i < pc->points_.size(); i++) {
+        if (std::isnan(pc->points_[i](2))) {
+            ExpectEQ(Vector3d(0.0, 0.0, 1.0), pc->normals_[i]);
+        } else {
+            EXPECT_NEAR(std::abs(pc->normals_[i].dot(normal)), 1.0, 1e-3);
+        }
+    }
+
+    // Without the distance check, windows straddling the step blend the two
+    // planes.
+    pc->normals_.clear();
+    ASSERT_TRUE(pc->EstimateNormalsOrganized(width, height, 2));
+    double min_dot = 1.0;
+    for (size_t i = 0; i < pc->points_.size(); i++) {
+        min_dot = std::min(min_dot, std::abs(pc->normals_[i].dot(normal)));
+    }
+    EXPECT_LT(min_dot, 0.9);
+}
+
 TEST(PointCloud, OrientNormalsToAlignWithDirection) {
     vector<Vector3d> ref = {
             {0.282003, 0.866394, 0.412111},   {0.550791, 0.829572, -0.091869},
@@ -1057,6 +1312,70 @@ TEST(PointCloud, CreatePointCloudFromRGBDImage_1_4) {
                                        ref_colors);
 }
 
+TEST(PointCloud, ClusterDBSCAN) {
+    // Three blobs of different densities over uniform noise.
+    geometry::PointCloud pc;
+    pc.points_.resize(600);
+    Rand(pc.points_, Zero3d, Vector3d(10.0, 10.0, 10.0), 0);
+    const Vector3d blob_min[3] = {{1.0, 1.0, 1.0}, {6.0, 6.0, 6.0},
+                                  {1.0, 7.0, 2.0}};
+    const int blob_size[3] = {800, 1200, 400};
+    for (int b = 0; b < 3; b++) {
+        vector<Vector3d> blob(blob_size[b]);
+        Rand(blob, blob_min[b], blob_min[b] + Vector3d(2.0, 2.0, 2.0), b + 1);
+        pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+    }
+
+    // Serial expansion over exhaustive neighborhoods.
+    const double eps = 0.35;
+    const size_t min_points = 6;
+    const int num_points = int(pc.points_.size());
+    const double eps2 = float(eps * eps);
+    vector<vector<int>> nbs(num_points);
+    for (int i = 0; i < num_points; i++) {
+        for (int j = 0; j < num_points; j++) {
+            if ((pc.points_[i] - pc.points_[j]).squaredNorm() < eps2) {
+                nbs[i].push_back(j);
+            }
+        }
+    }
+    vector<int> ref_labels(num_points, -2);
+    int num_clusters = 0;
+    for (int i = 0; i < num_points; i++) {
+        if (ref_labels[i] != -2) {
+            continue;
+        }
+        if (nbs[i].size() < min_points) {
+            ref_labels[i] = -1;
+            continue;
+        }
+        vector<int> queue = {i};
+        ref_labels[i] = num_clusters;
+        while (!queue.empty()) {
+            int p = queue.back();
+            queue.pop_back();
+            for (int nb : nbs[p]) {
+                if (ref_labels[nb] == -1) {
+                    ref_labels[nb] = num_clusters;
+                } else if (ref_labels[nb] == -2) {
+                    ref_labels[nb] = num_clusters;
+                    if (nbs[nb].size() >= min_points) {
+                        queue.push_back(nb);
+                    }
+                }
+            }
+        }
+        num_clusters++;
+    }
+    EXPECT_GE(num_clusters, 3);
+
+    ExpectEQ(ref_labels, pc.ClusterDBSCAN(eps, min_points));
+    ExpectEQ(ref_labels,
+             pc.ClusterDBSCAN(eps, min_points, false,
+                              geometry::NeighborSearchBackend::HashGrid));
+    EXPECT_TRUE(geometry::PointCloud().ClusterDBSCAN(eps, min_points).empty());
+}
+
 TEST(PointCloud, SegmentPlane) {
     // Points sampled from the plane x + y + z + 1 = 0
     vector<Vector3d> ref = {{1.0, 1.0, -3.0},
@@ -1078,3 +1397,90 @@ TEST(PointCloud, SegmentPlane) {
 
     ExpectEQ(ref, output_pc->points_);
 }
+
+// Samples \p num_points points of the plane normal . x + d = 0 in the box
+// [-1, 1]^3 + offset, displaced along the normal by at most \p noise.
+static vector<Vector3d> SamplePlane(const Vector3d &normal,
+                                    const Vector3d &offset,
+                                    int num_points,
+                                    double noise,
+                                    int seed) {
+    vector<Vector3d> points(num_points);
+    Rand(points, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), seed);
+    vector<double> displacements(num_points);
+    Rand(displacements, -noise, noise, seed + 1);
+    for (int i = 0; i < num_points; i++) {
+        Vector3d p = points[i];
+        points[i] = p - normal * normal.dot(p) + normal * displacements[i] +
+                    offset;
+    }
+    return points;
+}
+
+TEST(PointCloud, SegmentPlaneSeed) {
+    geometry::PointCloud pc;
+    pc.points_ = SamplePlane(Vector3d(0.0, 0.0, 1.0), Zero3d, 6000, 0.005, 0);
+    vector<Vector3d> outliers(4000);
+    Rand(outliers, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), 2);
+    pc.points_.insert(pc.points_.end(), outliers.begin(), outliers.end());
+
+    Vector4d plane_model;
+    vector<size_t> inliers;
+    tie(plane_model, inliers) = pc.SegmentPlane(0.01, 3, 1000, 0.999999, 7);
+    EXPECT_NEAR(std::abs(plane_model(2)), 1.0, 1e-3);
+    EXPECT_NEAR(plane_model(3), 0.0, 1e-3);
+    EXPECT_GE(inliers.size(), 6000u);
+    EXPECT_LT(inliers.size(), 6100u);
+
+    // The result only depends on the seed.
+    utility::SetMaxThreads(1);
+    Vector4d plane_model_single;
+    vector<size_t> inliers_single;
+    tie(plane_model_single, inliers_single) =
+            pc.SegmentPlane(0.01, 3, 1000, 0.999999, 7);
+    utility::SetMaxThreads(0);
+    ExpectEQ(plane_model, plane_model_single, 0.0);
+    EXPECT_EQ(inliers, inliers_single);
+
+    EXPECT_ANY_THROW(pc.SegmentPlane(0.01, 2, 100));
+    EXPECT_ANY_THROW(pc.SegmentPlane(0.01, 3, 100, 0.0));
+}
+
+TEST(PointCloud, SegmentPlanes) {
+    const Vector3d normals[3] = {Vector3d(1.0, 0.0, 0.0),
+                                 Vector3d(0.0, 1.0, 1.0).normalized(),
+                                 Vector3d(1.0, 1.0, 1.0).normalized()};
+    const Vector3d offsets[3] = {Vector3d(0.0, 0.0, 0.0),
+                                 Vector3d(5.0, 0.0, 0.0),
+                                 Vector3d(0.0, 5.0, 0.0)};
+    const int sizes[3] = {3000, 2000, 1000};
+    geometry::PointCloud pc;
+    for (int k = 0; k < 3; k++) {
+        auto plane = SamplePlane(normals[k], offsets[k], sizes[k], 0.002,
+                                 2 * k);
+        pc.points_.insert(pc.points_.end(), plane.begin(), plane.end());
+    }
+    vector<Vector3d> outliers(300);
+    Rand(outliers, Vector3d(-1.0, -1.0, -1.0), Vector3d(6.0, 6.0, 1.0), 9);
+    pc.points_.insert(pc.points_.end(), outliers.begin(), outliers.end());
+
+    auto planes = pc.SegmentPlanes(0.01, 3, 1000, 5, 100, 0.999999, 3);
+    ASSERT_EQ(planes.size(), 3u);
+    vector<char> taken(pc.points_.size(), 0);
+    for (int k = 0; k < 3; k++) {
+        // The largest remaining plane comes first.
+        const Vector4d &plane_model = get<0>(planes[k]);
+        EXPECT_NEAR(std::abs(plane_model.head<3>().dot(normals[k])), 1.0,
+                    1e-3);
+        EXPECT_NEAR(std::abs(plane_model.head<3>().dot(offsets[k]) +
+                             plane_model(3)),
+                    0.0, 1e-2);
+        const vector<size_t> &inliers = get<1>(planes[k]);
+        // Points near a plane intersection go to the plane found first.
+        EXPECT_GE(int(inliers.size()), sizes[k] * 95 / 100);
+        for (size_t idx : inliers) {
+            EXPECT_FALSE(taken[idx]);
+            taken[idx] = 1;
+        }
+    }
+}
@@ -0,0 +1,214 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TiledPointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+const char *const kInputDirectory = "TiledPointCloud_input";
+const char *const kOutputDirectory = "TiledPointCloud_output";
+
+/// Uniform points in [0, 3]^3 with normals and colors.
+geometry::PointCloud CreateCloud(int num_points) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 3.0);
+    geometry::PointCloud pc;
+    for (int i = 0; i < num_points; i++) {
+        pc.points_.emplace_back(uniform(rng), uniform(rng), uniform(rng));
+        Vector3d normal(uniform(rng) - 1.5, uniform(rng) - 1.5, 1.0);
+        pc.normals_.push_back(normal.normalized());
+        pc.colors_.push_back(pc.points_.back() / 3.0);
+    }
+    return pc;
+}
+
+/// Writes \p pc in three chunks through a budget of a few hundred points.
+std::shared_ptr<geometry::TiledPointCloud> WriteTiles(
+        const geometry::PointCloud &pc, double tile_size) {
+    geometry::TiledPointCloudWriter writer(kInputDirectory, tile_size,
+                                           pc.HasNormals(), pc.HasColors(),
+                                           20000);
+    const size_t chunk = pc.points_.size() / 3 + 1;
+    for (size_t begin = 0; begin < pc.points_.size(); begin += chunk) {
+        std::vector<size_t> indices(
+                std::min(chunk, pc.points_.size() - begin));
+        std::iota(indices.begin(), indices.end(), begin);
+        writer.AddPoints(*pc.SelectByIndex(indices));
+    }
+    return writer.Close();
+}
+
+/// Sorts the points of \p pc, with their normals and colors, so that clouds
+/// of the same points in any order compare equal.
+geometry::PointCloud SortPoints(const geometry::PointCloud &pc) {
+    std::vector<size_t> order(pc.points_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return std::lexicographical_compare(
+                pc.points_[a].data(), pc.points_[a].data() + 3,
+                pc.points_[b].data(), pc.points_[b].data() + 3);
+    });
+    geometry::PointCloud sorted;
+    for (size_t i : order) {
+        sorted.points_.push_back(pc.points_[i]);
+        if (pc.HasNormals()) {
+            sorted.normals_.push_back(pc.normals_[i]);
+        }
+        if (pc.HasColors()) {
+            sorted.colors_.push_back(pc.colors_[i]);
+        }
+    }
+    return sorted;
+}
+
+void ExpectSamePoints(const geometry::PointCloud &expected,
+                      const geometry::PointCloud &actual,
+                      double threshold) {
+    geometry::PointCloud a = SortPoints(expected);
+    geometry::PointCloud b = SortPoints(actual);
+    ExpectEQ(a.points_, b.points_, threshold);
+    ExpectEQ(a.normals_, b.normals_, threshold);
+    ExpectEQ(a.colors_, b.colors_, threshold);
+}
+
+}  // unnamed namespace
+
+TEST(TiledPointCloud, WriteAndRead) {
+    geometry::PointCloud pc = CreateCloud(3000);
+    auto tiled = WriteTiles(pc, 1.0);
+    EXPECT_EQ(tiled->GetNumPoints(), 3000);
+    EXPECT_EQ(tiled->GetTiles().size(), 27u);
+    EXPECT_TRUE(tiled->HasNormals());
+    EXPECT_TRUE(tiled->HasColors());
+    ExpectEQ(tiled->GetMinBound(), pc.GetMinBound());
+    ExpectEQ(tiled->GetMaxBound(), pc.GetMaxBound());
+    ExpectSamePoints(pc, *tiled->ReadPointCloud(), 0.0);
+
+    // Reopening reads the same index.
+    geometry::TiledPointCloud reopened(kInputDirectory);
+    ASSERT_EQ(reopened.GetTiles().size(), tiled->GetTiles().size());
+    EXPECT_EQ(reopened.GetTileSize(), 1.0);
+
+    for (size_t t = 0; t < tiled->GetTiles().size(); t++) {
+        const geometry::TiledPointCloud::Tile &tile = tiled->GetTiles()[t];
+        const Vector3d min_bound = tile.index_.cast<double>();
+        const Vector3d max_bound = min_bound + Vector3d::Ones();
+        auto cloud = tiled->ReadTileWithHalo(t, 0.25);
+        ASSERT_GE(cloud->points_.size(), size_t(tile.num_points_));
+        for (size_t i = 0; i < cloud->points_.size(); i++) {
+            const Vector3d &p = cloud->points_[i];
+            bool in_tile = (p.array() >= min_bound.array()).all() &&
+                           (p.array() < max_bound.array()).all();
+            EXPECT_EQ(in_tile, i < size_t(tile.num_points_));
+            EXPECT_TRUE((p.array() >= min_bound.array() - 0.25).all());
+            EXPECT_TRUE((p.array() <= max_bound.array() + 0.25).all());
+        }
+        // Every point within the halo of the tile is read.
+        size_t num_expected = 0;
+        for (const Vector3d &p : pc.points_) {
+            num_expected += (p.array() >= min_bound.array() - 0.25).all() &&
+                            (p.array() <= max_bound.array() + 0.25).all();
+        }
+        EXPECT_EQ(cloud->points_.size(), num_expected);
+    }
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kInputDirectory));
+}
+
+TEST(TiledPointCloud, VoxelDownSample) {
+    geometry::PointCloud pc = CreateCloud(3000);
+    auto tiled = WriteTiles(pc, 1.0);
+    for (double voxel_size : {0.1, 0.35}) {
+        auto result = tiled->VoxelDownSample(voxel_size, kOutputDirectory);
+        ExpectSamePoints(*pc.VoxelDownSample(voxel_size),
+                         *result->ReadPointCloud(), 1e-12);
+    }
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kOutputDirectory));
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kInputDirectory));
+}
+
+TEST(TiledPointCloud, Crop) {
+    geometry::PointCloud pc = CreateCloud(3000);
+    auto tiled = WriteTiles(pc, 1.0);
+    geometry::AxisAlignedBoundingBox aabb(Vector3d(0.5, 0.2, 1.1),
+                                          Vector3d(1.7, 0.9, 2.5));
+    ExpectSamePoints(*pc.Crop(aabb),
+                     *tiled->Crop(aabb, kOutputDirectory)->ReadPointCloud(),
+                     0.0);
+    geometry::OrientedBoundingBox obb(
+            Vector3d(1.5, 1.5, 1.5),
+            geometry::Geometry3D::GetRotationMatrixFromXYZ(
+                    Vector3d(0.3, 0.2, 0.1)),
+            Vector3d(1.0, 2.0, 0.5));
+    ExpectSamePoints(*pc.Crop(obb),
+                     *tiled->Crop(obb, kOutputDirectory)->ReadPointCloud(),
+                     0.0);
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kOutputDirectory));
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kInputDirectory));
+}
+
+TEST(TiledPointCloud, RemoveStatisticalOutliers) {
+    geometry::PointCloud pc = CreateCloud(3000);
+    auto tiled = WriteTiles(pc, 1.0);
+    auto result = tiled->RemoveStatisticalOutliers(10, 1.0, 0.5,
+                                                   kOutputDirectory);
+    auto expected = std::get<0>(pc.RemoveStatisticalOutliers(10, 1.0));
+    EXPECT_LT(expected->points_.size(), pc.points_.size());
+    ExpectSamePoints(*expected, *result->ReadPointCloud(), 0.0);
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kOutputDirectory));
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kInputDirectory));
+}
+
+TEST(TiledPointCloud, EstimateNormals) {
+    geometry::PointCloud pc = CreateCloud(3000);
+    pc.normals_.clear();
+    auto tiled = WriteTiles(pc, 1.0);
+    const geometry::KDTreeSearchParamHybrid param(0.4, 20);
+    auto result = tiled->EstimateNormals(param, 0.4, kOutputDirectory);
+    EXPECT_TRUE(result->HasNormals());
+    pc.EstimateNormals(param);
+    geometry::PointCloud expected = SortPoints(pc);
+    geometry::PointCloud actual = SortPoints(*result->ReadPointCloud());
+    ExpectEQ(expected.points_, actual.points_, 0.0);
+    ASSERT_EQ(expected.normals_.size(), actual.normals_.size());
+    for (size_t i = 0; i < expected.normals_.size(); i++) {
+        EXPECT_NEAR(std::abs(expected.normals_[i].dot(actual.normals_[i])),
+                    1.0, 1e-6);
+    }
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kOutputDirectory));
+    EXPECT_TRUE(geometry::TiledPointCloud::Remove(kInputDirectory));
+}
@@ -234,6 +234,26 @@ def test_tensor_to_numpy_scope():
     np.testing.assert_equal(dst_t, src_t)
 
 
+@pytest.mark.parametrize("mmap", [False, True])
+def test_tensor_save_load(tmp_path, mmap):
+    src_t = np.arange(12, dtype=np.float32).reshape((3, 4))
+
+    # NumPy to Open3D, including Fortran order and compressed archives.
+    np.save(str(tmp_path / "c.npy"), src_t)
+    np.save(str(tmp_path / "f.npy"), np.asfortranarray(src_t))
+    np.savez_compressed(str(tmp_path / "z.npz"), src_t)
+    for name in ["c.npy", "f.npy", "z.npz"]:
+        o3d_t = o3d.Tensor.load(str(tmp_path / name), mmap)
+        np.testing.assert_equal(o3d_t.numpy(), src_t)
+
+    # Open3D to NumPy.
+    o3d.Tensor(src_t).save(str(tmp_path / "o3d.npy"))
+    np.testing.assert_equal(np.load(str(tmp_path / "o3d.npy")), src_t)
+    o3d.Tensor(src_t).save(str(tmp_path / "o3d.npz"))
+    np.testing.assert_equal(np.load(str(tmp_path / "o3d.npz"))["arr_0"],
+                            src_t)
+
+
 @pytest.mark.parametrize("device", list_devices())
 def test_tensor_to_pytorch_scope(device):
     if not _torch_imported:
@@ -595,6 +615,57 @@ def test_reduction_argmin_argmax(dim):
     np.testing.assert_allclose(o3_dst.numpy(), np_dst)
 
 
+@pytest.mark.parametrize(
+    "dim",
+    [0, 1, 2, (), (0,), (1,), (2,), (0, 1), (0, 2), (1, 2), (0, 1, 2), None])
+@pytest.mark.parametrize("keepdim", [True, False])
+def test_reduction_mean_var_std(dim, keepdim):
+    np_src = np.random.rand(2, 3, 4)
+    o3_src = o3d.Tensor(np_src)
+
+    np.testing.assert_allclose(
+        o3_src.mean(dim=dim, keepdim=keepdim).numpy(),
+        np_src.mean(axis=dim, keepdims=keepdim))
+    np.testing.assert_allclose(
+        o3_src.var(dim=dim, keepdim=keepdim).numpy(),
+        np_src.var(axis=dim, keepdims=keepdim))
+    np.testing.assert_allclose(
+        o3_src.std(dim=dim, keepdim=keepdim).numpy(),
+        np_src.std(axis=dim, keepdims=keepdim))
+
+
+@pytest.mark.parametrize("dim", [0, 1, 2, (0, 2), None])
+@pytest.mark.parametrize("keepdim", [True, False])
+def test_reduction_any_all(dim, keepdim):
+    np_src = np.random.rand(2, 3, 4) > 0.5
+    o3_src = o3d.Tensor(np_src)
+
+    np.testing.assert_equal(
+        o3_src.any(dim=dim, keepdim=keepdim).numpy(),
+        np_src.any(axis=dim, keepdims=keepdim))
+    np.testing.assert_equal(
+        o3_src.all(dim=dim, keepdim=keepdim).numpy(),
+        np_src.all(axis=dim, keepdims=keepdim))
+
+
+@pytest.mark.parametrize("lhs_shape, rhs_shape", [
+    ((2, 3), (3, 4)),
+    ((3,), (3, 4)),
+    ((2, 3), (3,)),
+    ((3,), (3,)),
+    ((5, 1, 2, 3), (4, 3, 2)),
+])
+def test_matmul(lhs_shape, rhs_shape):
+    np_lhs = np.random.rand(*lhs_shape).astype(np.float32)
+    np_rhs = np.random.rand(*rhs_shape).astype(np.float32)
+    o3_lhs = o3d.Tensor(np_lhs)
+    o3_rhs = o3d.Tensor(np_rhs)
+
+    np.testing.assert_allclose((o3_lhs @ o3_rhs).numpy(),
+                               np_lhs @ np_rhs,
+                               rtol=1e-5)
+
+
 def test_advanced_index_get_mixed():
     np_src = np.array(range(24)).reshape((2, 3, 4))
     o3_src = o3d.Tensor(np_src)
@@ -835,3 +906,22 @@ def test_scalar_op():
     np.testing.assert_equal(a.numpy(), np.full((2, 3), 2.5))
     a /= True
     np.testing.assert_equal(a.numpy(), np.full((2, 3), 2.5))
+
+
+def test_memory_manager_cache():
+    device = o3d.Device("CPU:0")
+    o3d.MemoryManager.set_cache_enabled(device, True)
+    assert o3d.MemoryManager.is_cache_enabled(device)
+
+    stats = o3d.MemoryManager.get_statistics(device)
+    for _ in range(10):
+        o3d.Tensor.ones((100, 3), o3d.Dtype.Float32)
+    new_stats = o3d.MemoryManager.get_statistics(device)
+    assert new_stats.num_mallocs > stats.num_mallocs
+    assert new_stats.num_cache_hits > stats.num_cache_hits
+    assert 0 < new_stats.hit_rate <= 1
+
+    o3d.MemoryManager.release_cache(device)
+    assert o3d.MemoryManager.get_statistics(device).bytes_cached == 0
+    o3d.MemoryManager.set_cache_enabled(device, False)
+    assert not o3d.MemoryManager.is_cache_enabled(device)
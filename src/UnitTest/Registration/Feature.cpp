@@ -24,8 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "Open3D/Registration/Feature.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Feature, DISABLED_Resize) { unit_test::NotImplemented(); }
 
 TEST(Feature, DISABLED_Dimension) { unit_test::NotImplemented(); }
@@ -35,3 +42,54 @@ TEST(Feature, DISABLED_Num) { unit_test::NotImplemented(); }
 TEST(Feature, DISABLED_ComputeFPFHFeature) { unit_test::NotImplemented(); }
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { unit_test::NotImplemented(); }
+
+TEST(Feature, CorrespondencesFromFeatures) {
+    const int n = 200;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    registration::Feature source, target;
+    source.Resize(8, n + 1);
+    target.Resize(8, n + 1);
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < 8; k++) source.data_(k, i) = uniform(rng);
+    }
+    std::vector<int> permutation(n);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), rng);
+    for (int i = 0; i < n; i++) {
+        target.data_.col(permutation[i]) = source.data_.col(i);
+    }
+    // Source n is a slightly moved copy of source 0, so its match is not
+    // mutual.
+    source.data_.col(n) = source.data_.col(0);
+    source.data_(0, n) += 0.01;
+    // Target n is nearly as close to source 1 as its true match, so the ratio
+    // test rejects source 1.
+    target.data_.col(permutation[1]) = source.data_.col(1);
+    target.data_(0, permutation[1]) += 0.01;
+    target.data_.col(n) = source.data_.col(1);
+    target.data_(0, n) -= 0.011;
+
+    auto corres = registration::CorrespondencesFromFeatures(source, target);
+    ASSERT_EQ(corres.size(), size_t(n + 1));
+    for (int i = 0; i < n; i++) {
+        EXPECT_EQ(corres[i](0), i);
+        EXPECT_EQ(corres[i](1), permutation[i]);
+    }
+    EXPECT_EQ(corres[n](0), n);
+    EXPECT_EQ(corres[n](1), permutation[0]);
+
+    corres = registration::CorrespondencesFromFeatures(source, target, true);
+    ASSERT_EQ(corres.size(), size_t(n));
+    for (int i = 0; i < n; i++) {
+        EXPECT_EQ(corres[i](0), i);
+        EXPECT_EQ(corres[i](1), permutation[i]);
+    }
+
+    corres = registration::CorrespondencesFromFeatures(source, target, false,
+                                                       0.8);
+    ASSERT_EQ(corres.size(), size_t(n));
+    for (const auto &c : corres) {
+        EXPECT_NE(c(0), 1);
+    }
+}
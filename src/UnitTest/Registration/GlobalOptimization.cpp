@@ -24,14 +24,104 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
+#include <random>
+
+#include "Open3D/Registration/GlobalOptimization.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+Eigen::Matrix4d RandomMotion(std::mt19937 &rng,
+                             double rotation,
+                             double translation) {
+    std::normal_distribution<double> normal(0.0, 1.0);
+    Eigen::Vector6d motion;
+    for (int i = 0; i < 6; i++) {
+        motion(i) = normal(rng) * (i < 3 ? rotation : translation);
+    }
+    return utility::TransformVector6dToMatrix4d(motion);
+}
+
+/// Pose graph of a random walk with exact odometry edges, exact loop
+/// closures between nearby nodes and noisy initial poses. \p poses receives
+/// the true poses.
+registration::PoseGraph CreatePoseGraph(int n_nodes,
+                                        bool with_outlier,
+                                        std::vector<Eigen::Matrix4d> &poses) {
+    std::mt19937 rng(0);
+    poses.assign(1, Eigen::Matrix4d::Identity());
+    for (int i = 1; i < n_nodes; i++) {
+        poses.push_back(poses.back() * RandomMotion(rng, 0.05, 0.3));
+    }
+    registration::PoseGraph pose_graph;
+    pose_graph.nodes_.emplace_back(poses[0]);
+    for (int i = 1; i < n_nodes; i++) {
+        pose_graph.nodes_.emplace_back(poses[i] *
+                                       RandomMotion(rng, 0.02, 0.05));
+    }
+    const Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 100.0;
+    auto add_edge = [&](int source, int target, bool uncertain) {
+        pose_graph.edges_.emplace_back(source, target,
+                                       poses[target].inverse() * poses[source],
+                                       information, uncertain);
+    };
+    for (int i = 0; i + 1 < n_nodes; i++) {
+        add_edge(i, i + 1, false);
+    }
+    for (int i = 0; i + 5 < n_nodes; i += 3) {
+        add_edge(i, i + 5, true);
+    }
+    if (with_outlier) {
+        pose_graph.edges_.emplace_back(
+                0, n_nodes / 2, RandomMotion(rng, 0.5, 2.0), information,
+                true);
+    }
+    return pose_graph;
+}
+
+void ExpectPosesNear(const registration::PoseGraph &pose_graph,
+                     const std::vector<Eigen::Matrix4d> &poses) {
+    ASSERT_EQ(pose_graph.nodes_.size(), poses.size());
+    for (size_t i = 0; i < poses.size(); i++) {
+        unit_test::ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_),
+                            poses[i], 1e-4);
+    }
+}
+
+}  // unnamed namespace
+
 TEST(GlobalOptimization, DISABLED_Constructor) { unit_test::NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { unit_test::NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    unit_test::NotImplemented();
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    std::vector<Eigen::Matrix4d> poses;
+    registration::PoseGraph pose_graph = CreatePoseGraph(60, false, poses);
+    registration::GlobalOptimizationOption option;
+    option.reference_node_ = 0;
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationGaussNewton(),
+            registration::GlobalOptimizationConvergenceCriteria(), option);
+    ExpectPosesNear(pose_graph, poses);
+}
+
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    std::vector<Eigen::Matrix4d> poses;
+    registration::PoseGraph pose_graph = CreatePoseGraph(60, true, poses);
+    const size_t n_edges = pose_graph.edges_.size();
+    registration::GlobalOptimizationOption option;
+    option.reference_node_ = 0;
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationLevenbergMarquardt(),
+            registration::GlobalOptimizationConvergenceCriteria(), option);
+    ExpectPosesNear(pose_graph, poses);
+    // The outlier loop closure is pruned.
+    EXPECT_EQ(pose_graph.edges_.size(), n_edges - 1);
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/ICPEngine.h"
+#include "Open3D/Utility/Eigen.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Points on the faces of a unit cube, which constrain all six degrees of
+/// freedom.
+std::shared_ptr<geometry::PointCloud> CreateCube(int n) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    auto cloud = std::make_shared<geometry::PointCloud>();
+    for (int i = 0; i < n; i++) {
+        Eigen::Vector3d p(uniform(rng), uniform(rng), uniform(rng));
+        p(i % 3) = double(i / 3 % 2);
+        cloud->points_.push_back(p);
+    }
+    return cloud;
+}
+
+Eigen::Matrix4d SmallMotion(double scale) {
+    Eigen::Vector6d motion;
+    motion << 0.02, -0.03, 0.04, 0.03, 0.02, -0.01;
+    return utility::TransformVector6dToMatrix4d(motion * scale);
+}
+
+}  // unnamed namespace
+
+TEST(ICPEngine, Register) {
+    auto target = CreateCube(3000);
+    geometry::PointCloud source = *target;
+    const Eigen::Matrix4d transformation = SmallMotion(1.0);
+    source.Transform(transformation.inverse());
+
+    registration::ICPEngine engine(target);
+    registration::ICPConvergenceCriteria criteria(1e-9, 1e-9, 100);
+    auto result = engine.Register(
+            source, 0.2, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPoint(false),
+            criteria);
+    EXPECT_DOUBLE_EQ(result.fitness_, 1.0);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-6);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation, 1e-5);
+    ASSERT_EQ(result.correspondence_set_.size(), source.points_.size());
+    for (size_t i = 0; i < result.correspondence_set_.size(); i++) {
+        EXPECT_EQ(result.correspondence_set_[i](0), int(i));
+        EXPECT_EQ(result.correspondence_set_[i](1), int(i));
+    }
+
+    const auto &info = engine.GetIterationInfo();
+    ASSERT_GE(info.size(), 2u);
+    for (size_t i = 0; i < info.size(); i++) {
+        EXPECT_EQ(info[i].iteration_, int(i));
+        EXPECT_GE(info[i].estimation_time_, 0.0);
+        EXPECT_GE(info[i].correspondence_time_, 0.0);
+    }
+    EXPECT_EQ(info[0].estimation_time_, 0.0);
+    EXPECT_EQ(info.back().fitness_, result.fitness_);
+    EXPECT_EQ(info.back().inlier_rmse_, result.inlier_rmse_);
+
+    // The engine matches the one-shot API.
+    auto expected = registration::RegistrationICP(
+            source, *target, 0.2, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPoint(false),
+            criteria);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        Eigen::Matrix4d(expected.transformation_));
+    EXPECT_EQ(result.correspondence_set_, expected.correspondence_set_);
+}
+
+TEST(ICPEngine, RepeatedCalls) {
+    auto target = CreateCube(2000);
+    registration::ICPEngine engine(target);
+    for (int k = 1; k <= 3; k++) {
+        // Sources of different sizes reuse the buffers of the engine.
+        geometry::PointCloud source = *CreateCube(2000 - 500 * k);
+        source.Transform(SmallMotion(0.5 * k));
+        auto result = engine.Register(source, 0.2);
+        auto expected = registration::RegistrationICP(source, *target, 0.2);
+        unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                            Eigen::Matrix4d(expected.transformation_));
+        EXPECT_EQ(result.fitness_, expected.fitness_);
+        EXPECT_EQ(result.correspondence_set_, expected.correspondence_set_);
+
+        auto evaluation = engine.Evaluate(source, 0.2, result.transformation_);
+        EXPECT_EQ(evaluation.fitness_, result.fitness_);
+        EXPECT_NEAR(evaluation.inlier_rmse_, result.inlier_rmse_, 1e-12);
+    }
+}
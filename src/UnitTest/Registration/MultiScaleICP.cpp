@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/ColoredICP.h"
+#include "Open3D/Registration/MultiScaleICP.h"
+#include "Open3D/Utility/Eigen.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Random points on the faces of a unit cube, colored by position.
+geometry::PointCloud CreateColoredCube(int n, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    geometry::PointCloud cloud;
+    for (int i = 0; i < n; i++) {
+        Eigen::Vector3d p(uniform(rng), uniform(rng), uniform(rng));
+        p(i % 3) = double(i / 3 % 2);
+        cloud.points_.push_back(p);
+        cloud.colors_.push_back(Eigen::Vector3d(
+                0.5 + 0.5 * std::sin(6.0 * p(0)), 0.5 + 0.5 * p(1), p(2)));
+    }
+    return cloud;
+}
+
+Eigen::Matrix4d Motion() {
+    Eigen::Vector6d motion;
+    motion << 0.05, -0.08, 0.1, 0.08, -0.06, 0.05;
+    return utility::TransformVector6dToMatrix4d(motion);
+}
+
+}  // unnamed namespace
+
+TEST(MultiScaleICP, PointCloudPyramid) {
+    const auto cloud = CreateColoredCube(20000, 0);
+    registration::PointCloudPyramid pyramid(cloud, {0.1, 0.05, 0.025});
+    ASSERT_EQ(pyramid.NumLevels(), 3);
+    EXPECT_EQ(pyramid.GetVoxelSize(1), 0.05);
+    for (int level = 0; level < pyramid.NumLevels(); level++) {
+        const auto &points = pyramid.GetLevel(level);
+        EXPECT_TRUE(points.HasNormals());
+        EXPECT_TRUE(points.HasColors());
+        if (level > 0) {
+            EXPECT_GT(points.points_.size(),
+                      pyramid.GetLevel(level - 1).points_.size());
+        }
+    }
+    EXPECT_EQ(&pyramid.GetEngine(2), &pyramid.GetEngine(2));
+    EXPECT_EQ(&pyramid.GetEngine(2).GetTarget(), &pyramid.GetLevel(2));
+    EXPECT_ANY_THROW(pyramid.GetLevel(3));
+}
+
+TEST(MultiScaleICP, RegistrationMultiScaleICP) {
+    const Eigen::Matrix4d transformation = Motion();
+    auto source_cloud = CreateColoredCube(20000, 1);
+    source_cloud.Transform(transformation.inverse());
+    registration::PointCloudPyramid source(source_cloud, {0.1, 0.05, 0.025});
+    registration::PointCloudPyramid target(CreateColoredCube(20000, 0),
+                                           {0.1, 0.05, 0.025});
+    const std::vector<double> distances = {0.3, 0.1, 0.05};
+    const std::vector<registration::ICPConvergenceCriteria> criteria(
+            3, registration::ICPConvergenceCriteria(1e-6, 1e-6, 50));
+
+    auto result = registration::RegistrationMultiScaleICP(
+            source, target, distances, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPlane(), criteria);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation, 1e-2);
+    EXPECT_GT(result.fitness_, 0.95);
+
+    // The pyramids are reused, and early exit evaluates on the finest level.
+    auto early = registration::RegistrationMultiScaleICP(
+            source, target, distances, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPlane(), criteria,
+            1.0);
+    auto evaluation = target.GetEngine(2).Evaluate(
+            source.GetLevel(2), distances[2], early.transformation_);
+    EXPECT_EQ(early.fitness_, evaluation.fitness_);
+    EXPECT_EQ(early.correspondence_set_, evaluation.correspondence_set_);
+
+    EXPECT_ANY_THROW(registration::RegistrationMultiScaleICP(
+            source, target, {0.3, 0.1}, Eigen::Matrix4d::Identity()));
+}
+
+TEST(MultiScaleICP, RegistrationMultiScaleColoredICP) {
+    const Eigen::Matrix4d transformation = Motion();
+    auto source_cloud = CreateColoredCube(20000, 1);
+    source_cloud.Transform(transformation.inverse());
+    registration::PointCloudPyramid source(source_cloud, {0.1, 0.05, 0.025});
+    registration::PointCloudPyramid target(CreateColoredCube(20000, 0),
+                                           {0.1, 0.05, 0.025});
+    const std::vector<registration::ICPConvergenceCriteria> criteria(
+            3, registration::ICPConvergenceCriteria(1e-6, 1e-6, 50));
+
+    auto result = registration::RegistrationMultiScaleColoredICP(
+            source, target, {0.3, 0.1, 0.05}, Eigen::Matrix4d::Identity(),
+            criteria);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation, 1e-2);
+    EXPECT_GT(result.fitness_, 0.95);
+
+    // Registering against a plain engine is rejected.
+    EXPECT_ANY_THROW(registration::RegistrationColoredICP(
+            source.GetLevel(2), target.GetEngine(2), 0.05));
+}
@@ -24,8 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Registration, DISABLED_ICPConvergenceCriteria) {
     unit_test::NotImplemented();
 }
@@ -56,8 +65,54 @@ TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
     unit_test::NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
-    unit_test::NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnFeatureMatching) {
+    const int n = 500;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    geometry::PointCloud source;
+    registration::Feature source_feature, target_feature;
+    source_feature.Resize(16, n);
+    target_feature.Resize(16, n);
+    for (int i = 0; i < n; i++) {
+        source.points_.emplace_back(uniform(rng), uniform(rng), uniform(rng));
+        for (int k = 0; k < 16; k++) {
+            source_feature.data_(k, i) = uniform(rng);
+        }
+    }
+    // A third of the target features are unrelated to the source, so a third
+    // of the feature matches are outliers.
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < 16; k++) {
+            target_feature.data_(k, i) =
+                    i % 3 == 0 ? uniform(rng) : source_feature.data_(k, i);
+        }
+    }
+    Eigen::Vector6d motion;
+    motion << 0.3, -0.2, 0.5, 1.0, 0.5, -0.3;
+    const Eigen::Matrix4d transformation =
+            utility::TransformVector6dToMatrix4d(motion);
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+
+    registration::CorrespondenceCheckerBasedOnEdgeLength edge_length(0.9);
+    registration::CorrespondenceCheckerBasedOnDistance distance(0.05);
+    auto result = registration::RegistrationRANSACBasedOnFeatureMatching(
+            source, target, source_feature, target_feature, 0.05,
+            registration::TransformationEstimationPointToPoint(false), 4,
+            {edge_length, distance},
+            registration::RANSACConvergenceCriteria(100000, 500));
+    EXPECT_DOUBLE_EQ(result.fitness_, 1.0);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-6);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation,
+                        1e-6);
+    EXPECT_EQ(result.correspondence_set_.size(), size_t(n));
+
+    // Too few correspondences survive the filters.
+    result = registration::RegistrationRANSACBasedOnFeatureMatching(
+            source, target, source_feature, target_feature, 0.05,
+            registration::TransformationEstimationPointToPoint(false), 4, {},
+            registration::RANSACConvergenceCriteria(), false, 0.0);
+    EXPECT_EQ(result.fitness_, 0.0);
 }
 
 TEST(Registration, DISABLED_GetInformationMatrixFromPointClouds) {
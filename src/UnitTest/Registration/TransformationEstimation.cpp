@@ -24,8 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(TransformationEstimation, DISABLED_Constructor) {
     unit_test::NotImplemented();
 }
@@ -54,6 +61,51 @@ TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPoint) {
     unit_test::NotImplemented();
 }
 
-TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPlane) {
-    unit_test::NotImplemented();
+TEST(TransformationEstimation, TransformationEstimationPointToPlane) {
+    // Points on the faces of a unit cube matched to their true positions,
+    // with a quarter of the matches replaced by random outliers.
+    const int n = 4000;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::uniform_int_distribution<int> index(0, n - 1);
+    geometry::PointCloud target;
+    for (int i = 0; i < n; i++) {
+        Eigen::Vector3d p(uniform(rng), uniform(rng), uniform(rng));
+        Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+        p(i % 3) = double(i / 3 % 2);
+        normal(i % 3) = 1.0;
+        target.points_.push_back(p);
+        target.normals_.push_back(normal);
+    }
+    Eigen::Vector6d motion;
+    motion << 0.02, -0.01, 0.03, 0.01, 0.02, -0.02;
+    const Eigen::Matrix4d transformation =
+            utility::TransformVector6dToMatrix4d(motion);
+    registration::CorrespondenceSet corres;
+    for (int i = 0; i < n; i++) {
+        corres.push_back(Eigen::Vector2i(i, i % 4 == 0 ? index(rng) : i));
+    }
+
+    // Gauss-Newton iterations on the fixed correspondences.
+    auto align = [&](const registration::TransformationEstimation &estimation) {
+        geometry::PointCloud source;
+        source.points_ = target.points_;
+        source.Transform(transformation.inverse());
+        Eigen::Matrix4d estimate = Eigen::Matrix4d::Identity();
+        for (int k = 0; k < 10; k++) {
+            Eigen::Matrix4d update =
+                    estimation.ComputeTransformation(source, target, corres);
+            source.Transform(update);
+            estimate = update * estimate;
+        }
+        return estimate;
+    };
+
+    registration::TransformationEstimationPointToPlane l2;
+    EXPECT_GT((align(l2) - transformation).norm(), 1e-2);
+    registration::TransformationEstimationPointToPlane tukey(
+            std::make_shared<registration::TukeyLoss>(0.05));
+    unit_test::ExpectEQ(align(tukey), transformation, 1e-3);
+    registration::TransformationEstimationPointToPlane no_kernel(nullptr);
+    unit_test::ExpectEQ(align(no_kernel), align(l2));
 }
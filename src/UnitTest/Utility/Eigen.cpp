@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <random>
+
 #include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
@@ -257,3 +259,64 @@ TEST(Eigen, ComputeJTJandJTr_vector) {
     ExpectEQ(ref_JTr, JTr);
     ExpectEQ(ref_JTJ, JTJ);
 }
+
+TEST(Eigen, ComputeWeightedJTJandJTr) {
+    const int n = 5000;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    vector<Vector6d, utility::Vector6d_allocator> J(2 * n);
+    vector<double> r(2 * n), w(2 * n);
+    Matrix6d ref_JTJ = Matrix6d::Zero();
+    Vector6d ref_JTr = Vector6d::Zero();
+    double ref_r2 = 0.0;
+    for (int i = 0; i < 2 * n; i++) {
+        for (int k = 0; k < 6; k++) J[i](k) = uniform(rng);
+        r[i] = uniform(rng);
+        w[i] = 0.5 * (uniform(rng) + 1.0);
+        ref_JTJ += w[i] * J[i] * J[i].transpose();
+        ref_JTr += w[i] * J[i] * r[i];
+        ref_r2 += r[i] * r[i];
+    }
+
+    Matrix6d JTJ;
+    Vector6d JTr;
+    double r2;
+    tie(JTJ, JTr, r2) = utility::ComputeWeightedJTJandJTr(
+            [&](int64_t i, Vector6d &J_r, Matrix<double, 1, 1> &r_i,
+                Matrix<double, 1, 1> &w_i) {
+                J_r = J[i];
+                r_i(0) = r[i];
+                w_i(0) = w[i];
+            },
+            2 * n);
+    ExpectEQ(ref_JTJ, JTJ, 1e-8);
+    ExpectEQ(ref_JTr, JTr, 1e-8);
+    EXPECT_NEAR(ref_r2, r2, 1e-8);
+
+    // Two rows per item.
+    tie(JTJ, JTr, r2) = utility::ComputeWeightedJTJandJTr<2>(
+            [&](int64_t i, Matrix<double, 6, 2> &J_r, Vector2d &r_i,
+                Vector2d &w_i) {
+                for (int k = 0; k < 2; k++) {
+                    J_r.col(k) = J[2 * i + k];
+                    r_i(k) = r[2 * i + k];
+                    w_i(k) = w[2 * i + k];
+                }
+            },
+            n);
+    ExpectEQ(ref_JTJ, JTJ, 1e-8);
+    ExpectEQ(ref_JTr, JTr, 1e-8);
+
+    // Float accumulation within blocks.
+    tie(JTJ, JTr, r2) = utility::ComputeWeightedJTJandJTr<1, float>(
+            [&](int64_t i, Vector6d &J_r, Matrix<double, 1, 1> &r_i,
+                Matrix<double, 1, 1> &w_i) {
+                J_r = J[i];
+                r_i(0) = r[i];
+                w_i(0) = w[i];
+            },
+            2 * n);
+    ExpectEQ(ref_JTJ, JTJ, 1e-2);
+    ExpectEQ(ref_JTr, JTr, 1e-2);
+    EXPECT_NEAR(ref_r2, r2, 1e-2);
+}
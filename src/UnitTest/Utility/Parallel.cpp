@@ -0,0 +1,243 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Runs every task on a dedicated thread and counts the scheduled tasks.
+class CountingScheduler : public utility::TaskScheduler {
+public:
+    ~CountingScheduler() override {
+        for (std::thread& thread : threads_) {
+            thread.join();
+        }
+    }
+    int GetNumThreads() const override { return 3; }
+    void Schedule(std::function<void()> task) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        num_scheduled_++;
+        threads_.emplace_back(std::move(task));
+    }
+
+    std::atomic<int> num_scheduled_{0};
+
+private:
+    std::mutex mutex_;
+    std::vector<std::thread> threads_;
+};
+
+}  // unnamed namespace
+
+TEST(Parallel, ParallelForCoversRange) {
+    for (int64_t grain_size : {1, 7, 1000, 100000}) {
+        std::vector<std::atomic<int>> counts(10007);
+        for (auto& count : counts) {
+            count = 0;
+        }
+        std::atomic<bool> chunk_too_small(false);
+        utility::ParallelFor(
+                3, 10007, grain_size, [&](int64_t start, int64_t end) {
+                    if (end - start < grain_size && end != 10007) {
+                        chunk_too_small = true;
+                    }
+                    for (int64_t i = start; i < end; ++i) {
+                        counts[i]++;
+                    }
+                });
+        EXPECT_FALSE(chunk_too_small);
+        for (int64_t i = 0; i < 10007; ++i) {
+            EXPECT_EQ(counts[i], i < 3 ? 0 : 1);
+        }
+    }
+
+    // Empty ranges do not call the function.
+    utility::ParallelFor(5, 5, 1, [](int64_t, int64_t) { FAIL(); });
+    utility::ParallelFor(5, 2, 1, [](int64_t, int64_t) { FAIL(); });
+}
+
+TEST(Parallel, ParallelRadixSort) {
+    std::mt19937_64 rng(0);
+    for (int num_key_bits : {0, 5, 17, 64}) {
+        for (int64_t num_items : {0, 1, 1000, 100003}) {
+            std::vector<uint64_t> keys(num_items);
+            std::vector<int64_t> values(num_items);
+            std::vector<std::pair<uint64_t, int64_t>> expected(num_items);
+            for (int64_t i = 0; i < num_items; ++i) {
+                keys[i] = rng();
+                if (num_key_bits < 64) {
+                    keys[i] &= (uint64_t(1) << num_key_bits) - 1;
+                }
+                values[i] = i;
+                expected[i] = std::make_pair(keys[i], i);
+            }
+            // The sort is stable, so equal keys keep the order of values.
+            std::sort(expected.begin(), expected.end());
+            utility::ParallelRadixSort(keys, values, num_key_bits);
+            ASSERT_EQ(int64_t(keys.size()), num_items);
+            ASSERT_EQ(int64_t(values.size()), num_items);
+            for (int64_t i = 0; i < num_items; ++i) {
+                EXPECT_EQ(keys[i], expected[i].first);
+                EXPECT_EQ(values[i], expected[i].second);
+            }
+        }
+    }
+
+    std::vector<uint64_t> keys(3);
+    std::vector<int64_t> values(2);
+    EXPECT_ANY_THROW(utility::ParallelRadixSort(keys, values));
+}
+
+TEST(Parallel, ParallelForMaxThreads) {
+    utility::SetMaxThreads(4);
+    EXPECT_LE(utility::GetMaxThreads(), 4);
+
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    std::atomic<int> num_active(0);
+    std::atomic<int> max_active(0);
+    utility::ParallelForEach(
+            0, 1000,
+            [&](int64_t) {
+                int active = ++num_active;
+                int expected = max_active.load();
+                while (active > expected &&
+                       !max_active.compare_exchange_weak(expected, active)) {
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    thread_ids.insert(std::this_thread::get_id());
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+                --num_active;
+            },
+            1, 2);
+    EXPECT_LE(max_active.load(), 2);
+    EXPECT_LE(thread_ids.size(), 2u);
+
+    // A single thread runs everything on the caller.
+    thread_ids.clear();
+    utility::ParallelForEach(
+            0, 1000,
+            [&](int64_t) {
+                std::lock_guard<std::mutex> lock(mutex);
+                thread_ids.insert(std::this_thread::get_id());
+            },
+            1, 1);
+    EXPECT_EQ(thread_ids,
+              std::set<std::thread::id>({std::this_thread::get_id()}));
+
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, ParallelForNested) {
+    utility::SetMaxThreads(4);
+    std::vector<std::atomic<int>> counts(64 * 64);
+    for (auto& count : counts) {
+        count = 0;
+    }
+    EXPECT_FALSE(utility::InParallel());
+    utility::ParallelForEach(0, 64, [&](int64_t i) {
+        EXPECT_TRUE(utility::InParallel());
+        utility::ParallelForEach(0, 64,
+                                 [&](int64_t j) { counts[i * 64 + j]++; });
+    });
+    EXPECT_FALSE(utility::InParallel());
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, ParallelForException) {
+    utility::SetMaxThreads(4);
+    std::atomic<int64_t> num_done(0);
+    EXPECT_THROW(utility::ParallelForEach(0, 100000,
+                                          [&](int64_t i) {
+                                              if (i == 500) {
+                                                  throw std::runtime_error(
+                                                          "error");
+                                              }
+                                              num_done++;
+                                          }),
+                 std::runtime_error);
+    EXPECT_LT(num_done.load(), 100000);
+    EXPECT_FALSE(utility::InParallel());
+
+    // The runtime is still usable afterwards.
+    num_done = 0;
+    utility::ParallelForEach(0, 1000, [&](int64_t) { num_done++; });
+    EXPECT_EQ(num_done.load(), 1000);
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, SetTaskScheduler) {
+    auto scheduler = std::make_shared<CountingScheduler>();
+    utility::SetTaskScheduler(scheduler);
+    EXPECT_EQ(utility::GetTaskScheduler(), scheduler);
+    EXPECT_LE(utility::GetMaxThreads(), 4);
+
+    std::atomic<int64_t> sum(0);
+    utility::ParallelForEach(0, 1000, [&](int64_t i) { sum += i; });
+    EXPECT_EQ(sum.load(), 999 * 1000 / 2);
+    if (utility::GetMaxThreads() > 1) {
+        EXPECT_GT(scheduler->num_scheduled_.load(), 0);
+    }
+
+    utility::SetTaskScheduler(nullptr);
+    EXPECT_NE(utility::GetTaskScheduler(), scheduler);
+}
+
+TEST(Parallel, ThreadPool) {
+    std::atomic<int> num_done(0);
+    {
+        utility::ThreadPool pool(3);
+        EXPECT_EQ(pool.GetNumThreads(), 3);
+        for (int i = 0; i < 100; ++i) {
+            pool.Schedule([&pool, &num_done]() {
+                // Tasks scheduled from a worker go to its own queue.
+                pool.Schedule([&num_done]() { num_done++; });
+                num_done++;
+            });
+        }
+    }
+    // The destructor runs the remaining tasks.
+    EXPECT_EQ(num_done.load(), 200);
+}